@@ -0,0 +1,65 @@
+#!/usr/bin/env bash
+
+# This file is a part of the TChecker project.
+#
+# See files AUTHORS and LICENSE for copyright details.
+
+# Benchmark of huge pages on covreach throughput. Each model is generated by a
+# script in examples/, and its whole zone graph is explored by covreach (no
+# searched label) with regular pages, then with each huge pages mode. The
+# script outputs one line per run: model, mode, visited states, running time,
+# visited states per second, and resident memory.
+
+function usage() {
+    echo "Usage: $0 tck-reach [runs] [table-size]";
+    echo "       tck-reach   path to tck-reach"
+    echo "       runs        number of runs of each configuration (default: 3)"
+    echo "       table-size  size of hash tables (default: 4194304)"
+}
+
+if [ $# -lt 1 ] || [ $# -gt 3 ]; then
+    usage
+    exit 1
+fi
+
+TCK_REACH=$1
+RUNS=${2:-3}
+TABLE_SIZE=${3:-4194304}
+EXAMPLES_DIR=$(cd "$(dirname "$0")/../examples" && pwd)
+
+# Models: generator and arguments
+MODELS="fischer-async.sh:7:10
+dining-philosophers.sh:6:3:10:0
+csmacd.sh:9"
+
+# Huge pages modes: explicit huge pages are only benchmarked when some are free
+MODES="none thp"
+if [ "$(awk '/^HugePages_Free/ { print $2 }' /proc/meminfo)" != "0" ]; then
+    MODES="${MODES} explicit"
+fi
+
+MODEL_FILE=$(mktemp)
+trap 'rm -f ${MODEL_FILE}' EXIT
+
+printf "%-36s %-8s %10s %10s %12s %12s\n" "model" "mode" "states" "seconds" "states/s" "max_rss"
+for model in ${MODELS}; do
+    generator=$(echo "${model}" | cut -d: -f1)
+    args=$(echo "${model}" | cut -d: -f2- | tr : ' ')
+    "${EXAMPLES_DIR}/${generator}" ${args} > "${MODEL_FILE}"
+
+    for mode in ${MODES}; do
+        option=""
+        if [ "${mode}" != "none" ]; then
+            option="--huge-pages ${mode}"
+        fi
+        for run in $(seq 1 "${RUNS}"); do
+            output=$("${TCK_REACH}" -a covreach -s bfs --table-size "${TABLE_SIZE}" ${option} "${MODEL_FILE}")
+            states=$(echo "${output}" | awk '/^VISITED_STATES/ { print $2 }')
+            seconds=$(echo "${output}" | awk '/^RUNNING_TIME_SECONDS/ { print $2 }')
+            rss=$(echo "${output}" | awk '/^MEMORY_MAX_RSS/ { print $2 }')
+            rate=$(awk -v n="${states}" -v t="${seconds}" 'BEGIN { printf "%.0f", (t > 0 ? n / t : 0) }')
+            printf "%-36s %-8s %10s %10.3f %12s %12s\n" "${generator%.sh} ${args}" "${mode}" "${states}" "${seconds}" \
+                   "${rate}" "${rss}"
+        done
+    done
+done
@@ -0,0 +1,164 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_ALGORITHMS_BWD_REACH_ALGORITHM_HH
+#define TCHECKER_ALGORITHMS_BWD_REACH_ALGORITHM_HH
+
+#include <memory>
+#include <vector>
+
+#include "tchecker/algorithms/bwd_reach/stats.hh"
+#include "tchecker/basictypes.hh"
+#include "tchecker/waiting/factory.hh"
+
+/*!
+ \file algorithm.hh
+ \brief Backward reachability algorithm
+ */
+
+namespace tchecker {
+
+namespace algorithms {
+
+namespace bwd_reach {
+
+/*!
+ \class algorithm_t
+ \brief Backward reachability algorithm
+ \tparam TS : type of transition system, should implement tchecker::ts::bwd_t,
+ tchecker::ts::bwd_impl_t and tchecker::ts::inspector_t
+ \tparam GRAPH : type of graph, should derive from
+ tchecker::graph::reachability_graph_t, and nodes of type GRAPH::shared_node_t
+ should have a method state_ptr() that yields a pointer to the corresponding
+ state in TS
+ */
+template <class TS, class GRAPH> class algorithm_t {
+public:
+  using node_sptr_t = typename GRAPH::node_sptr_t;
+
+  /*!
+   \brief Build a backward reachability graph of a transition system from its
+   final states
+   \param ts : a transition system
+   \param graph : a graph
+   \param final_edges : range of final edges of ts
+   \param policy : waiting list policy
+   \post graph is built from a backward traversal of ts starting from the
+   final states along final_edges, until a state that contains an initial state
+   is reached (if any).
+   A node is created for each state in ts that is visited, and an edge is
+   created from s' to s for each transition s' -> s visited backward. Nodes
+   built from final states are final, and nodes that contain an initial state
+   are initial. The order in which the nodes of ts are visited depends on policy
+   \return statistics on the run
+   \note if final_edges is empty, no state is visited
+   */
+  tchecker::algorithms::bwd_reach::stats_t run(TS & ts, GRAPH & graph, typename TS::final_range_t const & final_edges,
+                                               enum tchecker::waiting::policy_t policy)
+  {
+    std::unique_ptr<tchecker::waiting::waiting_t<node_sptr_t>> waiting{tchecker::waiting::factory<node_sptr_t>(policy)};
+    return run(ts, graph, final_edges, *waiting);
+  }
+
+  /*!
+   \brief Build a backward reachability graph of a transition system from its
+   final states, using a given waiting container
+   \param ts : a transition system
+   \param graph : a graph
+   \param final_edges : range of final edges of ts
+   \param waiting : an empty waiting container
+   \post same as the run method above, the order in which the nodes of ts are
+   visited depends on waiting. waiting is empty
+   \return statistics on the run
+   \note final states are not all computed upfront: the next final edge of ts
+   is only instantiated when waiting is empty. This keeps memory usage
+   independent from the (possibly exponential) number of final edges, and
+   allows to stop as soon as an initial state is found backward from the first
+   final states. final_edges is typically restricted to the states of
+   interest, rather than obtained from ts.final_edges(labels) which ranges
+   over all tuples of locations (see tchecker::algorithms::bwd_reach::target_t)
+   */
+  tchecker::algorithms::bwd_reach::stats_t run(TS & ts, GRAPH & graph, typename TS::final_range_t const & final_edges,
+                                               tchecker::waiting::waiting_t<node_sptr_t> & waiting)
+  {
+    tchecker::algorithms::bwd_reach::stats_t stats;
+    std::vector<typename TS::sst_t> sst;
+
+    stats.set_start_time();
+
+    auto final_it = final_edges.begin();
+    auto final_end = final_edges.end();
+
+    while (true) {
+      if (waiting.empty()) {
+        if (final_it == final_end)
+          break;
+        insert_final_nodes(ts, graph, *final_it, waiting);
+        ++final_it;
+        continue;
+      }
+
+      node_sptr_t node = waiting.first();
+      waiting.remove_first();
+
+      ++stats.visited_states();
+
+      if (ts.is_initial(node->state_ptr())) {
+        node->initial(true);
+        stats.reachable() = true;
+        break;
+      }
+
+      ts.prev(node->state_ptr(), sst, tchecker::STATE_OK);
+      for (auto && [status, s, t] : sst) {
+        auto && [is_new_node, prev_node] = graph.add_node(s);
+        if (is_new_node)
+          waiting.insert(prev_node);
+        graph.add_edge(prev_node, node, *t);
+
+        ++stats.visited_transitions();
+      }
+      sst.clear();
+    }
+
+    waiting.clear();
+
+    stats.set_end_time();
+
+    return stats;
+  }
+
+  /*!
+   \brief Create nodes for the final states of a final edge
+   \param ts : a transition system
+   \param graph : a graph
+   \param final_edge : a final edge of ts
+   \param waiting : a waiting container
+   \post a final node has been added to graph for each final state of ts along
+   final_edge (if not yet in), and all new nodes have been inserted in waiting
+   */
+  void insert_final_nodes(TS & ts, GRAPH & graph, typename TS::final_value_t const & final_edge,
+                          tchecker::waiting::waiting_t<node_sptr_t> & waiting)
+  {
+    std::vector<typename TS::sst_t> sst;
+    ts.final(final_edge, sst, tchecker::STATE_OK);
+    for (auto && [status, s, t] : sst) {
+      auto && [is_new_node, final_node] = graph.add_node(s);
+      final_node->final(true);
+      if (is_new_node)
+        waiting.insert(final_node);
+    }
+  }
+};
+
+} // end of namespace bwd_reach
+
+} // end of namespace algorithms
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_ALGORITHMS_BWD_REACH_ALGORITHM_HH
@@ -0,0 +1,84 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_ALGORITHMS_BWD_REACH_STATS_HH
+#define TCHECKER_ALGORITHMS_BWD_REACH_STATS_HH
+
+#include <map>
+#include <string>
+
+#include "tchecker/algorithms/reach/stats.hh"
+
+/*!
+ \file stats.hh
+ \brief Statistics for backward and bidirectional reachability algorithms
+ */
+
+namespace tchecker {
+
+namespace algorithms {
+
+namespace bwd_reach {
+
+/*!
+ \class stats_t
+ \brief Statistics for backward and bidirectional reachability algorithms
+ \note visited states and transitions are the ones visited by the backward
+ exploration. States and transitions visited by the forward exploration of the
+ bidirectional algorithm are counted separately
+ */
+class stats_t : public tchecker::algorithms::reach::stats_t {
+public:
+  /*!
+   \brief Constructor
+   */
+  stats_t();
+
+  /*!
+   \brief Accessor
+   \return A reference to the number of states visited by forward exploration
+   */
+  unsigned long & forward_visited_states();
+
+  /*!
+   \brief Accessor
+   \return the number of states visited by forward exploration
+   */
+  unsigned long forward_visited_states() const;
+
+  /*!
+   \brief Accessor
+   \return A reference to the number of transitions visited by forward
+   exploration
+   */
+  unsigned long & forward_visited_transitions();
+
+  /*!
+   \brief Accessor
+   \return the number of transitions visited by forward exploration
+   */
+  unsigned long forward_visited_transitions() const;
+
+  /*!
+   \brief Extract statistics as attributes (key, value)
+   \param m : attributes map
+   \post every statistics has been added to m
+   */
+  void attributes(std::map<std::string, std::string> & m) const;
+
+private:
+  unsigned long _forward_visited_states;      /*!< Number of states visited by forward exploration */
+  unsigned long _forward_visited_transitions; /*!< Number of transitions visited by forward exploration */
+};
+
+} // end of namespace bwd_reach
+
+} // end of namespace algorithms
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_ALGORITHMS_BWD_REACH_STATS_HH
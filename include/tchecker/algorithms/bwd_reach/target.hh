@@ -0,0 +1,158 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_ALGORITHMS_BWD_REACH_TARGET_HH
+#define TCHECKER_ALGORITHMS_BWD_REACH_TARGET_HH
+
+#include <memory>
+#include <string>
+
+#include <boost/dynamic_bitset.hpp>
+
+#include "tchecker/parsing/declaration.hh"
+#include "tchecker/ta/state.hh"
+#include "tchecker/ta/system.hh"
+#include "tchecker/ta/ta.hh"
+
+/*!
+ \file target.hh
+ \brief Symbolic target states for backward reachability algorithms
+ */
+
+namespace tchecker {
+
+namespace algorithms {
+
+namespace bwd_reach {
+
+/*!
+ \brief Name of wildcard locations
+ \note this name cannot be declared in a system as it is not an identifier
+ */
+extern std::string const WILDCARD_LOCATION_NAME;
+
+/*!
+ \class target_t
+ \brief Target states of a set of labels, where the locations of the processes
+ that play no role in the target are left unconstrained
+ \note A process is a wildcard process if it has no location with one of the
+ labels, it does not constrain other processes (see
+ tchecker::ta::is_constraining_process), and it is not involved in a weak
+ synchronization. The target system is obtained by adding to each wildcard
+ process a location named WILDCARD_LOCATION_NAME that stands for any location of
+ the process: it is initial, it has no invariant and no label, and for each edge
+ of the process, it is the target of a copy of that edge. Target states have
+ wildcard processes in their wildcard location, hence the number of final edges
+ does not depend on the locations of wildcard processes. Exploring backward from
+ these states is exact: the predecessors of a wildcard location along an edge
+ are the predecessors of every location along this edge, and wildcard processes
+ do not restrict time elapse nor the interleaving of the other processes.
+ Locations and edges of the target system have the same identifiers as in the
+ original system
+ */
+class target_t {
+public:
+  /*!
+   \brief Constructor
+   \param sysdecl : system declaration
+   \param labels : comma-separated string of labels
+   \post this is the target of labels in the system declared by sysdecl
+   \throw std::invalid_argument : if labels contains an undeclared label
+   \throw std::runtime_error : if the target system cannot be built
+   */
+  target_t(tchecker::parsing::system_declaration_t const & sysdecl, std::string const & labels);
+
+  /*!
+   \brief Copy constructor
+   */
+  target_t(tchecker::algorithms::bwd_reach::target_t const &) = default;
+
+  /*!
+   \brief Move constructor
+   */
+  target_t(tchecker::algorithms::bwd_reach::target_t &&) = default;
+
+  /*!
+   \brief Destructor
+   */
+  ~target_t() = default;
+
+  /*!
+   \brief Assignment operator
+   */
+  tchecker::algorithms::bwd_reach::target_t & operator=(tchecker::algorithms::bwd_reach::target_t const &) = default;
+
+  /*!
+   \brief Move-assignment operator
+   */
+  tchecker::algorithms::bwd_reach::target_t & operator=(tchecker::algorithms::bwd_reach::target_t &&) = default;
+
+  /*!
+   \brief Accessor
+   \return target system, i.e. the system with wildcard locations
+   */
+  inline std::shared_ptr<tchecker::ta::system_t const> const & system() const { return _system; }
+
+  /*!
+   \brief Accessor
+   \return set of labels in the target system
+   */
+  inline boost::dynamic_bitset<> const & labels() const { return _labels; }
+
+  /*!
+   \brief Accessor
+   \return set of identifiers of wildcard processes
+   */
+  inline boost::dynamic_bitset<> const & wildcard_processes() const { return _wildcard_processes; }
+
+  /*!
+   \brief Accessor
+   \return set of identifiers of wildcard locations in the target system
+   */
+  inline boost::dynamic_bitset<> const & wildcard_locations() const { return _wildcard_locations; }
+
+  /*!
+   \brief Accessor
+   \return range of final edges of the target system that match labels(), where
+   wildcard processes are in their wildcard location
+   \note the range is empty if labels() is empty
+   */
+  tchecker::ta::final_range_t final_edges() const;
+
+  /*!
+   \brief Check if a state matches a target state
+   \param s : a state of the original system
+   \param t : a state of the target system
+   \return true if s and t have the same valuation of bounded integer variables,
+   and every process is in the same location in s and t, or in its wildcard
+   location in t, false otherwise
+   */
+  bool match(tchecker::ta::state_t const & s, tchecker::ta::state_t const & t) const;
+
+  /*!
+   \brief Hash value compatible with match
+   \param s : a state of the original system or of the target system
+   \return a hash value of the valuation of bounded integer variables and the
+   locations of processes that are not wildcard processes in s
+   \note s and t have the same hash value if match(s, t) holds
+   */
+  std::size_t hash_value(tchecker::ta::state_t const & s) const;
+
+private:
+  std::shared_ptr<tchecker::ta::system_t const> _system; /*!< Target system */
+  boost::dynamic_bitset<> _labels;                       /*!< Target labels */
+  boost::dynamic_bitset<> _wildcard_processes;           /*!< Wildcard processes */
+  boost::dynamic_bitset<> _wildcard_locations;           /*!< Wildcard locations */
+};
+
+} // end of namespace bwd_reach
+
+} // end of namespace algorithms
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_ALGORITHMS_BWD_REACH_TARGET_HH
@@ -0,0 +1,115 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_ZG_BWD_REACH_ALGORITHM_HH
+#define TCHECKER_ZG_BWD_REACH_ALGORITHM_HH
+
+#include <memory>
+#include <string>
+#include <tuple>
+
+#include "tchecker/algorithms/bwd_reach/algorithm.hh"
+#include "tchecker/algorithms/bwd_reach/stats.hh"
+#include "tchecker/algorithms/bwd_reach/target.hh"
+#include "tchecker/algorithms/reach/zg-reach.hh"
+#include "tchecker/parsing/declaration.hh"
+#include "tchecker/zg/state.hh"
+#include "tchecker/zg/zg.hh"
+
+/*!
+ \file zg-bwd-reach.hh
+ \brief Backward and bidirectional reachability algorithms over the zone graph
+ */
+
+namespace tchecker {
+
+namespace algorithms {
+
+namespace zg_bwd_reach {
+
+/*!
+ \class algorithm_t
+ \brief Backward reachability algorithm over the zone graph
+ \note the graph is a reachability graph over the zone graph (see
+ tchecker::algorithms::zg_reach::graph_t), with edges in forward direction
+*/
+class algorithm_t
+    : public tchecker::algorithms::bwd_reach::algorithm_t<tchecker::zg::zg_t, tchecker::algorithms::zg_reach::graph_t> {
+public:
+  using tchecker::algorithms::bwd_reach::algorithm_t<tchecker::zg::zg_t, tchecker::algorithms::zg_reach::graph_t>::algorithm_t;
+};
+
+/*!
+ \brief Check if a forward state and a backward state meet
+ \param fwd : a state of the forward zone graph
+ \param bwd : a state of the backward zone graph, over the target system
+ \param target : target of the backward exploration
+ \return true if fwd and bwd match w.r.t. target (see
+ tchecker::algorithms::bwd_reach::target_t::match) and have intersecting zones,
+ false otherwise
+ \note this is a sound check when the zone in fwd has been extrapolated w.r.t.
+ global M clock bounds, and the zone in bwd has not been extrapolated: backward
+ zones are unions of regions w.r.t. the same clock bounds
+ */
+bool meet(tchecker::zg::state_t const & fwd, tchecker::zg::state_t const & bwd,
+          tchecker::algorithms::bwd_reach::target_t const & target);
+
+/*!
+ \brief Run backward reachability algorithm on the zone graph of a system
+ \param sysdecl : system declaration
+ \param labels : comma-separated string of labels
+ \param search_order : search order
+ \param block_size : number of elements allocated in one block
+ \param table_size : size of hash tables
+ \pre labels must appear as node attributes in sysdecl
+ search_order must be either "dfs" or "bfs"
+ \return statistics on the run and a representation of the state-space
+ explored backward from the states that satisfy labels
+ \note zones are not extrapolated, which is not needed for termination of
+ backward reachability analysis of timed automata
+ \note the exploration starts from the final states of the target of labels
+ (see tchecker::algorithms::bwd_reach::target_t), hence the state-space is
+ a state-space of the target system, where wildcard processes may be in their
+ wildcard location
+ */
+std::tuple<tchecker::algorithms::bwd_reach::stats_t, std::shared_ptr<tchecker::algorithms::zg_reach::state_space_t>>
+run(tchecker::parsing::system_declaration_t const & sysdecl, std::string const & labels = "",
+    std::string const & search_order = "bfs", std::size_t block_size = 10000, std::size_t table_size = 65536);
+
+/*!
+ \brief Run bidirectional reachability algorithm on the zone graph of a system
+ \param sysdecl : system declaration
+ \param labels : comma-separated string of labels
+ \param search_order : search order
+ \param block_size : number of elements allocated in one block
+ \param table_size : size of hash tables
+ \pre labels must appear as node attributes in sysdecl
+ search_order must be either "dfs" or "bfs"
+ \return statistics on the run, a representation of the state-space explored
+ forward from the initial states, and a representation of the state-space
+ explored backward from the states that satisfy labels
+ \note forward and backward explorations alternate, one node at a time, until
+ the forward exploration reaches a state that satisfies labels, the backward
+ exploration reaches an initial state, a forward node meets a backward node
+ (see meet), or one of the explorations is complete
+ \note the forward exploration uses global M extrapolation (see meet)
+ \note the backward exploration starts from the final states of the target of
+ labels (see tchecker::algorithms::bwd_reach::target_t)
+ */
+std::tuple<tchecker::algorithms::bwd_reach::stats_t, std::shared_ptr<tchecker::algorithms::zg_reach::state_space_t>,
+           std::shared_ptr<tchecker::algorithms::zg_reach::state_space_t>>
+run_bidirectional(tchecker::parsing::system_declaration_t const & sysdecl, std::string const & labels = "",
+                  std::string const & search_order = "bfs", std::size_t block_size = 10000,
+                  std::size_t table_size = 65536);
+
+} // end of namespace zg_bwd_reach
+
+} // end of namespace algorithms
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_ZG_BWD_REACH_ALGORITHM_HH
@@ -16,6 +16,7 @@
 
 #include "tchecker/algorithms/couvreur_scc/graph.hh"
 #include "tchecker/algorithms/couvreur_scc/stats.hh"
+#include "tchecker/utils/progress.hh"
 
 /*!
  \file algorithm.hh
@@ -104,6 +105,7 @@ public:
    \param ts : a transition system
    \param graph : a graph
    \param labels : accepting labels
+   \param progress : progress counters (nullptr for no progress reporting)
    \post graph is built from a traversal of ts starting from its initial states,
    until a cycle that satisfies labels is reached (if any).
    A node is created for each reached state in ts, and an edge is created for
@@ -111,14 +113,19 @@ public:
    Initial nodes have been marked in graph
    \return statistics on the run
    \note if labels is empty, graph is the full state-space of ts
+   \note with progress, the numbers of visited and stored states, and the size
+   of the todo stack are published to progress every tchecker::PROGRESS_PERIOD
+   visited states
    */
-  tchecker::algorithms::couvscc::stats_t run(TS & ts, GRAPH & graph, boost::dynamic_bitset<> const & labels)
+  tchecker::algorithms::couvscc::stats_t run(TS & ts, GRAPH & graph, boost::dynamic_bitset<> const & labels,
+                                             tchecker::progress_t * progress = nullptr)
   {
     tchecker::algorithms::couvscc::stats_t stats;
 
     stats.set_start_time();
 
     _count = 0;
+    _progress = progress;
 
     std::vector<typename TS::sst_t> sst;
     ts.initial(sst);
@@ -132,6 +139,9 @@ public:
 
     stats.stored_states() = graph.nodes_count();
 
+    if (_progress != nullptr)
+      _progress->publish(stats.visited_states(), stats.stored_states(), 0, 0);
+
     empty_stacks();
 
     stats.set_end_time();
@@ -225,7 +235,8 @@ private:
    \param stats : statistics
    \post n has been expanded into graph, its flags (current and dfsnum) have
    been set, and n has been pushed to the stacks todo, roots and active
-   a visited node has been added to stats
+   a visited node has been added to stats, and progress has been published
+   every tchecker::PROGRESS_PERIOD visited nodes
    */
   void push(node_sptr_t & n, TS & ts, GRAPH & graph, tchecker::algorithms::couvscc::stats_t & stats)
   {
@@ -236,6 +247,8 @@ private:
     _roots.push(roots_stack_entry_t{n, ts.labels(n->state_ptr())});
     _active.push(n);
     ++stats.visited_states();
+    if ((_progress != nullptr) && (stats.visited_states() % tchecker::PROGRESS_PERIOD == 0))
+      _progress->publish(stats.visited_states(), graph.nodes_count(), _todo.size(), 0);
   }
 
   /*!
@@ -314,6 +327,7 @@ private:
   std::stack<todo_stack_entry_t> _todo;   /*!< todo stack */
   std::stack<roots_stack_entry_t> _roots; /*!< roots stack */
   std::stack<node_sptr_t> _active;        /*!< active stack */
+  tchecker::progress_t * _progress;       /*!< Progress counters (nullptr if none) */
 };
 
 /*!
@@ -392,6 +406,7 @@ public:
    \param ts : a transition system
    \param graph : a graph
    \param labels : accepting labels
+   \param progress : progress counters (nullptr for no progress reporting)
    \pre labels is a single accepting condition
    \post graph is built from a traversal of ts starting from its initial states,
    until a cycle that satisfies labels is reached (if any).
@@ -401,8 +416,12 @@ public:
    \return statistics on the run
    \throw std::invalid_argument : if labels is not a single accepting label
    \note if labels is empty, graph is the full state-space of ts
+   \note with progress, the numbers of visited and stored states, and the size
+   of the todo stack are published to progress every tchecker::PROGRESS_PERIOD
+   visited states
    */
-  tchecker::algorithms::couvscc::stats_t run(TS & ts, GRAPH & graph, boost::dynamic_bitset<> const & labels)
+  tchecker::algorithms::couvscc::stats_t run(TS & ts, GRAPH & graph, boost::dynamic_bitset<> const & labels,
+                                             tchecker::progress_t * progress = nullptr)
   {
     if (labels.count() > 1)
       throw std::invalid_argument("*** tchecker::algorithms::couvscc::single_algorithm_t: single accepting condition required");
@@ -412,6 +431,7 @@ public:
     stats.set_start_time();
 
     _count = 0;
+    _progress = progress;
 
     std::vector<typename TS::sst_t> sst;
     ts.initial(sst);
@@ -426,6 +446,9 @@ public:
 
     stats.stored_states() = graph.nodes_count();
 
+    if (_progress != nullptr)
+      _progress->publish(stats.visited_states(), stats.stored_states(), 0, 0);
+
     empty_stacks();
 
     stats.set_end_time();
@@ -518,7 +541,8 @@ private:
    \param stats : statistics
    \post n has been expanded into graph, its flags (current and dfsnum) have
    been set, and n has been pushed to the stacks todo, roots and active
-   a visited node has been added to stats
+   a visited node has been added to stats, and progress has been published
+   every tchecker::PROGRESS_PERIOD visited nodes
    */
   void push(node_sptr_t & n, TS & ts, GRAPH & graph, boost::dynamic_bitset<> const & labels,
             tchecker::algorithms::couvscc::stats_t & stats)
@@ -530,6 +554,8 @@ private:
     _roots.push(roots_stack_entry_t{n});
     _active.push(n);
     ++stats.visited_states();
+    if ((_progress != nullptr) && (stats.visited_states() % tchecker::PROGRESS_PERIOD == 0))
+      _progress->publish(stats.visited_states(), graph.nodes_count(), _todo.size(), 0);
   }
 
   /*!
@@ -623,6 +649,7 @@ private:
   std::stack<todo_stack_entry_t> _todo;   /*!< todo stack */
   std::stack<roots_stack_entry_t> _roots; /*!< roots stack */
   std::stack<node_sptr_t> _active;        /*!< active stack */
+  tchecker::progress_t * _progress;       /*!< Progress counters (nullptr if none) */
 };
 
 } // namespace couvscc
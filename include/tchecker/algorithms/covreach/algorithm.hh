@@ -14,11 +14,14 @@
  */
 
 #include <iterator>
+#include <type_traits>
 #include <vector>
 
 #include <boost/dynamic_bitset.hpp>
 
 #include "tchecker/algorithms/covreach/stats.hh"
+#include "tchecker/algorithms/properties.hh"
+#include "tchecker/graph/node.hh"
 #include "tchecker/graph/subsumption_graph.hh"
 #include "tchecker/waiting/factory.hh"
 
@@ -44,7 +47,8 @@ enum covering_t {
  \tparam GRAPH : type of graph, should derive from
  tchecker::graph::subsumption::graph_t, and nodes of type GRAPH::shared_node_t
  should have a method state_ptr() that yields a pointer to the corresponding
- state in TS.
+ state in TS. Nodes that derive from tchecker::graph::node_rank_t are ranked
+ (see remove_covered_nodes), other nodes carry no rank
  \note For correctness of the algorithm, the covering relation over nodes in GRAPH
  should be a trace inclusion, and it should be irreflexive: a node should not
  cover itself
@@ -53,6 +57,11 @@ template <class TS, class GRAPH> class algorithm_t {
 public:
   using node_sptr_t = typename GRAPH::node_sptr_t;
 
+  /*!
+   \brief Flag: true if nodes in GRAPH are ranked, false otherwise
+   */
+  static constexpr bool ranked_nodes = std::is_base_of_v<tchecker::graph::node_rank_t, typename GRAPH::node_t>;
+
   /*!
    \brief Build a covering reachability graph of a transition system from its
    initial states
@@ -78,49 +87,147 @@ public:
                                               enum tchecker::waiting::policy_t policy)
   {
     std::unique_ptr<tchecker::waiting::waiting_t<node_sptr_t>> waiting{tchecker::waiting::factory<node_sptr_t>(policy)};
+    return run<COVERING>(ts, graph, labels, *waiting);
+  }
+
+  /*!
+   \brief Build a covering reachability graph of a transition system from its
+   initial states, checking several properties at once
+   \tparam COVERING : type of covering (see above)
+   \param ts : a transition system
+   \param graph : a graph
+   \param properties : sets of accepting labels
+   \param policy : waiting list policy
+   \post graph is a covering reachability graph of ts built from its initial
+   states, until all properties have been reached, or until the entire
+   state-space has been exhausted. Properties that have been reached are marked
+   in properties
+   \return Statistics on the run, reachable is true if some property has been
+   reached
+   \note the graph is built in a single traversal of ts, whatever the number of
+   properties
+  */
+  template <enum tchecker::algorithms::covreach::covering_t COVERING = tchecker::algorithms::covreach::COVERING_FULL>
+  tchecker::algorithms::covreach::stats_t run(TS & ts, GRAPH & graph, tchecker::algorithms::properties_t & properties,
+                                              enum tchecker::waiting::policy_t policy)
+  {
+    std::unique_ptr<tchecker::waiting::waiting_t<node_sptr_t>> waiting{tchecker::waiting::factory<node_sptr_t>(policy)};
+    return run<COVERING>(ts, graph, properties, *waiting);
+  }
+
+  /*!
+   \brief Build a covering reachability graph of a transition system from its
+   initial states, using a given waiting container
+   \tparam COVERING : type of covering. Set to COVERING_LEAF_NODES to cover only
+   non-maximal leaf nodes. Set to COVERING_FULL to cover all non-maximal nodes.
+   \param ts : a transition system
+   \param graph : a graph
+   \param labels : accepting labels
+   \param waiting : an empty waiting container
+   \pre waiting supports fast removal of elements if COVERING is COVERING_FULL
+   (see tchecker::waiting::fast_remove_waiting_t)
+   \post same as the run method above, the order in which the nodes of ts are
+   visited depends on waiting. waiting is empty
+   \return Statistics on the run
+   \note if labels is empty, the algorithm explores the entire state-space
+  */
+  template <enum tchecker::algorithms::covreach::covering_t COVERING = tchecker::algorithms::covreach::COVERING_FULL>
+  tchecker::algorithms::covreach::stats_t run(TS & ts, GRAPH & graph, boost::dynamic_bitset<> const & labels,
+                                              tchecker::waiting::waiting_t<node_sptr_t> & waiting)
+  {
+    tchecker::algorithms::properties_t properties{labels};
+    return run<COVERING>(ts, graph, properties, waiting);
+  }
+
+  /*!
+   \brief Build a covering reachability graph of a transition system from its
+   initial states, checking several properties at once, using a given waiting
+   container
+   \tparam COVERING : type of covering (see above)
+   \param ts : a transition system
+   \param graph : a graph
+   \param properties : sets of accepting labels
+   \param waiting : an empty waiting container
+   \pre waiting supports fast removal of elements if COVERING is COVERING_FULL
+   (see tchecker::waiting::fast_remove_waiting_t)
+   \post same as the run method with properties and a policy, the order in which
+   the nodes of ts are visited depends on waiting. waiting is empty
+   \return Statistics on the run
+  */
+  template <enum tchecker::algorithms::covreach::covering_t COVERING = tchecker::algorithms::covreach::COVERING_FULL>
+  tchecker::algorithms::covreach::stats_t run(TS & ts, GRAPH & graph, tchecker::algorithms::properties_t & properties,
+                                              tchecker::waiting::waiting_t<node_sptr_t> & waiting)
+  {
     tchecker::algorithms::covreach::stats_t stats;
+    run<COVERING>(ts, graph, properties, waiting, stats);
+    return stats;
+  }
+
+  /*!
+   \brief Build a covering reachability graph of a transition system from its
+   initial states, checking several properties at once, using a given waiting
+   container and given statistics
+   \tparam COVERING : type of covering (see above)
+   \param ts : a transition system
+   \param graph : a graph
+   \param properties : sets of accepting labels
+   \param waiting : an empty waiting container
+   \param stats : statistics
+   \pre waiting supports fast removal of elements if COVERING is COVERING_FULL
+   (see tchecker::waiting::fast_remove_waiting_t)
+   \post same as the run method above, statistics on the run have been stored
+   in stats
+   \note this allows to observe the statistics of a run while it is running
+   (e.g. from waiting)
+  */
+  template <enum tchecker::algorithms::covreach::covering_t COVERING = tchecker::algorithms::covreach::COVERING_FULL>
+  void run(TS & ts, GRAPH & graph, tchecker::algorithms::properties_t & properties,
+           tchecker::waiting::waiting_t<node_sptr_t> & waiting, tchecker::algorithms::covreach::stats_t & stats)
+  {
     std::vector<node_sptr_t> nodes, covered_nodes;
 
     stats.set_start_time();
 
     expand_initial_nodes(ts, graph, nodes, stats);
     for (node_sptr_t const & n : nodes)
-      waiting->insert(n);
+      waiting.insert(n);
     nodes.clear();
 
-    while (!waiting->empty()) {
-      node_sptr_t node = waiting->first();
-      waiting->remove_first();
+    while (!waiting.empty()) {
+      node_sptr_t node = waiting.first();
+      waiting.remove_first();
 
       ++stats.visited_states();
+      if constexpr (ranked_nodes)
+        node->expanded(true);
 
-      if (accepting(node, ts, labels)) {
+      if (accepting(node, ts, properties)) {
         node->final(true);
         stats.reachable() = true;
-        break;
+        if (properties.resolved())
+          break;
       }
 
       expand_next_nodes(node, ts, graph, nodes, stats);
 
+      // the rank of next_node is set when removing covered nodes, before next_node is inserted
       for (node_sptr_t const & next_node : nodes) {
-        waiting->insert(next_node);
         if constexpr (COVERING == tchecker::algorithms::covreach::COVERING_FULL) {
           remove_covered_nodes(graph, next_node, covered_nodes, stats);
           for (node_sptr_t const & covered_node : covered_nodes)
-            waiting->remove(covered_node);
+            waiting.remove(covered_node);
           covered_nodes.clear();
         }
+        waiting.insert(next_node);
       }
       nodes.clear();
     }
 
-    waiting->clear();
+    waiting.clear();
 
     stats.stored_states() = graph.nodes_count();
 
     stats.set_end_time();
-
-    return stats;
   }
 
   /*!
@@ -199,7 +306,10 @@ public:
    graph and added to covered_nodes.
    All incoming edges to covered nodes have been transformed into incoming
    subsumption edges of node.
-   Removed nodes have been counted in stats
+   If nodes are ranked, the rank of node is greater than the rank of every
+   covered node that has already been expanded.
+   Removed nodes have been counted in stats, as well as removed nodes that have
+   already been expanded if nodes are ranked
   */
   void remove_covered_nodes(GRAPH & graph, typename GRAPH::node_sptr_t const & node,
                             std::vector<typename GRAPH::node_sptr_t> & covered_nodes,
@@ -214,6 +324,13 @@ public:
       graph.remove_edges(covered_node);
       graph.remove_node(covered_node);
       ++stats.covered_states();
+      if constexpr (ranked_nodes) {
+        if (covered_node->expanded()) {
+          ++stats.covered_expanded_states();
+          if (covered_node->rank() >= node->rank())
+            node->rank(covered_node->rank() + 1);
+        }
+      }
     }
   }
 
@@ -221,13 +338,21 @@ public:
    \brief Check if a node is accepting
    \param n : a node
    \param ts : a transition system
-   \param labels : a set of labels
-   \return true if labels is not empty, and the set of labels in n contain
-   labels, and n is a valid final state in ts, false otherwise
+   \param properties : sets of labels
+   \return true if the set of labels in n contains some non-empty property that
+   has not been reached yet, and n is a valid final state in ts, false otherwise
+   \post all the properties satisfied by n have been marked reached if n is
+   accepting
    */
-  bool accepting(node_sptr_t const & n, TS & ts, boost::dynamic_bitset<> const & labels)
+  bool accepting(node_sptr_t const & n, TS & ts, tchecker::algorithms::properties_t & properties)
   {
-    return !labels.none() && labels.is_subset_of(ts.labels(n->state_ptr())) && ts.is_valid_final(n->state_ptr());
+    if (!properties.pending())
+      return false;
+    boost::dynamic_bitset<> labels = ts.labels(n->state_ptr());
+    if (!properties.match(labels) || !ts.is_valid_final(n->state_ptr()))
+      return false;
+    properties.mark(labels);
+    return true;
   }
 };
 
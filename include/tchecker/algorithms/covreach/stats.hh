@@ -71,6 +71,19 @@ public:
    */
   unsigned long covered_states() const;
 
+  /*!
+   \brief Accessor
+   \return A reference to the number of covered states that had already been
+   expanded
+   */
+  unsigned long & covered_expanded_states();
+
+  /*!
+   \brief Accessor
+   \return the number of covered states that had already been expanded
+   */
+  unsigned long covered_expanded_states() const;
+
   /*!
    \brief Accessor
    \return A reference to the number of stored states
@@ -103,11 +116,12 @@ public:
   void attributes(std::map<std::string, std::string> & m) const;
 
 private:
-  unsigned long _visited_states;      /*!< Number of visited states */
-  unsigned long _visited_transitions; /*!< Number of visited transitions */
-  unsigned long _covered_states;      /*!< Number of covered states */
-  unsigned long _stored_states;       /*!< Number of stored states */
-  bool _reachable;                    /*!< Reachability of satisfying state */
+  unsigned long _visited_states;          /*!< Number of visited states */
+  unsigned long _visited_transitions;     /*!< Number of visited transitions */
+  unsigned long _covered_states;          /*!< Number of covered states */
+  unsigned long _covered_expanded_states; /*!< Number of covered states that had already been expanded */
+  unsigned long _stored_states;           /*!< Number of stored states */
+  bool _reachable;                        /*!< Reachability of satisfying state */
 };
 
 } // end of namespace covreach
@@ -14,11 +14,14 @@
 */
 
 #include "tchecker/algorithms/covreach/algorithm.hh"
+#include "tchecker/algorithms/properties.hh"
 #include "tchecker/graph/edge.hh"
 #include "tchecker/graph/node.hh"
 #include "tchecker/graph/subsumption_graph.hh"
 #include "tchecker/syncprod/vedge.hh"
 #include "tchecker/ts/state_space.hh"
+#include "tchecker/utils/memory_budget.hh"
+#include "tchecker/utils/progress.hh"
 #include "tchecker/utils/shared_objects.hh"
 #include "tchecker/waiting/waiting.hh"
 #include "tchecker/zg/path.hh"
@@ -38,6 +41,7 @@ namespace zg_covreach {
  */
 class node_t : public tchecker::waiting::element_t,
                public tchecker::graph::node_flags_t,
+               public tchecker::graph::node_rank_t,
                public tchecker::graph::node_zg_state_t {
 public:
   /*!
@@ -180,6 +184,16 @@ private:
 */
 std::ostream & dot_output(std::ostream & os, tchecker::algorithms::zg_covreach::graph_t const & g, std::string const & name);
 
+/*!
+ \brief Graph output in binary format
+ \param os : output stream
+ \param g : graph
+ \param name : graph name
+ \post graph g with name has been output to os in binary format (see
+ tchecker::graph::binary)
+*/
+std::ostream & binary_output(std::ostream & os, tchecker::algorithms::zg_covreach::graph_t const & g, std::string const & name);
+
 /*!
  \class state_space_t
  \brief State-space representation consisting of a zone graph and a subsumption graph
@@ -287,7 +301,7 @@ public:
  \param block_size : number of elements allocated in one block
  \param table_size : size of hash tables
  \pre labels must appear as node attributes in sysdecl
- search_order must be either "dfs" or "bfs"
+ search_order must be either "dfs", "bfs" or "ranking"
  \return statistics on the run and a representation of the state-space as a subsumption graph
  \throw std::runtime_error : if clock bounds cannot be computed for the system modeled by sysdecl
  */
@@ -297,6 +311,53 @@ run(tchecker::parsing::system_declaration_t const & sysdecl, std::string const &
     tchecker::algorithms::covreach::covering_t covering = tchecker::algorithms::covreach::COVERING_FULL,
     std::size_t block_size = 10000, std::size_t table_size = 65536);
 
+/*!
+ \brief Run covering reachability algorithm on the zone graph of a system,
+ checking several properties in a single exploration
+ \param sysdecl : system declaration
+ \param labels : properties, each property is a comma-separated string of labels
+ \param search_order : search order
+ \param covering : covering policy
+ \param block_size : number of elements allocated in one block
+ \param table_size : size of hash tables
+ \param spill_directory : directory where zones and valuations of bounded
+ integer variables are spilled (empty to keep them in memory)
+ \param huge_pages : huge pages mode of states and of the graph
+ \param incremental_gc : collect unused states, nodes and edges incrementally
+ during the run
+ \param budget : memory budget (nullptr if unlimited)
+ \param progress : progress counters (nullptr for no progress reporting)
+ \pre all labels must appear as node attributes in sysdecl
+ search_order must be either "dfs", "bfs" or "ranking"
+ \return statistics on the run, reachability of each property in labels, and a
+ representation of the state-space as a subsumption graph
+ \throw std::runtime_error : if clock bounds cannot be computed for the system modeled by sysdecl
+ \throw std::invalid_argument : if spill_directory is not a directory
+ \note see tchecker::zg::zg_t::spill and tchecker::zg::zg_t::huge_pages
+ \note with incremental_gc, time-bounded slices of garbage collection are run
+ between the iterations of the algorithm (see tchecker::waiting::collecting_t).
+ This keeps memory proportional to the nodes in the graph, while covered nodes
+ are removed
+ \note with a budget, the memory used by the zone graph and the subsumption
+ graph is checked between the iterations of the algorithm (see
+ tchecker::waiting::budgeted_t). The graph stops storing edges when budget
+ degrades, and the algorithm stops when budget is exceeded: properties that
+ have not been reached yet are then unknown
+ \note with progress, the numbers of visited, stored, waiting and covered
+ states are published to progress between the iterations of the algorithm
+ (see tchecker::waiting::reporting_t)
+ \note search order "ranking" explores first the nodes with highest rank (see
+ tchecker::graph::node_rank_t), in breadth-first order for nodes with same rank
+ */
+std::tuple<tchecker::algorithms::covreach::stats_t, tchecker::algorithms::properties_t,
+           std::shared_ptr<tchecker::algorithms::zg_covreach::state_space_t>>
+run(tchecker::parsing::system_declaration_t const & sysdecl, std::vector<std::string> const & labels,
+    std::string const & search_order = "bfs",
+    tchecker::algorithms::covreach::covering_t covering = tchecker::algorithms::covreach::COVERING_FULL,
+    std::size_t block_size = 10000, std::size_t table_size = 65536,
+    std::string const & spill_directory = "", enum tchecker::huge_pages_t huge_pages = tchecker::HUGE_PAGES_NONE,
+    bool incremental_gc = false, tchecker::memory_budget_t * budget = nullptr, tchecker::progress_t * progress = nullptr);
+
 } // end of namespace zg_covreach
 
 } // end of namespace algorithms
@@ -0,0 +1,112 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_ALGORITHMS_HEURISTICS_HH
+#define TCHECKER_ALGORITHMS_HEURISTICS_HH
+
+#include <cstdint>
+#include <vector>
+
+#include "tchecker/algorithms/properties.hh"
+#include "tchecker/basictypes.hh"
+#include "tchecker/syncprod/system.hh"
+#include "tchecker/syncprod/vloc.hh"
+#include "tchecker/waiting/guided.hh"
+
+/*!
+ \file heuristics.hh
+ \brief Heuristics for guided search
+ */
+
+namespace tchecker {
+
+namespace algorithms {
+
+/*!
+ \class location_distance_t
+ \brief Distance heuristic to unreached properties, computed from the location
+ graphs of the processes
+ \note For each location and each label in the properties, the distance is the
+ length of a shortest path in the graph of the process of the location, to a
+ location with that label. Guards, invariants and synchronizations are ignored.
+ The heuristic value of a tuple of locations is the minimum, over the pending
+ properties, of the maximum, over the labels of the property, of the minimum
+ distance over the locations in the tuple. Since each transition moves each
+ process along at most one edge, this is a lower bound on the number of
+ transitions to a state that satisfies an unreached property
+ */
+class location_distance_t {
+public:
+  /*!
+   \brief Constructor
+   \param system : a system
+   \param properties : properties
+   \post the distances from every location of system to every label in
+   properties have been computed
+   \note this keeps a reference on properties, hence properties that become
+   reachable are not considered anymore by the heuristic
+   */
+  location_distance_t(tchecker::syncprod::system_t const & system, tchecker::algorithms::properties_t const & properties);
+
+  /*!
+   \brief Copy constructor
+   */
+  location_distance_t(tchecker::algorithms::location_distance_t const &) = default;
+
+  /*!
+   \brief Move constructor
+   */
+  location_distance_t(tchecker::algorithms::location_distance_t &&) = default;
+
+  /*!
+   \brief Destructor
+   */
+  ~location_distance_t() = default;
+
+  /*!
+   \brief Assignment operator (deleted)
+   */
+  tchecker::algorithms::location_distance_t & operator=(tchecker::algorithms::location_distance_t const &) = delete;
+
+  /*!
+   \brief Move-assignment operator (deleted)
+   */
+  tchecker::algorithms::location_distance_t & operator=(tchecker::algorithms::location_distance_t &&) = delete;
+
+  /*!
+   \brief Heuristic value
+   \param vloc : tuple of locations
+   \return lower bound on the number of transitions from vloc to a tuple of
+   locations that satisfies a pending property,
+   tchecker::waiting::INFINITE_HEURISTIC if no pending property can be satisfied
+   from vloc, 0 if there is no pending property
+   */
+  std::uint32_t operator()(tchecker::vloc_t const & vloc) const;
+
+  /*!
+   \brief Accessor
+   \param loc : location identifier
+   \param label : label identifier
+   \return distance from loc to a location with label,
+   tchecker::waiting::INFINITE_HEURISTIC if there is no such location reachable
+   from loc, or if label does not appear in the properties
+   */
+  std::uint32_t distance(tchecker::loc_id_t loc, tchecker::label_id_t label) const;
+
+private:
+  tchecker::algorithms::properties_t const & _properties; /*!< Properties */
+  std::size_t _labels_count;                              /*!< Number of labels in the system */
+  std::vector<std::size_t> _label_index;                  /*!< Map : label ID -> index in _distances (or _labels_count) */
+  std::size_t _indexed_labels;                            /*!< Number of labels in properties */
+  std::vector<std::uint32_t> _distances;                  /*!< Distances, location-major */
+};
+
+} // end of namespace algorithms
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_ALGORITHMS_HEURISTICS_HH
@@ -18,6 +18,7 @@
 
 #include "tchecker/algorithms/ndfs/graph.hh"
 #include "tchecker/algorithms/ndfs/stats.hh"
+#include "tchecker/utils/progress.hh"
 
 /*!
  \file algorithm.hh
@@ -100,19 +101,26 @@ public:
    \param ts : a transition system
    \param graph : a graph
    \param labels : accepting labels
+   \param progress : progress counters (nullptr for no progress reporting)
    \post graph is built from a traversal of ts starting from its initial states,
    until a cycle that satisfies labels is reached (if any).
    A node is created for each reached state in ts, and an edge is created for
    each transition in ts.
    \return statistics on the run
    \note if labels is empty, graph is the full state-space of ts
+   \note with progress, the numbers of visited and stored states, and the number
+   of nodes on the DFS stacks are published to progress every
+   tchecker::PROGRESS_PERIOD visited states
    */
-  tchecker::algorithms::ndfs::stats_t run(TS & ts, GRAPH & graph, boost::dynamic_bitset<> const & labels)
+  tchecker::algorithms::ndfs::stats_t run(TS & ts, GRAPH & graph, boost::dynamic_bitset<> const & labels,
+                                          tchecker::progress_t * progress = nullptr)
   {
     tchecker::algorithms::ndfs::stats_t stats;
 
     stats.set_start_time();
 
+    _progress = progress;
+
     std::vector<typename TS::sst_t> sst;
     ts.initial(sst);
     for (auto && [status, s, t] : sst) {
@@ -127,6 +135,9 @@ public:
 
     stats.stored_states() = graph.nodes_count();
 
+    if (_progress != nullptr)
+      _progress->publish(stats.visited_states(), stats.stored_states(), 0, 0);
+
     stats.set_end_time();
 
     return stats;
@@ -196,6 +207,7 @@ private:
     n->color() = tchecker::algorithms::ndfs::CYAN;
     stack.push(blue_stack_entry_t{n, expand_node(ts, graph, n, labels), true});
     ++stats.visited_states_blue();
+    publish_progress(graph, stats, stack.size());
 
     while (!stack.empty()) {
       auto && [s, succ, allred] = stack.top();
@@ -203,7 +215,7 @@ private:
         if (allred)
           s->color() = tchecker::algorithms::ndfs::RED;
         else if (s->final()) {
-          dfs_red(ts, graph, labels, stats, s);
+          dfs_red(ts, graph, labels, stats, s, stack.size());
           s->color() = tchecker::algorithms::ndfs::RED;
         }
         else
@@ -224,6 +236,7 @@ private:
           t->color() = tchecker::algorithms::ndfs::CYAN;
           stack.push(blue_stack_entry_t{t, expand_node(ts, graph, t, labels), true});
           ++stats.visited_states_blue();
+          publish_progress(graph, stats, stack.size());
         }
         else if (t->color() != tchecker::algorithms::ndfs::RED)
           allred = false;
@@ -292,14 +305,16 @@ private:
    \param labels : accepting labels
    \param stats : statistics
    \param n : node
+   \param blue_depth : size of the blue DFS stack
   */
   void dfs_red(TS & ts, GRAPH & graph, boost::dynamic_bitset<> const & labels, tchecker::algorithms::ndfs::stats_t & stats,
-               node_sptr_t & n)
+               node_sptr_t & n, std::size_t blue_depth)
   {
     std::stack<red_stack_entry_t> stack;
 
     stack.push(red_stack_entry_t{n, graph.outgoing_edges(n)});
     ++stats.visited_states_red();
+    publish_progress(graph, stats, blue_depth + stack.size());
 
     while (!stack.empty()) {
       red_stack_entry_t & top = stack.top();
@@ -316,10 +331,28 @@ private:
           t->color() = tchecker::algorithms::ndfs::RED;
           stack.push(red_stack_entry_t{t, graph.outgoing_edges(t)});
           ++stats.visited_states_red();
+          publish_progress(graph, stats, blue_depth + stack.size());
         }
       }
     }
   }
+
+  /*!
+   \brief Publish progress
+   \param graph : a graph
+   \param stats : statistics
+   \param waiting : number of nodes on the DFS stacks
+   \post the numbers of visited and stored states, and waiting have been
+   published to the progress counters if any, and if the number of visited
+   states is a multiple of tchecker::PROGRESS_PERIOD
+   */
+  void publish_progress(GRAPH const & graph, tchecker::algorithms::ndfs::stats_t const & stats, std::size_t waiting)
+  {
+    if ((_progress != nullptr) && (stats.visited_states() % tchecker::PROGRESS_PERIOD == 0))
+      _progress->publish(stats.visited_states(), graph.nodes_count(), waiting, 0);
+  }
+
+  tchecker::progress_t * _progress{nullptr}; /*!< Progress counters (nullptr if none) */
 };
 
 } // namespace ndfs
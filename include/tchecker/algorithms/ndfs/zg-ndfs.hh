@@ -22,6 +22,7 @@
 #include "tchecker/parsing/declaration.hh"
 #include "tchecker/syncprod/vedge.hh"
 #include "tchecker/ts/state_space.hh"
+#include "tchecker/utils/progress.hh"
 #include "tchecker/utils/shared_objects.hh"
 #include "tchecker/zg/path.hh"
 #include "tchecker/zg/state.hh"
@@ -176,6 +177,16 @@ private:
 */
 std::ostream & dot_output(std::ostream & os, tchecker::algorithms::zg_ndfs::graph_t const & g, std::string const & name);
 
+/*!
+ \brief Graph output in binary format
+ \param os : output stream
+ \param g : graph
+ \param name : graph name
+ \post graph g with name has been output to os in binary format (see
+ tchecker::graph::binary)
+*/
+std::ostream & binary_output(std::ostream & os, tchecker::algorithms::zg_ndfs::graph_t const & g, std::string const & name);
+
 /*!
  \class state_space_t
  \brief State-space representation consisting of a zone graph and a reachability graph
@@ -254,13 +265,14 @@ public:
  \param labels : comma-separated string of labels
  \param block_size : number of elements allocated in one block
  \param table_size : size of hash tables
+ \param progress : progress counters (nullptr for no progress reporting)
  \pre labels must appear as node attributes in sysdecl
  \return statistics on the run and the liveness graph
  \throw std::runtime_error : if clock bounds cannot be computed for the system modeled by sysdecl
  */
 std::tuple<tchecker::algorithms::ndfs::stats_t, std::shared_ptr<tchecker::algorithms::zg_ndfs::state_space_t>>
 run(tchecker::parsing::system_declaration_t const & sysdecl, std::string const & labels = "", std::size_t block_size = 10000,
-    std::size_t table_size = 65536);
+    std::size_t table_size = 65536, tchecker::progress_t * progress = nullptr);
 
 } // namespace zg_ndfs
 
@@ -0,0 +1,149 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_ALGORITHMS_PROPERTIES_HH
+#define TCHECKER_ALGORITHMS_PROPERTIES_HH
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <boost/dynamic_bitset.hpp>
+
+/*!
+ \file properties.hh
+ \brief Sets of reachability properties checked in a single exploration
+ */
+
+namespace tchecker {
+
+namespace algorithms {
+
+/*!
+ \class properties_t
+ \brief Sets of reachability properties, each property being a set of labels
+ that shall be reached simultaneously
+ */
+class properties_t {
+public:
+  /*!
+   \brief Constructor
+   \post this is an empty set of properties
+   */
+  properties_t() = default;
+
+  /*!
+   \brief Constructor
+   \param labels : set of labels
+   \post this consists of the single property labels
+   */
+  explicit properties_t(boost::dynamic_bitset<> const & labels);
+
+  /*!
+   \brief Add a property
+   \param name : name of property
+   \param labels : set of labels
+   \post property labels with name has been added to this set of properties, it
+   is not reachable
+   */
+  void add(std::string const & name, boost::dynamic_bitset<> const & labels);
+
+  /*!
+   \brief Accessor
+   \return number of properties
+   */
+  inline std::size_t size() const { return _labels.size(); }
+
+  /*!
+   \brief Accessor
+   \param i : index of property
+   \pre i < size()
+   \return name of i-th property
+   */
+  inline std::string const & name(std::size_t i) const { return _names[i]; }
+
+  /*!
+   \brief Accessor
+   \param i : index of property
+   \pre i < size()
+   \return set of labels of i-th property
+   */
+  inline boost::dynamic_bitset<> const & labels(std::size_t i) const { return _labels[i]; }
+
+  /*!
+   \brief Accessor
+   \param i : index of property
+   \pre i < size()
+   \return true if i-th property has been reached, false otherwise
+   */
+  inline bool reachable(std::size_t i) const { return _reachable[i]; }
+
+  /*!
+   \brief Accessor
+   \return true if some property has been reached, false otherwise
+   */
+  inline bool some_reachable() const { return _reachable_count > 0; }
+
+  /*!
+   \brief Accessor
+   \return true if some property with a non-empty set of labels has not been
+   reached yet, false otherwise
+   */
+  inline bool pending() const { return _pending_count > 0; }
+
+  /*!
+   \brief Accessor
+   \return true if some property has been reached and all properties with a
+   non-empty set of labels have been reached, false otherwise
+   \note an empty set of labels is never reached. Hence, a set of properties
+   that only contains empty sets of labels is never resolved
+   */
+  inline bool resolved() const { return _pending_count == 0 && _reachable_count > 0; }
+
+  /*!
+   \brief Check if a set of labels satisfies some unreached property
+   \param labels : set of labels
+   \return true if there is a property that has not been reached yet, and which
+   is a non-empty subset of labels, false otherwise
+   */
+  bool match(boost::dynamic_bitset<> const & labels) const;
+
+  /*!
+   \brief Mark properties as reached
+   \param labels : set of labels
+   \post all properties that are non-empty subsets of labels have been marked
+   reachable
+   */
+  void mark(boost::dynamic_bitset<> const & labels);
+
+  /*!
+   \brief Clear reachability
+   \post no property is reachable
+   */
+  void reset();
+
+  /*!
+   \brief Extract reachability of properties as attributes (key, value)
+   \param m : attributes map
+   \post for each property i, the name and the reachability of i have been added
+   to m with keys PROPERTY_i_LABELS and PROPERTY_i_REACHABLE
+   */
+  void attributes(std::map<std::string, std::string> & m) const;
+
+private:
+  std::vector<std::string> _names;              /*!< Names of properties */
+  std::vector<boost::dynamic_bitset<>> _labels; /*!< Sets of labels of properties */
+  std::vector<bool> _reachable;                 /*!< Reachability of properties */
+  std::size_t _reachable_count{0};              /*!< Number of reachable properties */
+  std::size_t _pending_count{0};                /*!< Number of non-empty properties not reached yet */
+};
+
+} // end of namespace algorithms
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_ALGORITHMS_PROPERTIES_HH
@@ -12,6 +12,7 @@
 
 #include <boost/dynamic_bitset.hpp>
 
+#include "tchecker/algorithms/properties.hh"
 #include "tchecker/algorithms/reach/stats.hh"
 #include "tchecker/basictypes.hh"
 #include "tchecker/waiting/factory.hh"
@@ -58,6 +59,30 @@ public:
    */
   tchecker::algorithms::reach::stats_t run(TS & ts, GRAPH & graph, boost::dynamic_bitset<> const & labels,
                                            enum tchecker::waiting::policy_t policy)
+  {
+    tchecker::algorithms::properties_t properties{labels};
+    return run(ts, graph, properties, policy);
+  }
+
+  /*!
+   \brief Build a reachability graph of a transition system from its initial
+   states, checking several properties at once
+   \param ts : a transition system
+   \param graph : a graph
+   \param properties : sets of accepting labels
+   \param policy : waiting list policy
+   \post graph is built from a traversal of ts starting from its initial states,
+   until all properties have been reached (if ever). Properties that have been
+   reached are marked in properties. Nodes that satisfy some property when it is
+   first reached are final.
+   The order in which the nodes of ts are visited depends on policy.
+   \return statistics on the run, reachable is true if some property has been
+   reached
+   \note the graph is built in a single traversal of ts, whatever the number of
+   properties
+   */
+  tchecker::algorithms::reach::stats_t run(TS & ts, GRAPH & graph, tchecker::algorithms::properties_t & properties,
+                                           enum tchecker::waiting::policy_t policy)
   {
     std::unique_ptr<tchecker::waiting::waiting_t<node_sptr_t>> waiting{tchecker::waiting::factory<node_sptr_t>(policy)};
 
@@ -65,16 +90,9 @@ public:
 
     stats.set_start_time();
 
-    std::vector<typename TS::sst_t> sst;
-    ts.initial(sst);
-    for (auto && [status, s, t] : sst) {
-      auto && [is_new_node, initial_node] = graph.add_node(s);
-      initial_node->initial(true);
-      if (is_new_node)
-        waiting->insert(initial_node);
-    }
+    insert_initial_nodes(ts, graph, *waiting);
 
-    run_from_waiting(ts, graph, labels, *waiting, stats);
+    run_from_waiting(ts, graph, properties, *waiting, stats);
 
     stats.set_end_time();
 
@@ -99,14 +117,69 @@ public:
   */
   tchecker::algorithms::reach::stats_t run(TS & ts, GRAPH & graph, boost::dynamic_bitset<> const & labels,
                                            tchecker::waiting::waiting_t<typename GRAPH::node_sptr_t> & waiting)
+  {
+    tchecker::algorithms::properties_t properties{labels};
+    return run(ts, graph, properties, waiting);
+  }
+
+  /*!
+  \brief Build a reachability graph of a transition system from a waiting
+  container, checking several properties at once
+  \param ts : a transition system
+  \param graph : a graph
+  \param properties : sets of accepting labels
+  \param waiting : a waiting container
+  \post same as run from initial states with properties, starting from the
+  nodes in waiting
+  \return statistics on the run
+  */
+  tchecker::algorithms::reach::stats_t run(TS & ts, GRAPH & graph, tchecker::algorithms::properties_t & properties,
+                                           tchecker::waiting::waiting_t<typename GRAPH::node_sptr_t> & waiting)
   {
     tchecker::algorithms::reach::stats_t stats;
+    run(ts, graph, properties, waiting, stats);
+    return stats;
+  }
 
+  /*!
+  \brief Continue building a reachability graph of a transition system from a
+  waiting container
+  \param ts : a transition system
+  \param graph : a graph
+  \param properties : sets of accepting labels
+  \param waiting : a waiting container
+  \param stats : statistics of the run so far
+  \post same as run from waiting with properties. The numbers of visited states
+  and transitions of this run have been added to stats
+  \note this allows to resume a run that has been interrupted, and to observe
+  the statistics of a run while it is running (e.g. from waiting)
+  */
+  void run(TS & ts, GRAPH & graph, tchecker::algorithms::properties_t & properties,
+           tchecker::waiting::waiting_t<typename GRAPH::node_sptr_t> & waiting, tchecker::algorithms::reach::stats_t & stats)
+  {
     stats.set_start_time();
-    run_from_waiting(ts, graph, labels, waiting, stats);
+    run_from_waiting(ts, graph, properties, waiting, stats);
     stats.set_end_time();
+  }
 
-    return stats;
+  /*!
+   \brief Create nodes for initial states
+   \param ts : a transition system
+   \param graph : a graph
+   \param waiting : a waiting container
+   \post a node has been added to graph for each initial state of ts (if not
+   yet in), and all new nodes have been inserted in waiting
+   */
+  void insert_initial_nodes(TS & ts, GRAPH & graph, tchecker::waiting::waiting_t<typename GRAPH::node_sptr_t> & waiting)
+  {
+    std::vector<typename TS::sst_t> sst;
+    ts.initial(sst);
+    for (auto && [status, s, t] : sst) {
+      auto && [is_new_node, initial_node] = graph.add_node(s);
+      initial_node->initial(true);
+      if (is_new_node)
+        waiting.insert(initial_node);
+    }
   }
 
 private:
@@ -115,18 +188,18 @@ private:
   container
   \param ts : a transition system
   \param graph : a graph
-  \param labels : accepting labels
+  \param properties : sets of accepting labels
   \param waiting : a waiting container
   \param stats : statistics
   \post graph is built from a traversal of ts starting from the nodes in
-  waiting, until a state that satisfies labels is reached (if any).
+  waiting, until all properties have been reached (if ever).
   A node is created for each reachable state in ts, and an edge is
   created for each transition is ts. The order in which the nodes of ts are
   visited depends on the policy implemented by waiting.
   The number of visited nodes and reachability of a satisfying node have been
   set in stats.
   */
-  void run_from_waiting(TS & ts, GRAPH & graph, boost::dynamic_bitset<> const & labels,
+  void run_from_waiting(TS & ts, GRAPH & graph, tchecker::algorithms::properties_t & properties,
                         tchecker::waiting::waiting_t<typename GRAPH::node_sptr_t> & waiting,
                         tchecker::algorithms::reach::stats_t & stats)
   {
@@ -138,10 +211,11 @@ private:
 
       ++stats.visited_states();
 
-      if (accepting(node, ts, labels)) {
+      if (accepting(node, ts, properties)) {
         node->final(true);
         stats.reachable() = true;
-        break;
+        if (properties.resolved())
+          break;
       }
 
       ts.next(node->state_ptr(), sst);
@@ -163,13 +237,21 @@ private:
    \brief Check if a node is accepting
    \param n : a node
    \param ts : a transition system
-   \param labels : a set of labels
-   \return true if labels is not empty, and the set of labels in n contain
-   labels, and n is a valid final state in ts, false otherwise
+   \param properties : sets of labels
+   \return true if the set of labels in n contains some non-empty property that
+   has not been reached yet, and n is a valid final state in ts, false otherwise
+   \post all the properties satisfied by n have been marked reached if n is
+   accepting
    */
-  bool accepting(node_sptr_t const & n, TS & ts, boost::dynamic_bitset<> const & labels)
+  bool accepting(node_sptr_t const & n, TS & ts, tchecker::algorithms::properties_t & properties)
   {
-    return !labels.none() && labels.is_subset_of(ts.labels(n->state_ptr())) && ts.is_valid_final(n->state_ptr());
+    if (!properties.pending())
+      return false;
+    boost::dynamic_bitset<> labels = ts.labels(n->state_ptr());
+    if (!properties.match(labels) || !ts.is_valid_final(n->state_ptr()))
+      return false;
+    properties.mark(labels);
+    return true;
   }
 };
 
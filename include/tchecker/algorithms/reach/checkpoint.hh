@@ -0,0 +1,96 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_ZG_REACH_CHECKPOINT_HH
+#define TCHECKER_ZG_REACH_CHECKPOINT_HH
+
+#include <string>
+#include <vector>
+
+#include "tchecker/algorithms/properties.hh"
+#include "tchecker/algorithms/reach/stats.hh"
+#include "tchecker/algorithms/reach/zg-reach.hh"
+#include "tchecker/zg/zg.hh"
+
+/*!
+ \file checkpoint.hh
+ \brief Checkpoints of the reachability algorithm over the zone graph
+ \note A checkpoint is a binary file that stores the nodes of the
+ reachability graph (discrete part, zone, initial and final flags), the
+ waiting nodes in the order in which they are processed, the statistics and
+ the reachability of the properties. Edges are not stored: a resumed run
+ builds the edges of the nodes that were waiting, only. Tuples of locations
+ and valuations of bounded integer variables are bit-packed (see
+ tchecker::vloc_packing_t and tchecker::intval_packing_t), and the discrete
+ parts of the nodes are tree-compressed (see tchecker::tree_table_t)
+ \note A checkpoint can only be resumed for the system it has been saved for:
+ the header records a hash of the declaration of the system (after slicing or
+ merging clocks, if any), the search order and the properties
+ \note Checkpoints are only available for reachability over the zone graph
+ (tck-reach -a reach). Covering reachability and liveness algorithms keep
+ state (subsumption, DFS stacks, colors of nodes) that is not saved
+ */
+
+namespace tchecker {
+
+namespace algorithms {
+
+namespace zg_reach {
+
+/*!
+ \brief Save a checkpoint
+ \param filename : checkpoint file name
+ \param system_name : name of the system
+ \param search_order : search order
+ \param zg : zone graph
+ \param graph : reachability graph of zg
+ \param waiting : waiting nodes of graph, in the order in which they are
+ processed
+ \param stats : statistics of the run
+ \param properties : properties checked by the run
+ \post the checkpoint has been written to filename. The file is written
+ atomically: a crash while saving keeps the previous checkpoint (if any)
+ \throw std::runtime_error : if the checkpoint cannot be written
+ */
+void save_checkpoint(std::string const & filename, std::string const & system_name, std::string const & search_order,
+                     tchecker::zg::zg_t const & zg, tchecker::algorithms::zg_reach::graph_t const & graph,
+                     std::vector<tchecker::algorithms::zg_reach::graph_t::node_sptr_t> const & waiting,
+                     tchecker::algorithms::reach::stats_t const & stats,
+                     tchecker::algorithms::properties_t const & properties);
+
+/*!
+ \brief Load a checkpoint
+ \param filename : checkpoint file name
+ \param system_name : name of the system
+ \param search_order : search order
+ \param zg : zone graph
+ \param graph : reachability graph
+ \param waiting : waiting nodes
+ \param stats : statistics
+ \param properties : properties
+ \pre graph is empty
+ \post the nodes in filename have been added to graph, with states built and
+ shared by zg. The waiting nodes have been appended to waiting in the order in
+ which they shall be processed. The numbers of visited states and transitions,
+ and reachability have been set in stats. The properties that were reached
+ have been marked in properties
+ \throw std::runtime_error : if filename cannot be read, if it is not a
+ checkpoint, or if it has not been saved for the same system (name and
+ declaration), search order, properties and build of TChecker
+ */
+void load_checkpoint(std::string const & filename, std::string const & system_name, std::string const & search_order,
+                     tchecker::zg::zg_t & zg, tchecker::algorithms::zg_reach::graph_t & graph,
+                     std::vector<tchecker::algorithms::zg_reach::graph_t::node_sptr_t> & waiting,
+                     tchecker::algorithms::reach::stats_t & stats, tchecker::algorithms::properties_t & properties);
+
+} // end of namespace zg_reach
+
+} // end of namespace algorithms
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_ZG_REACH_CHECKPOINT_HH
@@ -8,11 +8,14 @@
 #ifndef TCHECKER_ZG_REACH_ALGORITHM_HH
 #define TCHECKER_ZG_REACH_ALGORITHM_HH
 
+#include <chrono>
 #include <memory>
 #include <ostream>
 #include <string>
 #include <tuple>
+#include <vector>
 
+#include "tchecker/algorithms/properties.hh"
 #include "tchecker/algorithms/reach/algorithm.hh"
 #include "tchecker/algorithms/reach/stats.hh"
 #include "tchecker/graph/edge.hh"
@@ -21,6 +24,8 @@
 #include "tchecker/parsing/declaration.hh"
 #include "tchecker/syncprod/vedge.hh"
 #include "tchecker/ts/state_space.hh"
+#include "tchecker/utils/memory_budget.hh"
+#include "tchecker/utils/progress.hh"
 #include "tchecker/utils/shared_objects.hh"
 #include "tchecker/waiting/waiting.hh"
 #include "tchecker/zg/path.hh"
@@ -177,6 +182,81 @@ private:
 */
 std::ostream & dot_output(std::ostream & os, tchecker::algorithms::zg_reach::graph_t const & g, std::string const & name);
 
+/*!
+ \brief Graph output in binary format
+ \param os : output stream
+ \param g : graph
+ \param name : graph name
+ \post graph g with name has been output to os in binary format (see
+ tchecker::graph::binary)
+*/
+std::ostream & binary_output(std::ostream & os, tchecker::algorithms::zg_reach::graph_t const & g, std::string const & name);
+
+/*!
+ \class dot_stream_t
+ \brief Streaming graph output in graphviz DOT language
+ \note nodes and edges are output while the graph is built, in the order of
+ exploration, with attributes written directly to the output stream. Nodes are
+ named after their address in memory. Use tchecker::graph::dot_canonical_output
+ to obtain a canonical output
+ */
+class dot_stream_t {
+public:
+  /*!
+   \brief Constructor
+   \param os : output stream
+   \param g : graph
+   \param name : graph name
+   \post the header of graph name has been output to os
+   \note this keeps references to os and g
+   */
+  dot_stream_t(std::ostream & os, tchecker::algorithms::zg_reach::graph_t const & g, std::string const & name);
+
+  /*!
+   \brief Copy constructor (deleted)
+   */
+  dot_stream_t(tchecker::algorithms::zg_reach::dot_stream_t const &) = delete;
+
+  /*!
+   \brief Destructor
+   \post see close()
+   */
+  ~dot_stream_t();
+
+  /*!
+   \brief Assignment operator (deleted)
+   */
+  tchecker::algorithms::zg_reach::dot_stream_t & operator=(tchecker::algorithms::zg_reach::dot_stream_t const &) = delete;
+
+  /*!
+   \brief Node output
+   \param n : a node
+   \pre this stream is not closed
+   \post n has been output
+   */
+  void output_node(tchecker::algorithms::zg_reach::graph_t::node_sptr_t const & n);
+
+  /*!
+   \brief Edges output
+   \param n : a node
+   \pre this stream is not closed
+   \post the outgoing edges of n have been output
+   */
+  void output_outgoing_edges(tchecker::algorithms::zg_reach::graph_t::node_sptr_t const & n);
+
+  /*!
+   \brief Close the stream
+   \post the footer of the graph has been output if this stream was not closed,
+   and this stream is closed
+   */
+  void close();
+
+private:
+  std::ostream & _os;                                    /*!< Output stream */
+  tchecker::algorithms::zg_reach::graph_t const & _g;    /*!< Graph */
+  bool _closed;                                          /*!< Closed flag */
+};
+
 /*!
  \class state_space_t
  \brief State-space representation consisting of a zone graph and a reachability graph
@@ -288,6 +368,84 @@ std::tuple<tchecker::algorithms::reach::stats_t, std::shared_ptr<tchecker::algor
 run(tchecker::parsing::system_declaration_t const & sysdecl, std::string const & labels = "",
     std::string const & search_order = "bfs", std::size_t block_size = 10000, std::size_t table_size = 65536);
 
+/*!
+ \brief Run reachability algorithm on the zone graph of a system,
+ checking several properties in a single exploration
+ \param sysdecl : system declaration
+ \param labels : properties, each property is a comma-separated string of labels
+ \param search_order : search order
+ \param block_size : number of elements allocated in one block
+ \param table_size : size of hash tables
+ \pre all labels must appear as node attributes in sysdecl
+ search_order must be either "dfs" or "bfs"
+ \return statistics on the run, reachability of each property in labels, and a
+ representation of the state-space as a reachability graph
+ \throw std::runtime_error : if clock bounds cannot be computed for the system modeled by sysdecls
+ */
+std::tuple<tchecker::algorithms::reach::stats_t, tchecker::algorithms::properties_t,
+           std::shared_ptr<tchecker::algorithms::zg_reach::state_space_t>>
+run(tchecker::parsing::system_declaration_t const & sysdecl, std::vector<std::string> const & labels,
+    std::string const & search_order = "bfs", std::size_t block_size = 10000, std::size_t table_size = 65536);
+
+/*!
+ \brief Run reachability algorithm on the zone graph of a system, with
+ checkpoints
+ \param sysdecl : system declaration
+ \param labels : properties, each property is a comma-separated string of labels
+ \param search_order : search order
+ \param checkpoint_file : checkpoint file name (empty for no checkpoint)
+ \param checkpoint_interval : time interval between two checkpoints
+ \param resume_file : name of the checkpoint file to resume from (empty to
+ start from the initial states)
+ \param block_size : number of elements allocated in one block
+ \param table_size : size of hash tables
+ \param spill_directory : directory where zones and valuations of bounded
+ integer variables are spilled (empty to keep them in memory)
+ \param graph_stream : output stream of the graph while it is built (nullptr
+ for no streaming output)
+ \param huge_pages : huge pages mode of states and of the graph
+ \param budget : memory budget (nullptr if unlimited)
+ \param progress : progress counters (nullptr for no progress reporting)
+ \pre all labels must appear as node attributes in sysdecl
+ search_order must be either "dfs", "bfs", "best-first" or "astar"
+ \return statistics on the run, reachability of each property in labels, and a
+ representation of the state-space as a reachability graph
+ \throw std::runtime_error : if clock bounds cannot be computed for the system
+ modeled by sysdecls, if resume_file cannot be loaded, or if a checkpoint
+ cannot be saved
+ \throw std::invalid_argument : if spill_directory is not a directory, or if
+ checkpoint_file or resume_file is not empty and search_order is "best-first"
+ or "astar"
+ \note the state of the run is saved to checkpoint_file every
+ checkpoint_interval (see tchecker::algorithms::zg_reach::save_checkpoint)
+ \note a resumed run starts from the nodes and statistics in resume_file. The
+ edges explored before resume_file was saved are not in the returned graph, and
+ the running time only accounts for the resumed run
+ \note see tchecker::zg::zg_t::spill for spill_directory, and
+ tchecker::zg::zg_t::huge_pages for huge_pages
+ \note see tchecker::algorithms::zg_reach::dot_stream_t for graph_stream. The
+ name of the streamed graph is the name of sysdecl
+ \note with a budget, the memory used by the zone graph and the reachability
+ graph is checked between the iterations of the algorithm (see
+ tchecker::waiting::budgeted_t). The graph stops storing edges when budget
+ degrades, and the algorithm stops when budget is exceeded: properties that
+ have not been reached yet are then unknown
+ \note with progress, the numbers of visited, stored and waiting states are
+ published to progress between the iterations of the algorithm (see
+ tchecker::waiting::reporting_t)
+ \note search orders "best-first" and "astar" are guided by the distance to
+ unreached properties in the location graphs of the processes (see
+ tchecker::algorithms::location_distance_t and tchecker::waiting::guided_t)
+ */
+std::tuple<tchecker::algorithms::reach::stats_t, tchecker::algorithms::properties_t,
+           std::shared_ptr<tchecker::algorithms::zg_reach::state_space_t>>
+run(tchecker::parsing::system_declaration_t const & sysdecl, std::vector<std::string> const & labels,
+    std::string const & search_order, std::string const & checkpoint_file, std::chrono::seconds checkpoint_interval,
+    std::string const & resume_file, std::size_t block_size = 10000, std::size_t table_size = 65536,
+    std::string const & spill_directory = "", std::ostream * graph_stream = nullptr,
+    enum tchecker::huge_pages_t huge_pages = tchecker::HUGE_PAGES_NONE, tchecker::memory_budget_t * budget = nullptr,
+    tchecker::progress_t * progress = nullptr);
+
 } // end of namespace zg_reach
 
 } // namespace algorithms
@@ -11,6 +11,7 @@
 #include <string>
 
 #include "tchecker/waiting/factory.hh"
+#include "tchecker/waiting/guided.hh"
 
 /*!
  \file search_order.hh
@@ -41,6 +42,23 @@ enum tchecker::waiting::policy_t waiting_policy(std::string const & search_order
 */
 enum tchecker::waiting::policy_t fast_remove_waiting_policy(std::string const & search_order);
 
+/*!
+ \brief Guided search order check
+ \param search_order : search order
+ \return true if search_order is either "best-first" or "astar", false otherwise
+*/
+bool is_guided_search_order(std::string const & search_order);
+
+/*!
+ \brief Conversion from guided search order to guidance
+ \param search_order : search order
+ \pre search_order is either "best-first" or "astar"
+ \return tchecker::waiting::GUIDANCE_BEST_FIRST if search_order is "best-first",
+ tchecker::waiting::GUIDANCE_ASTAR if search_order is "astar"
+ \throw std::invalid_argument if the precondition is not satisfied
+*/
+enum tchecker::waiting::guidance_t guidance(std::string const & search_order);
+
 } // end of namespace algorithms
 
 } // end of namespace tchecker
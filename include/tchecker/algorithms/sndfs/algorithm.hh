@@ -0,0 +1,457 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_ALGORITHMS_SNDFS_ALGORITHM_HH
+#define TCHECKER_ALGORITHMS_SNDFS_ALGORITHM_HH
+
+#include <algorithm>
+#include <cassert>
+#include <deque>
+#include <iterator>
+#include <stack>
+#include <tuple>
+#include <vector>
+
+#include <boost/dynamic_bitset.hpp>
+
+#include "tchecker/algorithms/ndfs/graph.hh"
+#include "tchecker/algorithms/sndfs/stats.hh"
+#include "tchecker/graph/subsumption_graph.hh"
+#include "tchecker/utils/progress.hh"
+
+/*!
+ \file algorithm.hh
+ \brief Nested DFS algorithm with subsumption
+ */
+
+namespace tchecker {
+
+namespace algorithms {
+
+namespace sndfs {
+
+/*!
+ \class algorithm_t
+ \brief Nested DFS algorithm with subsumption
+ \tparam TS : type of transition system, should implement tchecker::ts::fwd_t
+ and tchecker::ts::inspector_t
+ \tparam GRAPH : type of graph, should derive from
+ tchecker::graph::subsumption::graph_t, and nodes of type GRAPH::shared_node_t
+ should derive from tchecker::algorithms::ndfs::node_t and have a method
+ state_ptr() that yields a pointer to the corresponding state in TS. The
+ covering predicate of GRAPH should be a simulation over the states of TS that
+ preserves labels (e.g. zone inclusion over the zone graph with extrapolation)
+ \note Our implementation extends the nested DFS algorithm in
+ tchecker::algorithms::ndfs::algorithm_t with the subsumption rules in:
+ "Multi-Core Emptiness Checking of Timed Büchi Automata using Inclusion
+ Abstraction",
+ Alfons Laarman, Mads Chr. Olesen, Andreas Engelbredt Dalsgaard, Kim Guldstrand
+ Larsen and Jaco van de Pol
+ CAV 2013
+ which builds on:
+ "Efficient Emptiness Check for Timed Büchi Automata",
+ Frédéric Herbreteau, B. Srivathsan and Igor Walukiewicz
+ CAV 2010
+
+ Let t <= t' denote that state t' simulates state t. The rules are:
+ - a state t that is subsumed by a red state (t <= r with r red) cannot reach
+   an accepting cycle, hence it is not explored, and it is colored red
+ - in the red DFS, reaching a state t that simulates a cyan state (c <= t with
+   c cyan) closes an accepting cycle through the seed of the red DFS
+ - in the blue DFS, reaching a state t that simulates a cyan state from a state
+   s (s -> t and c <= t with c cyan) closes an accepting cycle if s or t is
+   accepting
+
+ Successor states that are equal to a state in the graph (w.r.t. the covering
+ predicate in both directions) are merged with the existing node.
+ Successor states that are subsumed by a red node when they are computed are
+ not stored: a subsumption edge to the red node is added instead.
+ */
+template <class TS, class GRAPH> class algorithm_t {
+public:
+  using node_sptr_t = typename GRAPH::node_sptr_t;
+
+  /*!
+   \brief Check if a transition has an infinite run that satisfies a given set
+   of labels and build the corresponding graph
+   \param ts : a transition system
+   \param graph : a graph
+   \param labels : accepting labels
+   \param progress : progress counters (nullptr for no progress reporting)
+   \post graph is built from a traversal of ts starting from its initial states,
+   until a cycle that satisfies labels is reached (if any).
+   A node is created for each reached state in ts that is not subsumed by a red
+   node, and an edge is created for each transition in ts. Transitions to states
+   that are subsumed by a red node yield subsumption edges
+   \return statistics on the run
+   \note if labels is empty, graph is the full state-space of ts up to
+   subsumption
+   \note with progress, the numbers of visited, stored and subsumed states, and
+   the number of nodes on the DFS stacks are published to progress every
+   tchecker::PROGRESS_PERIOD visited states
+   */
+  tchecker::algorithms::sndfs::stats_t run(TS & ts, GRAPH & graph, boost::dynamic_bitset<> const & labels,
+                                           tchecker::progress_t * progress = nullptr)
+  {
+    tchecker::algorithms::sndfs::stats_t stats;
+
+    stats.set_start_time();
+
+    _progress = progress;
+
+    std::vector<typename TS::sst_t> sst;
+    ts.initial(sst);
+    for (auto && [status, s, t] : sst) {
+      auto && [is_new_node, initial_node] = find_else_add(graph, s);
+      initial_node->initial(true);
+      initial_node->final(accepting(initial_node, ts, labels));
+      if (initial_node->color() == tchecker::algorithms::ndfs::WHITE && !red_subsumed(graph, initial_node, stats))
+        dfs_blue(ts, graph, labels, stats, initial_node);
+      if (stats.cycle())
+        break;
+    }
+
+    stats.stored_states() = graph.nodes_count();
+
+    if (_progress != nullptr)
+      _progress->publish(stats.visited_states(), stats.stored_states(), 0, stats.subsumed_states());
+
+    stats.set_end_time();
+
+    return stats;
+  }
+
+private:
+  /*!
+   \brief Find or add a node
+   \param graph : a graph
+   \param s : a state
+   \return (false, n) with n the node in graph with a state equal to s if any,
+   (true, n) with n a new node for s otherwise
+   \post a node for s has been added to graph if graph had no node with a state
+   equal to s
+   */
+  template <class STATE> std::tuple<bool, node_sptr_t> find_else_add(GRAPH & graph, STATE const & s)
+  {
+    node_sptr_t n = graph.add_node(s);
+
+    std::vector<node_sptr_t> covering, covered;
+    auto covering_inserter = std::back_inserter(covering);
+    graph.covering_nodes(n, covering_inserter);
+    if (covering.empty())
+      return std::make_tuple(true, n);
+    auto covered_inserter = std::back_inserter(covered);
+    graph.covered_nodes(n, covered_inserter);
+
+    for (node_sptr_t const & c : covering)
+      if (std::find(covered.begin(), covered.end(), c) != covered.end()) {
+        graph.remove_node(n);
+        return std::make_tuple(false, c);
+      }
+    return std::make_tuple(true, n);
+  }
+
+  /*!
+   \brief Check if a node is subsumed by a red node
+   \param graph : a graph
+   \param n : a node
+   \param stats : statistics
+   \return true if n is red or n is subsumed by a red node in graph, false
+   otherwise
+   \post n is colored red if it is subsumed by a red node, and the number of
+   subsumed states in stats has been updated
+   */
+  bool red_subsumed(GRAPH & graph, node_sptr_t & n, tchecker::algorithms::sndfs::stats_t & stats) const
+  {
+    if (n->color() == tchecker::algorithms::ndfs::RED)
+      return true;
+    node_sptr_t r = red_covering_node(graph, n);
+    if (r.ptr() == nullptr)
+      return false;
+    n->color() = tchecker::algorithms::ndfs::RED;
+    ++stats.subsumed_states();
+    return true;
+  }
+
+  /*!
+   \brief Find a red node that subsumes a node
+   \param graph : a graph
+   \param n : a node
+   \return a red node in graph that subsumes n if any, nullptr otherwise
+   */
+  node_sptr_t red_covering_node(GRAPH & graph, node_sptr_t const & n) const
+  {
+    std::vector<node_sptr_t> covering;
+    auto inserter = std::back_inserter(covering);
+    graph.covering_nodes(n, inserter);
+    for (node_sptr_t const & c : covering)
+      if (c->color() == tchecker::algorithms::ndfs::RED)
+        return c;
+    return node_sptr_t{nullptr};
+  }
+
+  /*!
+   \brief Check if a node is cyan or subsumes a cyan node
+   \param graph : a graph
+   \param n : a node
+   \return true if n is cyan, or if n subsumes a cyan node in graph, false
+   otherwise
+   */
+  bool cyan_subsuming(GRAPH & graph, node_sptr_t const & n) const
+  {
+    if (n->color() == tchecker::algorithms::ndfs::CYAN)
+      return true;
+    std::vector<node_sptr_t> covered;
+    auto inserter = std::back_inserter(covered);
+    graph.covered_nodes(n, inserter);
+    for (node_sptr_t const & c : covered)
+      if (c->color() == tchecker::algorithms::ndfs::CYAN)
+        return true;
+    return false;
+  }
+
+  /*!
+   \brief Adds successor nodes to the graph
+   \param ts : a transition system
+   \param graph : a graph
+   \param n : a node
+   \param labels : accepting labels
+   \param stats : statistics
+   \post all successor nodes of n in ts have been added to graph (if not yet in)
+   with corresponding edges, and flag final set to true if accepting w.r.t
+   labels. New successors that are subsumed by a red node have not been added,
+   instead a subsumption edge from n to the red node has been added
+   \return all successor nodes of n that are not subsumed by a red node
+  */
+  std::deque<node_sptr_t> expand_node(TS & ts, GRAPH & graph, node_sptr_t & n, boost::dynamic_bitset<> const & labels,
+                                      tchecker::algorithms::sndfs::stats_t & stats)
+  {
+    std::deque<node_sptr_t> next_nodes;
+    std::vector<typename TS::sst_t> v;
+    ts.next(n->state_ptr(), v);
+    for (auto && [status, s, t] : v) {
+      auto && [is_new_node, nextn] = find_else_add(graph, s);
+      if (is_new_node) {
+        node_sptr_t r = red_covering_node(graph, nextn);
+        if (r.ptr() != nullptr) {
+          graph.add_edge(n, r, tchecker::graph::subsumption::EDGE_SUBSUMPTION, *t);
+          graph.remove_node(nextn);
+          ++stats.subsumed_states();
+          continue;
+        }
+      }
+      graph.add_edge(n, nextn, tchecker::graph::subsumption::EDGE_ACTUAL, *t);
+      nextn->final(accepting(nextn, ts, labels));
+      next_nodes.push_back(nextn);
+    }
+    return next_nodes;
+  }
+
+  /*!
+   \brief Type of entries of the blue DFS stack
+   */
+  struct blue_stack_entry_t {
+    node_sptr_t n;                /*!< Node */
+    std::deque<node_sptr_t> succ; /*!< Successors of node n that have not been visited yet */
+    bool allred;                  /*!< True if all explored successors of n are red */
+
+    /*!
+     \brief Remove and return the first successor node
+     \pre succ is not empty (checked by assertion)
+     \return the first successor of node n
+     \post the first successors of node n has been removed from succ
+    */
+    node_sptr_t pick_successor()
+    {
+      assert(!succ.empty());
+      node_sptr_t n = succ.front();
+      succ.pop_front();
+      return n;
+    }
+  };
+
+  /*!
+   \brief Blue DFS from a node
+   \param ts : a transition system
+   \param graph : a graph
+   \param labels : accepting labels
+   \param stats : statistics
+   \param n : node
+  */
+  void dfs_blue(TS & ts, GRAPH & graph, boost::dynamic_bitset<> const & labels, tchecker::algorithms::sndfs::stats_t & stats,
+                node_sptr_t & n)
+  {
+    std::stack<blue_stack_entry_t> stack;
+
+    n->color() = tchecker::algorithms::ndfs::CYAN;
+    stack.push(blue_stack_entry_t{n, expand_node(ts, graph, n, labels, stats), true});
+    ++stats.visited_states_blue();
+    publish_progress(graph, stats, stack.size());
+
+    while (!stack.empty()) {
+      auto && [s, succ, allred] = stack.top();
+      if (succ.empty()) {
+        if (allred)
+          s->color() = tchecker::algorithms::ndfs::RED;
+        else if (s->final()) {
+          dfs_red(graph, stats, s, stack.size());
+          s->color() = tchecker::algorithms::ndfs::RED;
+        }
+        else
+          s->color() = tchecker::algorithms::ndfs::BLUE;
+        bool s_is_red = (s->color() == tchecker::algorithms::ndfs::RED);
+        stack.pop();
+        if (!s_is_red && !stack.empty())
+          stack.top().allred = false;
+        if (stats.cycle())
+          break;
+      }
+      else {
+        node_sptr_t t = stack.top().pick_successor();
+        ++stats.visited_transitions_blue();
+        if ((s->final() || t->final()) && cyan_subsuming(graph, t)) {
+          stats.cycle() = true;
+          break;
+        }
+        else if (t->color() == tchecker::algorithms::ndfs::WHITE) {
+          if (red_subsumed(graph, t, stats))
+            continue;
+          t->color() = tchecker::algorithms::ndfs::CYAN;
+          stack.push(blue_stack_entry_t{t, expand_node(ts, graph, t, labels, stats), true});
+          ++stats.visited_states_blue();
+          publish_progress(graph, stats, stack.size());
+        }
+        else if (t->color() != tchecker::algorithms::ndfs::RED)
+          allred = false;
+      }
+    }
+  }
+
+  /*!
+   \brief Check if a node is accepting
+   \param n : a node
+   \param ts : a transition system
+   \param labels : a set of labels
+   \return true if labels is not empty, and labels is a subset of the labels of
+   node n in ts, false otherwise
+   */
+  bool accepting(node_sptr_t const & n, TS & ts, boost::dynamic_bitset<> const & labels) const
+  {
+    return !labels.none() && labels.is_subset_of(ts.labels(n->state_ptr()));
+  }
+
+  /*!
+   \brief Type of entries in the red DFS stack
+  */
+  struct red_stack_entry_t {
+    node_sptr_t n;                                     /*!< Node */
+    typename GRAPH::outgoing_edges_iterator_t current; /*!< Iterator on current successor node */
+    typename GRAPH::outgoing_edges_iterator_t end;     /*!< Path-the-end iterator on successor nodes */
+
+    /*!
+     \brief Constructor
+     \param n : a node
+     \param r : range of outgoing edges of node n
+    */
+    red_stack_entry_t(node_sptr_t & n, tchecker::range_t<typename GRAPH::outgoing_edges_iterator_t> const & r)
+        : n(n), current(r.begin()), end(r.end())
+    {
+    }
+
+    /*!
+     \brief Check emptiness of successor range
+     \return true if the range [current; end) of successor nodes is empty, false
+     otherwise
+     */
+    bool has_successor() const { return (current != end); }
+
+    /*!
+     \brief Remove and return the first outgoing edge
+     \pre the range [current,end) is not empty (checked by assertion)
+     \return the first outgoing edge of node n
+     \post the first outgoing edge of node n has been removed from the range of
+     successors
+    */
+    typename GRAPH::edge_sptr_t pick_edge()
+    {
+      assert(current != end);
+      typename GRAPH::edge_sptr_t e = *current;
+      ++current;
+      return e;
+    }
+  };
+
+  /*!
+   \brief Red DFS from a node
+   \param graph : a graph
+   \param stats : statistics
+   \param n : node
+   \param blue_depth : size of the blue DFS stack
+   \note the red DFS only follows actual edges in graph: all the nodes it visits
+   have been expanded by the blue DFS
+  */
+  void dfs_red(GRAPH & graph, tchecker::algorithms::sndfs::stats_t & stats, node_sptr_t & n, std::size_t blue_depth)
+  {
+    std::stack<red_stack_entry_t> stack;
+
+    stack.push(red_stack_entry_t{n, graph.outgoing_edges(n)});
+    ++stats.visited_states_red();
+    publish_progress(graph, stats, blue_depth + stack.size());
+
+    while (!stack.empty()) {
+      red_stack_entry_t & top = stack.top();
+      if (!top.has_successor())
+        stack.pop();
+      else {
+        typename GRAPH::edge_sptr_t e = top.pick_edge();
+        // the target of a subsumption edge is a red node that simulates the
+        // actual successor: it cannot be used to detect cyan subsumption
+        if (graph.edge_type(e) != tchecker::graph::subsumption::EDGE_ACTUAL)
+          continue;
+        node_sptr_t t = graph.edge_tgt(e);
+        ++stats.visited_transitions_red();
+        if (cyan_subsuming(graph, t)) {
+          stats.cycle() = true;
+          break;
+        }
+        else if (t->color() == tchecker::algorithms::ndfs::BLUE) {
+          if (red_subsumed(graph, t, stats))
+            continue;
+          t->color() = tchecker::algorithms::ndfs::RED;
+          stack.push(red_stack_entry_t{t, graph.outgoing_edges(t)});
+          ++stats.visited_states_red();
+          publish_progress(graph, stats, blue_depth + stack.size());
+        }
+      }
+    }
+  }
+
+  /*!
+   \brief Publish progress
+   \param graph : a graph
+   \param stats : statistics
+   \param waiting : number of nodes on the DFS stacks
+   \post the numbers of visited, stored and subsumed states, and waiting have
+   been published to the progress counters if any, and if the number of visited
+   states is a multiple of tchecker::PROGRESS_PERIOD
+   */
+  void publish_progress(GRAPH const & graph, tchecker::algorithms::sndfs::stats_t const & stats, std::size_t waiting)
+  {
+    if ((_progress != nullptr) && (stats.visited_states() % tchecker::PROGRESS_PERIOD == 0))
+      _progress->publish(stats.visited_states(), graph.nodes_count(), waiting, stats.subsumed_states());
+  }
+
+  tchecker::progress_t * _progress{nullptr}; /*!< Progress counters (nullptr if none) */
+};
+
+} // namespace sndfs
+
+} // namespace algorithms
+
+} // namespace tchecker
+
+#endif // TCHECKER_ALGORITHMS_SNDFS_ALGORITHM_HH
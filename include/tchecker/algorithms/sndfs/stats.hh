@@ -0,0 +1,69 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_ALGORITHMS_SNDFS_STATS_HH
+#define TCHECKER_ALGORITHMS_SNDFS_STATS_HH
+
+#include <map>
+#include <string>
+
+#include "tchecker/algorithms/ndfs/stats.hh"
+
+/*!
+ \file stats.hh
+ \brief Statistics for nested DFS algorithm with subsumption
+ */
+
+namespace tchecker {
+
+namespace algorithms {
+
+namespace sndfs {
+
+/*!
+ \class stats_t
+ \brief Statistics for nested DFS algorithm with subsumption
+ */
+class stats_t : public tchecker::algorithms::ndfs::stats_t {
+public:
+  /*!
+   \brief Constructor
+   */
+  stats_t();
+
+  /*!
+   \brief Accessor
+   \return A reference to the number of states that have not been explored
+   since they are subsumed by a red state
+   */
+  unsigned long & subsumed_states();
+
+  /*!
+   \brief Accessor
+   \return the number of states that have not been explored since they are
+   subsumed by a red state
+   */
+  unsigned long subsumed_states() const;
+
+  /*!
+   \brief Extract statistics as attributes (key, value)
+   \param m : attributes map
+   \post every statistics has been added to m
+  */
+  void attributes(std::map<std::string, std::string> & m) const;
+
+private:
+  unsigned long _subsumed_states; /*!< Number of states subsumed by a red state */
+};
+
+} // end of namespace sndfs
+
+} // end of namespace algorithms
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_ALGORITHMS_SNDFS_STATS_HH
@@ -0,0 +1,258 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_ZG_SNDFS_ALGORITHM_HH
+#define TCHECKER_ZG_SNDFS_ALGORITHM_HH
+
+/*!
+ \file zg-sndfs.hh
+ \brief Nested DFS algorithm with subsumption over the zone graph with zone inclusion
+*/
+
+#include <memory>
+#include <ostream>
+#include <string>
+#include <tuple>
+
+#include "tchecker/algorithms/ndfs/graph.hh"
+#include "tchecker/algorithms/sndfs/algorithm.hh"
+#include "tchecker/algorithms/sndfs/stats.hh"
+#include "tchecker/graph/edge.hh"
+#include "tchecker/graph/node.hh"
+#include "tchecker/graph/subsumption_graph.hh"
+#include "tchecker/parsing/declaration.hh"
+#include "tchecker/syncprod/vedge.hh"
+#include "tchecker/ts/state_space.hh"
+#include "tchecker/utils/progress.hh"
+#include "tchecker/utils/shared_objects.hh"
+#include "tchecker/zg/state.hh"
+#include "tchecker/zg/transition.hh"
+#include "tchecker/zg/zg.hh"
+
+namespace tchecker {
+
+namespace algorithms {
+
+namespace zg_sndfs {
+
+/*!
+ \class node_t
+ \brief Node of the liveness graph with subsumption of a zone graph
+ */
+class node_t : public tchecker::algorithms::ndfs::node_t, public tchecker::graph::node_zg_state_t {
+public:
+  /*!
+   \brief Constructor
+   \param s : a zone graph state
+   \post this node keeps a shared pointer to s
+   */
+  node_t(tchecker::zg::state_sptr_t const & s);
+
+  /*!
+   \brief Constructor
+   \param s : a zone graph state
+   \post this node keeps a shared pointer to s
+   */
+  node_t(tchecker::zg::const_state_sptr_t const & s);
+};
+
+/*!
+\class node_hash_t
+\brief Hash functor for nodes
+*/
+class node_hash_t {
+public:
+  /*!
+  \brief Hash function
+  \param n : a node
+  \return hash value for n based on the discrete part of n (i.e. the tuple of
+  locations and integer variable valuations) since we need to cover nodes with
+  same discrete part
+  */
+  std::size_t operator()(tchecker::algorithms::zg_sndfs::node_t const & n) const;
+};
+
+/*!
+\class node_le_t
+\brief Covering predicate for nodes
+*/
+class node_le_t {
+public:
+  /*!
+  \brief Covering predicate for nodes
+  \param n1 : a node
+  \param n2 : a node
+  \return true if n1 and n2 have same discrete part and the zone of n1 is
+  included in the zone of n2, false otherwise
+  */
+  bool operator()(tchecker::algorithms::zg_sndfs::node_t const & n1, tchecker::algorithms::zg_sndfs::node_t const & n2) const;
+};
+
+/*!
+ \class edge_t
+ \brief Edge of the liveness graph with subsumption of a zone graph
+*/
+class edge_t : public tchecker::graph::edge_vedge_t {
+public:
+  /*!
+   \brief Constructor
+   \param t : a zone graph transition
+   \post this node keeps a shared pointer on the vedge in t
+  */
+  edge_t(tchecker::zg::transition_t const & t);
+};
+
+/*!
+ \class graph_t
+ \brief Liveness graph with subsumption over the zone graph
+*/
+class graph_t : public tchecker::graph::subsumption::graph_t<
+                    tchecker::algorithms::zg_sndfs::node_t, tchecker::algorithms::zg_sndfs::edge_t,
+                    tchecker::algorithms::zg_sndfs::node_hash_t, tchecker::algorithms::zg_sndfs::node_le_t> {
+public:
+  /*!
+   \brief Constructor
+   \param zg : zone graph
+   \param block_size : number of objects allocated in a block
+   \param table_size : size of hash table
+   \note this keeps a pointer on zg
+   \note this graph keeps pointers to (part of) states and (part of) transitions allocated by zg. Hence, the graph
+   must be destroyed *before* zg is destroyed, since all states and transitions allocated by zg are detroyed
+   when zg is destroyed. See state_space_t below to store both fzg and this graph and destroy them in the expected
+   order.
+  */
+  graph_t(std::shared_ptr<tchecker::zg::zg_t> const & zg, std::size_t block_size, std::size_t table_size);
+
+  /*!
+   \brief Accessor
+   \return pointer to internal zone graph
+  */
+  inline std::shared_ptr<tchecker::zg::zg_t> zg_ptr() { return _zg; }
+
+  /*!
+   \brief Accessor
+   \return internal zone graph
+  */
+  inline tchecker::zg::zg_t const & zg() const { return *_zg; }
+
+  using tchecker::graph::subsumption::graph_t<tchecker::algorithms::zg_sndfs::node_t, tchecker::algorithms::zg_sndfs::edge_t,
+                                              tchecker::algorithms::zg_sndfs::node_hash_t,
+                                              tchecker::algorithms::zg_sndfs::node_le_t>::attributes;
+
+  /*!
+   \brief Checks if an edge is an actual edge (not a subsumption edge)
+   \param e : an edge
+   \return true if e is an actual edge, false otherwise (e is a subsumption edge)
+   */
+  bool is_actual_edge(edge_sptr_t const & e) const;
+
+protected:
+  /*!
+   \brief Accessor to node attributes
+   \param n : a node
+   \param m : a map (key, value) of attributes
+   \post attributes of node n have been added to map m
+  */
+  virtual void attributes(tchecker::algorithms::zg_sndfs::node_t const & n, std::map<std::string, std::string> & m) const;
+
+  /*!
+   \brief Accessor to edge attributes
+   \param e : an edge
+   \param m : a map (key, value) of attributes
+   \post attributes of edge e have been added to map m
+  */
+  virtual void attributes(tchecker::algorithms::zg_sndfs::edge_t const & e, std::map<std::string, std::string> & m) const;
+
+private:
+  std::shared_ptr<tchecker::zg::zg_t> _zg; /*!< Zone graph */
+};
+
+/*!
+ \brief Graph output
+ \param os : output stream
+ \param g : graph
+ \param name : graph name
+ \post graph g with name has been output to os
+*/
+std::ostream & dot_output(std::ostream & os, tchecker::algorithms::zg_sndfs::graph_t const & g, std::string const & name);
+
+/*!
+ \brief Graph output in binary format
+ \param os : output stream
+ \param g : graph
+ \param name : graph name
+ \post graph g with name has been output to os in binary format (see
+ tchecker::graph::binary)
+*/
+std::ostream & binary_output(std::ostream & os, tchecker::algorithms::zg_sndfs::graph_t const & g, std::string const & name);
+
+/*!
+ \class state_space_t
+ \brief State-space representation consisting of a zone graph and a subsumption graph
+ */
+class state_space_t {
+public:
+  /*!
+   \brief Constructor
+   \param zg : zone graph
+   \param block_size : number of objects allocated in a block
+   \param table_size : size of hash table
+   \note this keeps a pointer on zg
+   */
+  state_space_t(std::shared_ptr<tchecker::zg::zg_t> const & zg, std::size_t block_size, std::size_t table_size);
+
+  /*!
+   \brief Accessor
+   \return The zone graph
+   */
+  tchecker::zg::zg_t & zg();
+
+  /*!
+   \brief Accessor
+   \return The subsumption graph representing the state-space
+   */
+  tchecker::algorithms::zg_sndfs::graph_t & graph();
+
+private:
+  tchecker::ts::state_space_t<tchecker::zg::zg_t, tchecker::algorithms::zg_sndfs::graph_t>
+      _ss; /*!< State-space representation */
+};
+
+/*!
+ \class algorithm_t
+ \brief Nested DFS algorithm with subsumption over the zone graph
+*/
+class algorithm_t
+    : public tchecker::algorithms::sndfs::algorithm_t<tchecker::zg::zg_t, tchecker::algorithms::zg_sndfs::graph_t> {
+public:
+  using tchecker::algorithms::sndfs::algorithm_t<tchecker::zg::zg_t, tchecker::algorithms::zg_sndfs::graph_t>::algorithm_t;
+};
+
+/*!
+ \brief Run nested DFS algorithm with subsumption on the zone graph of a system
+ \param sysdecl : system declaration
+ \param labels : comma-separated string of labels
+ \param block_size : number of elements allocated in one block
+ \param table_size : size of hash tables
+ \param progress : progress counters (nullptr for no progress reporting)
+ \pre labels must appear as node attributes in sysdecl
+ \return statistics on the run and the liveness graph
+ \throw std::runtime_error : if clock bounds cannot be computed for the system modeled by sysdecl
+ \note the zone graph uses local ExtraLU+ extrapolation, for which zone
+ inclusion is a simulation
+ */
+std::tuple<tchecker::algorithms::sndfs::stats_t, std::shared_ptr<tchecker::algorithms::zg_sndfs::state_space_t>>
+run(tchecker::parsing::system_declaration_t const & sysdecl, std::string const & labels = "", std::size_t block_size = 10000,
+    std::size_t table_size = 65536, tchecker::progress_t * progress = nullptr);
+
+} // namespace zg_sndfs
+
+} // namespace algorithms
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_ZG_SNDFS_ALGORITHM_HH
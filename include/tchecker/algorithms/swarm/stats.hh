@@ -0,0 +1,123 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_ALGORITHMS_SWARM_STATS_HH
+#define TCHECKER_ALGORITHMS_SWARM_STATS_HH
+
+#include <map>
+#include <string>
+
+#include "tchecker/algorithms/stats.hh"
+
+/*!
+ \file stats.hh
+ \brief Statistics for swarm verification
+ */
+
+namespace tchecker {
+
+namespace algorithms {
+
+namespace swarm {
+
+/*!
+ \class stats_t
+ \brief Statistics for swarm verification
+ \note the statistics of the winning instance are reported along with the
+ statistics of the swarm. Running time and memory usage are those of the whole
+ swarm
+ */
+class stats_t : public tchecker::algorithms::stats_t {
+public:
+  /*!
+   \brief Constructor
+   */
+  stats_t();
+
+  /*!
+   \brief Accessor
+   \return Reference to the number of instances
+   */
+  unsigned long & instances();
+
+  /*!
+   \brief Accessor
+   \return Number of instances
+   */
+  unsigned long instances() const;
+
+  /*!
+   \brief Accessor
+   \return Reference to the reachable state flag
+   */
+  bool & reachable();
+
+  /*!
+   \brief Accessor
+   \return true if a satisfying state is reachable, false otherwise
+   */
+  bool reachable() const;
+
+  /*!
+   \brief Accessor
+   \return Reference to the description of the winning instance
+   */
+  std::string & winner();
+
+  /*!
+   \brief Accessor
+   \return Description of the winning instance
+   */
+  std::string const & winner() const;
+
+  /*!
+   \brief Accessor
+   \return Reference to the statistics of the winning instance
+   */
+  std::map<std::string, std::string> & winner_attributes();
+
+  /*!
+   \brief Accessor
+   \return Statistics of the winning instance
+   */
+  std::map<std::string, std::string> const & winner_attributes() const;
+
+  /*!
+   \brief Accessor
+   \return Reference to the prefix of attribute names specific to the race
+   ("SWARM" by default)
+   */
+  std::string & prefix();
+
+  /*!
+   \brief Accessor
+   \return Prefix of attribute names specific to the race
+   */
+  std::string const & prefix() const;
+
+  /*!
+   \brief Extract statistics as attributes (key, value)
+   \param m : attributes map
+   \post every statistics has been added to m
+   */
+  void attributes(std::map<std::string, std::string> & m) const;
+
+private:
+  std::string _prefix;                                   /*!< Prefix of race attributes */
+  unsigned long _instances;                              /*!< Number of instances */
+  bool _reachable;                                       /*!< Reachability of labels */
+  std::string _winner;                                   /*!< Description of the winning instance */
+  std::map<std::string, std::string> _winner_attributes; /*!< Statistics of the winning instance */
+};
+
+} // namespace swarm
+
+} // end of namespace algorithms
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_ALGORITHMS_SWARM_STATS_HH
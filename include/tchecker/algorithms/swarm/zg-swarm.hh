@@ -0,0 +1,248 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_ZG_SWARM_ALGORITHM_HH
+#define TCHECKER_ZG_SWARM_ALGORITHM_HH
+
+/*!
+ \file zg-swarm.hh
+ \brief Swarm verification and portfolio: diversified reachability searches
+ run in parallel
+*/
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "tchecker/algorithms/covreach/algorithm.hh"
+#include "tchecker/algorithms/swarm/stats.hh"
+#include "tchecker/parsing/declaration.hh"
+
+namespace tchecker {
+
+namespace algorithms {
+
+namespace zg_swarm {
+
+/*!
+ \brief Type of reachability engines
+ */
+enum engine_t {
+  ENGINE_REACH,        /*!< Reachability algorithm */
+  ENGINE_COVREACH,     /*!< Covering reachability algorithm */
+  ENGINE_ALU_COVREACH, /*!< Covering reachability algorithm with aLU subsumption */
+  ENGINE_CONCUR19,     /*!< Covering reachability algorithm over the local-time zone graph */
+};
+
+/*!
+ \brief Accessor
+ \param engine : reachability engine
+ \return name of engine
+ */
+std::string to_string(enum tchecker::algorithms::zg_swarm::engine_t engine);
+
+/*!
+ \class instance_t
+ \brief One search of a swarm or of a portfolio
+ \note Each instance owns its system, zone graph and graph, hence instances do
+ not share any state and can be run in separate threads
+ */
+class instance_t {
+public:
+  /*!
+   \brief Constructor
+   \param engine : reachability engine
+   \param search_order : search order
+   \param seed : seed of edge order randomization
+   */
+  instance_t(enum tchecker::algorithms::zg_swarm::engine_t engine, std::string const & search_order, unsigned int seed);
+
+  /*!
+   \brief Destructor
+   */
+  virtual ~instance_t() = default;
+
+  /*!
+   \brief Accessor
+   \return reachability engine
+   */
+  inline enum tchecker::algorithms::zg_swarm::engine_t engine() const { return _engine; }
+
+  /*!
+   \brief Accessor
+   \return search order
+   */
+  inline std::string const & search_order() const { return _search_order; }
+
+  /*!
+   \brief Accessor
+   \return seed of edge order randomization (0 if edges are not shuffled)
+   */
+  inline unsigned int seed() const { return _seed; }
+
+  /*!
+   \brief Accessor
+   \return description of this instance: engine, search order and seed
+   */
+  std::string description() const;
+
+  /*!
+   \brief Run the search
+   \param cancel : cancellation flag
+   \post the search has been run until it has found a state satisfying the
+   labels, or it has explored the entire state-space, or cancel has been set
+   \return true if the search has terminated, false if it has been cancelled
+   \note this method is meant to be called from a dedicated thread, while
+   cancel is set from another thread
+   */
+  virtual bool run(std::atomic<bool> const & cancel) = 0;
+
+  /*!
+   \brief Accessor
+   \pre run() has returned true
+   \return true if a state satisfying the labels has been reached, false otherwise
+   */
+  virtual bool reachable() const = 0;
+
+  /*!
+   \brief Extract statistics of last run as attributes (key, value)
+   \param m : attributes map
+   \post every statistics has been added to m
+   */
+  virtual void attributes(std::map<std::string, std::string> & m) const = 0;
+
+  /*!
+   \brief Graph output
+   \param os : output stream
+   \param name : graph name
+   \post the graph explored by this instance has been output to os
+   */
+  virtual void dot_graph(std::ostream & os, std::string const & name) = 0;
+
+  /*!
+   \brief Symbolic counter-example output
+   \param os : output stream
+   \param name : counter-example name
+   \pre reachable()
+   \post a symbolic counter-example has been output to os
+   \throw std::runtime_error : if no counter-example can be computed
+   */
+  virtual void dot_symbolic_counter_example(std::ostream & os, std::string const & name) = 0;
+
+  /*!
+   \brief Concrete counter-example output
+   \param os : output stream
+   \param name : counter-example name
+   \pre reachable()
+   \post a concrete counter-example has been output to os
+   \throw std::runtime_error : if no counter-example can be computed
+   */
+  virtual void dot_concrete_counter_example(std::ostream & os, std::string const & name) = 0;
+
+private:
+  enum tchecker::algorithms::zg_swarm::engine_t _engine; /*!< Reachability engine */
+  std::string _search_order;                             /*!< Search order */
+  unsigned int _seed;                                    /*!< Seed of edge order randomization */
+};
+
+/*!
+ \brief Build an instance
+ \param engine : reachability engine
+ \param sysdecl : system declaration
+ \param labels : comma-separated string of labels
+ \param search_order : search order
+ \param seed : seed of edge order randomization, 0 to keep the order of edges
+ \param covering : covering policy (covering reachability engines only)
+ \param block_size : number of elements allocated in one block
+ \param table_size : size of hash tables
+ \pre labels must appear as node attributes in sysdecl
+ search_order must be either "dfs" or "bfs"
+ \return an instance that runs engine with search_order on the zone graph of
+ sysdecl with outgoing edges shuffled w.r.t. seed
+ \throw std::invalid_argument : if search_order is not "bfs" or "dfs", or if
+ seed is not 0 for engine ENGINE_CONCUR19
+ \note the instance is built in the calling thread
+ \note instances of ENGINE_CONCUR19 run on the local-time zone graph, they do
+ not provide concrete counter-examples
+ */
+std::shared_ptr<tchecker::algorithms::zg_swarm::instance_t>
+make_instance(enum tchecker::algorithms::zg_swarm::engine_t engine,
+              std::shared_ptr<tchecker::parsing::system_declaration_t> const & sysdecl, std::string const & labels,
+              std::string const & search_order, unsigned int seed, tchecker::algorithms::covreach::covering_t covering,
+              std::size_t block_size, std::size_t table_size);
+
+/*!
+ \brief Run instances in parallel until one of them terminates
+ \param instances : instances
+ \pre instances is not empty
+ \post every instance has been run in its own thread. All instances have been
+ cancelled as soon as one instance has terminated
+ \return statistics on the race and the first instance that terminated
+ \throw std::invalid_argument : if instances is empty
+ \note if no instance terminates, the first exception thrown by an instance is
+ rethrown
+ */
+std::tuple<tchecker::algorithms::swarm::stats_t, std::shared_ptr<tchecker::algorithms::zg_swarm::instance_t>>
+race(std::vector<std::shared_ptr<tchecker::algorithms::zg_swarm::instance_t>> const & instances);
+
+/*!
+ \brief Run swarm verification on the zone graph of a system
+ \param sysdecl : system declaration
+ \param labels : comma-separated string of labels
+ \param instances : number of instances
+ \param engines : reachability engines
+ \param covering : covering policy (covering reachability engines only)
+ \param block_size : number of elements allocated in one block
+ \param table_size : size of hash tables
+ \pre labels must appear as node attributes in sysdecl
+ engines does not contain ENGINE_CONCUR19 (edges cannot be shuffled for concur19)
+ \return statistics on the run and the instance that terminated first
+ \throw std::invalid_argument : if instances is 0 or engines is empty
+ \note with n engines, instance i runs engine engines[i % n] with search order
+ bfs if (i / n) is even and dfs otherwise, and edges shuffled with seed i
+ (instance 0 keeps the order of edges). Hence, the first 2n instances cover all
+ combinations of engines and search orders
+ */
+std::tuple<tchecker::algorithms::swarm::stats_t, std::shared_ptr<tchecker::algorithms::zg_swarm::instance_t>>
+run(std::shared_ptr<tchecker::parsing::system_declaration_t> const & sysdecl, std::string const & labels,
+    std::size_t instances, std::vector<enum tchecker::algorithms::zg_swarm::engine_t> const & engines,
+    tchecker::algorithms::covreach::covering_t covering = tchecker::algorithms::covreach::COVERING_FULL,
+    std::size_t block_size = 10000, std::size_t table_size = 65536);
+
+/*!
+ \brief Run a portfolio of reachability engines on a system
+ \param sysdecl : system declaration
+ \param labels : comma-separated string of labels
+ \param engines : reachability engines
+ \param search_order : search order
+ \param covering : covering policy (covering reachability engines only)
+ \param block_size : number of elements allocated in one block
+ \param table_size : size of hash tables
+ \pre labels must appear as node attributes in sysdecl
+ search_order must be either "dfs" or "bfs"
+ \return statistics on the run and the instance of the engine that terminated
+ first
+ \throw std::invalid_argument : if engines is empty
+ \note each engine runs with search_order, and without shuffling edges
+ */
+std::tuple<tchecker::algorithms::swarm::stats_t, std::shared_ptr<tchecker::algorithms::zg_swarm::instance_t>>
+portfolio(std::shared_ptr<tchecker::parsing::system_declaration_t> const & sysdecl, std::string const & labels,
+          std::vector<enum tchecker::algorithms::zg_swarm::engine_t> const & engines, std::string const & search_order,
+          tchecker::algorithms::covreach::covering_t covering = tchecker::algorithms::covreach::COVERING_FULL,
+          std::size_t block_size = 10000, std::size_t table_size = 65536);
+
+} // namespace zg_swarm
+
+} // namespace algorithms
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_ZG_SWARM_ALGORITHM_HH
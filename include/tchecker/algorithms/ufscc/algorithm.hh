@@ -0,0 +1,402 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_ALGORITHMS_UFSCC_ALGORITHM_HH
+#define TCHECKER_ALGORITHMS_UFSCC_ALGORITHM_HH
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <exception>
+#include <memory>
+#include <random>
+#include <stack>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <boost/dynamic_bitset.hpp>
+
+#include "tchecker/algorithms/ufscc/stats.hh"
+#include "tchecker/algorithms/ufscc/store.hh"
+#include "tchecker/utils/progress.hh"
+
+/*!
+ \file algorithm.hh
+ \brief Parallel union-find SCC-based liveness algorithm (UFSCC)
+ */
+
+namespace tchecker {
+
+namespace algorithms {
+
+namespace ufscc {
+
+/*!
+ \class algorithm_t
+ \brief Multi-core SCC-based liveness algorithm for generalized Büchi conditions
+ \tparam TS : type of transition system, should implement tchecker::ts::fwd_t
+ and tchecker::ts::inspector_t
+ \tparam STATE_HASH : value-based hash functor on TS::state_t
+ \tparam STATE_EQUAL : value-based equality predicate on TS::state_t
+ \tparam STATE_COPY : functor that copies a state computed by a transition
+ system into another transition system of the same type
+ \note Implementation based on the algorithm in:
+ "Multi-Core On-The-Fly SCC Decomposition",
+ Vincent Bloemen, Alfons Laarman and Jaco van de Pol
+ PPoPP 2016
+
+ Each worker p runs a DFS from the initial states with its own transition
+ system and its own random order on successors. The workers share a store of
+ states partitioned by a union-find structure into strongly connected sets.
+ The algorithm below works for generalized Büchi conditions: the labels of a
+ set are the union of the labels of its states.
+
+ procedure ufscc_p(v)
+   push(Roots_p, v)
+   while (v' := pick_from_set(v)) != null do
+     for each w in post(v') (in random order)
+       if dead(w) then
+         continue
+       else if claim(w, p) = SUCCESS then
+         ufscc_p(w)
+       else
+         while not same_set(v, w) do
+           r := pop(Roots_p)
+           union(r, top(Roots_p))
+         if labels(w) is accepting then
+           report cycle
+     done(v')
+   if v = top(Roots_p) then
+     mark_dead(v)
+     pop(Roots_p)
+
+ Successors are computed by each worker on its own copy of the picked state,
+ so transition systems do not need to be thread-safe. Only a completely
+ explored set is marked dead, hence a set explored by several workers stays
+ alive until all its states have been expanded.
+ */
+template <class TS, class STATE_HASH, class STATE_EQUAL, class STATE_COPY> class algorithm_t {
+public:
+  /*!
+   \brief Type of states
+   */
+  using state_t = typename TS::state_t;
+
+  /*!
+   \brief Type of const states
+   */
+  using const_state_t = typename TS::const_state_t;
+
+  /*!
+   \brief Type of store
+   */
+  using store_t = tchecker::algorithms::ufscc::store_t<state_t, STATE_HASH, STATE_EQUAL>;
+
+  /*!
+   \brief Type of nodes
+   */
+  using node_t = typename store_t::node_t;
+
+  /*!
+   \brief Check if a transition system has an infinite run that satisfies a
+   given set of labels
+   \param ts : transition systems, one for each worker, all over the same system
+   \param labels : accepting labels
+   \param table_size : size of hash tables
+   \param progress : progress counters (nullptr for no progress reporting)
+   \pre ts is not empty, and it has at most tchecker::algorithms::ufscc::MAX_WORKERS
+   elements. All elements in ts are distinct transition systems
+   \post the state-space of ts has been explored in parallel until a cycle that
+   satisfies labels is found (if any)
+   \return statistics on the run
+   \throw std::invalid_argument : if the number of transition systems is not
+   in the expected range
+   \note if labels is empty, the full state-space of ts is explored
+   \note exceptions raised by workers are propagated after all workers have
+   stopped
+   \note with progress, each worker publishes the numbers of visited and stored
+   states, and of nodes on the DFS stacks, summed over all workers, every
+   tchecker::PROGRESS_PERIOD states it visits
+   */
+  tchecker::algorithms::ufscc::stats_t run(std::vector<std::shared_ptr<TS>> const & ts, boost::dynamic_bitset<> const & labels,
+                                           std::size_t table_size, tchecker::progress_t * progress = nullptr)
+  {
+    if (ts.empty() || ts.size() > tchecker::algorithms::ufscc::MAX_WORKERS)
+      throw std::invalid_argument("*** tchecker::algorithms::ufscc::algorithm_t: unsupported number of workers");
+
+    tchecker::algorithms::ufscc::stats_t stats;
+
+    stats.set_start_time();
+
+    std::size_t const workers = ts.size();
+    store_t store(4 * workers, table_size);
+    std::atomic<bool> stop{false};
+    std::atomic<bool> cycle{false};
+    std::vector<worker_stats_t> worker_stats(workers);
+    std::vector<std::exception_ptr> errors(workers, nullptr);
+
+    _progress = progress;
+    _worker_stats = &worker_stats;
+
+    std::vector<std::thread> threads;
+    for (worker_id_t w = 0; w < workers; ++w)
+      threads.emplace_back([&, w]() {
+        try {
+          worker(*ts[w], w, store, labels, stop, cycle, worker_stats[w]);
+        }
+        catch (...) {
+          errors[w] = std::current_exception();
+          stop = true;
+        }
+      });
+
+    for (std::thread & t : threads)
+      t.join();
+    _worker_stats = nullptr;
+
+    for (std::exception_ptr & e : errors)
+      if (e != nullptr)
+        std::rethrow_exception(e);
+
+    for (worker_stats_t const & ws : worker_stats) {
+      stats.visited_states() += ws.visited_states;
+      stats.visited_transitions() += ws.visited_transitions;
+    }
+    stats.stored_states() = store.size();
+    stats.threads() = static_cast<unsigned int>(workers);
+    stats.cycle() = cycle;
+
+    if (_progress != nullptr)
+      _progress->publish(stats.visited_states(), stats.stored_states(), 0, 0);
+
+    stats.set_end_time();
+
+    return stats;
+  }
+
+private:
+  /*!
+   \class worker_stats_t
+   \brief Statistics of a worker
+   \note each worker updates its own statistics, they are summed up when all
+   workers have stopped. Progress counters are copies of the statistics of the
+   worker that can be read by other workers
+   */
+  struct worker_stats_t {
+    unsigned long visited_states{0};                /*!< Number of visited states */
+    unsigned long visited_transitions{0};           /*!< Number of visited transitions */
+    unsigned long stored_states{0};                 /*!< Number of states added to the store */
+    std::atomic<unsigned long> progress_visited{0}; /*!< Number of visited states for progress */
+    std::atomic<unsigned long> progress_stored{0};  /*!< Number of states added to the store for progress */
+    std::atomic<unsigned long> progress_waiting{0}; /*!< Size of the DFS stack for progress */
+  };
+
+  /*!
+   \class frame_t
+   \brief Entry of the DFS stack of a worker
+   */
+  struct frame_t {
+    node_t * n;                /*!< Node for which the search has been called */
+    node_t * picked;           /*!< Node from the set of n that is being expanded */
+    std::vector<node_t *> succ; /*!< Successors of picked */
+    std::size_t next;          /*!< Index of next successor to explore in succ */
+  };
+
+  /*!
+   \brief Worker
+   \param ts : transition system of the worker
+   \param w : worker identifier
+   \param store : shared store
+   \param labels : accepting labels
+   \param stop : stop flag
+   \param cycle : accepting cycle flag
+   \param stats : statistics of the worker
+   \post worker w has searched for an accepting cycle from the initial states
+   of ts, until one has been found by some worker, or stop has been set
+   */
+  void worker(TS & ts, tchecker::algorithms::ufscc::worker_id_t w, store_t & store, boost::dynamic_bitset<> const & labels,
+              std::atomic<bool> & stop, std::atomic<bool> & cycle, worker_stats_t & stats)
+  {
+    std::minstd_rand gen(w + 1);
+
+    std::vector<typename TS::sst_t> sst;
+    ts.initial(sst);
+    std::vector<node_t *> initial_nodes;
+    for (auto && [status, s, t] : sst) {
+      auto && [is_new, n] = store.find_else_add(s, ts.labels(const_state_t{s}), w);
+      if (is_new)
+        ++stats.stored_states;
+      initial_nodes.push_back(n);
+    }
+    sst.clear();
+
+    if (w > 0)
+      std::shuffle(initial_nodes.begin(), initial_nodes.end(), gen);
+
+    for (node_t * n : initial_nodes) {
+      if (stop.load(std::memory_order_relaxed))
+        break;
+      if (store.claim(n, w) == tchecker::algorithms::ufscc::CLAIM_SUCCESS)
+        dfs(n, ts, w, store, labels, stop, cycle, stats, gen);
+    }
+  }
+
+  /*!
+   \brief DFS loop of a worker
+   \param n : a node
+   \param ts : transition system of the worker
+   \param w : worker identifier
+   \param store : shared store
+   \param labels : accepting labels
+   \param stop : stop flag
+   \param cycle : accepting cycle flag
+   \param stats : statistics of the worker
+   \param gen : random number generator of the worker
+   \pre n has been claimed by worker w
+   \post the states reachable from n have been explored by worker w, and their
+   sets have been marked dead, unless an accepting cycle has been found, or stop
+   has been set. cycle and stop are set if an accepting cycle has been found
+   */
+  void dfs(node_t * n, TS & ts, tchecker::algorithms::ufscc::worker_id_t w, store_t & store,
+           boost::dynamic_bitset<> const & labels, std::atomic<bool> & stop, std::atomic<bool> & cycle,
+           worker_stats_t & stats, std::minstd_rand & gen)
+  {
+    std::stack<node_t *> roots;
+    std::stack<frame_t> todo;
+
+    roots.push(n);
+    todo.push(frame_t{n, nullptr, {}, 0});
+    ++stats.visited_states;
+    publish_progress(stats, todo.size());
+
+    while (!todo.empty()) {
+      if (stop.load(std::memory_order_relaxed))
+        return;
+
+      frame_t & f = todo.top();
+
+      if (f.next == f.succ.size()) {
+        if (f.picked != nullptr)
+          store.set_done(f.picked);
+        f.picked = store.pick(f.n, gen);
+        if (f.picked == nullptr) {
+          if (roots.top() == f.n) {
+            store.set_dead(f.n);
+            roots.pop();
+          }
+          todo.pop();
+        }
+        else {
+          f.succ = expand(f.picked, ts, w, store, stats, gen);
+          f.next = 0;
+        }
+        continue;
+      }
+
+      node_t * t = f.succ[f.next];
+      ++f.next;
+
+      enum tchecker::algorithms::ufscc::claim_status_t status = store.claim(t, w);
+      if (status == tchecker::algorithms::ufscc::CLAIM_SUCCESS) {
+        roots.push(t);
+        todo.push(frame_t{t, nullptr, {}, 0});
+        ++stats.visited_states;
+        publish_progress(stats, todo.size());
+      }
+      else if (status == tchecker::algorithms::ufscc::CLAIM_FOUND) {
+        while (!store.same_set(f.n, t)) {
+          node_t * r = roots.top();
+          roots.pop();
+          assert(!roots.empty());
+          store.unite(r, roots.top());
+        }
+        if (store.accepting(t, labels)) {
+          cycle = true;
+          stop = true;
+          return;
+        }
+      }
+    }
+  }
+
+  /*!
+   \brief Compute successor nodes
+   \param n : a node
+   \param ts : transition system of the worker
+   \param w : worker identifier
+   \param store : shared store
+   \param stats : statistics of the worker
+   \param gen : random number generator of the worker
+   \return successor nodes of n, in random order if w is not 0
+   \post all successor states of n have been added to store (if not yet in)
+   \note the state in n is copied into ts if it has been computed by another
+   worker
+   */
+  std::vector<node_t *> expand(node_t * n, TS & ts, tchecker::algorithms::ufscc::worker_id_t w, store_t & store,
+                               worker_stats_t & stats, std::minstd_rand & gen)
+  {
+    state_t s = (n->owner() == w ? n->state() : _state_copy(ts, n->state()));
+
+    std::vector<node_t *> next_nodes;
+    std::vector<typename TS::sst_t> v;
+    ts.next(const_state_t{s}, v);
+    for (auto && [status, nexts, t] : v) {
+      ++stats.visited_transitions;
+      auto && [is_new, nextn] = store.find_else_add(nexts, ts.labels(const_state_t{nexts}), w);
+      if (is_new)
+        ++stats.stored_states;
+      next_nodes.push_back(nextn);
+    }
+
+    if (w > 0)
+      std::shuffle(next_nodes.begin(), next_nodes.end(), gen);
+
+    return next_nodes;
+  }
+
+  /*!
+   \brief Publish progress
+   \param stats : statistics of a worker
+   \param waiting : size of the DFS stack of the worker
+   \post if there are progress counters, and if the number of states visited by
+   the worker is a multiple of tchecker::PROGRESS_PERIOD, the progress counters
+   of the worker have been updated, and the sums of the progress counters of
+   all workers have been published
+   \note the sums may mix counters of workers taken at different times, which
+   is fine for progress reporting
+   */
+  void publish_progress(worker_stats_t & stats, std::size_t waiting)
+  {
+    if ((_progress == nullptr) || (stats.visited_states % tchecker::PROGRESS_PERIOD != 0))
+      return;
+
+    stats.progress_visited.store(stats.visited_states, std::memory_order_relaxed);
+    stats.progress_stored.store(stats.stored_states, std::memory_order_relaxed);
+    stats.progress_waiting.store(waiting, std::memory_order_relaxed);
+
+    unsigned long visited = 0, stored = 0, all_waiting = 0;
+    for (worker_stats_t const & ws : *_worker_stats) {
+      visited += ws.progress_visited.load(std::memory_order_relaxed);
+      stored += ws.progress_stored.load(std::memory_order_relaxed);
+      all_waiting += ws.progress_waiting.load(std::memory_order_relaxed);
+    }
+    _progress->publish(visited, stored, all_waiting, 0);
+  }
+
+  STATE_COPY _state_copy;                               /*!< State copy functor */
+  tchecker::progress_t * _progress{nullptr};            /*!< Progress counters (nullptr if none) */
+  std::vector<worker_stats_t> * _worker_stats{nullptr}; /*!< Statistics of workers during a run */
+};
+
+} // namespace ufscc
+
+} // namespace algorithms
+
+} // namespace tchecker
+
+#endif // TCHECKER_ALGORITHMS_UFSCC_ALGORITHM_HH
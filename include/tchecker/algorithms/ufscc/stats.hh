@@ -0,0 +1,68 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_ALGORITHMS_UFSCC_STATS_HH
+#define TCHECKER_ALGORITHMS_UFSCC_STATS_HH
+
+#include <map>
+#include <string>
+
+#include "tchecker/algorithms/couvreur_scc/stats.hh"
+
+/*!
+ \file stats.hh
+ \brief Statistics for the parallel union-find SCC algorithm
+ */
+
+namespace tchecker {
+
+namespace algorithms {
+
+namespace ufscc {
+
+/*!
+ \class stats_t
+ \brief Statistics for the parallel union-find SCC algorithm
+ \note visited states and visited transitions are summed over all workers
+ */
+class stats_t : public tchecker::algorithms::couvscc::stats_t {
+public:
+  /*!
+   \brief Constructor
+   */
+  stats_t();
+
+  /*!
+   \brief Accessor
+   \return A reference to the number of worker threads
+   */
+  unsigned int & threads();
+
+  /*!
+   \brief Accessor
+   \return The number of worker threads
+   */
+  unsigned int threads() const;
+
+  /*!
+   \brief Extract statistics as attributes (key, value)
+   \param m : attributes map
+   \post every statistics has been added to m
+  */
+  void attributes(std::map<std::string, std::string> & m) const;
+
+private:
+  unsigned int _threads; /*!< Number of worker threads */
+};
+
+} // namespace ufscc
+
+} // end of namespace algorithms
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_ALGORITHMS_UFSCC_STATS_HH
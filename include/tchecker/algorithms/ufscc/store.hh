@@ -0,0 +1,369 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_ALGORITHMS_UFSCC_STORE_HH
+#define TCHECKER_ALGORITHMS_UFSCC_STORE_HH
+
+#include <cassert>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <random>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/dynamic_bitset.hpp>
+
+/*!
+ \file store.hh
+ \brief Concurrent state store and union-find structure for the UFSCC liveness algorithm
+ */
+
+namespace tchecker {
+
+namespace algorithms {
+
+namespace ufscc {
+
+/*!
+ \brief Type of worker identifiers
+ */
+using worker_id_t = unsigned int;
+
+/*!
+ \brief Maximal number of workers (size of worker sets in union-find nodes)
+ */
+constexpr worker_id_t const MAX_WORKERS = 64;
+
+/*!
+ \brief Status of a claim on a node
+ */
+enum claim_status_t {
+  CLAIM_DEAD,    /*!< The node belongs to a completely explored SCC */
+  CLAIM_FOUND,   /*!< The node has already been claimed by the worker */
+  CLAIM_SUCCESS, /*!< The node has been claimed by the worker */
+};
+
+/*!
+ \class node_t
+ \brief Node of the shared store: state and union-find information
+ \tparam STATE : type of states
+ \note All union-find fields are protected by the mutex in the store that owns
+ the node. The state and its labels are immutable once the node has been
+ inserted in the store
+ */
+template <class STATE> class node_t {
+public:
+  /*!
+   \brief Constructor
+   \param state : a state
+   \param labels : labels of state
+   \param owner : identifier of the worker that has computed state
+   \post this node is the root of a singleton set with no worker, it is not
+   dead and it is the only busy node in its set
+   */
+  node_t(STATE const & state, boost::dynamic_bitset<> const & labels, tchecker::algorithms::ufscc::worker_id_t owner)
+      : _state(state), _owner(owner), _parent(this), _workers(0), _dead(false), _done(false), _labels(labels), _busy(1, this)
+  {
+  }
+
+  /*!
+   \brief Copy constructor (deleted)
+   */
+  node_t(tchecker::algorithms::ufscc::node_t<STATE> const &) = delete;
+
+  /*!
+   \brief Assignment operator (deleted)
+   */
+  tchecker::algorithms::ufscc::node_t<STATE> & operator=(tchecker::algorithms::ufscc::node_t<STATE> const &) = delete;
+
+  /*!
+   \brief Accessor
+   \return state in this node
+   \note the returned state has been computed by worker owner(). Only this
+   worker is allowed to copy the returned pointer
+   */
+  inline STATE const & state() const { return _state; }
+
+  /*!
+   \brief Accessor
+   \return identifier of the worker that has computed the state in this node
+   */
+  inline tchecker::algorithms::ufscc::worker_id_t owner() const { return _owner; }
+
+private:
+  template <class S, class H, class E> friend class store_t;
+
+  STATE _state;                                   /*!< State */
+  tchecker::algorithms::ufscc::worker_id_t _owner; /*!< Worker that computed the state */
+  node_t<STATE> * _parent;                        /*!< Parent in union-find structure */
+  std::uint64_t _workers;                         /*!< Set of workers exploring the set (root only) */
+  bool _dead;                                     /*!< Dead set flag (root only) */
+  bool _done;                                     /*!< Flag for nodes with completely explored successors */
+  boost::dynamic_bitset<> _labels;                /*!< Labels in the set (root only) */
+  std::vector<node_t<STATE> *> _busy;             /*!< Nodes in the set that may not be done (root only) */
+};
+
+/*!
+ \class store_t
+ \brief Concurrent store of states with union-find partition into strongly
+ connected sets
+ \tparam STATE : type of states
+ \tparam STATE_HASH : hash functor on STATE
+ \tparam STATE_EQUAL : equality predicate on STATE
+ \note States are hashed and compared by value, since they may have been
+ computed by different workers that do not share their components.
+ The hash table is split into independently locked shards. The union-find
+ structure is protected by a single mutex: critical sections are short
+ compared to successor computations on zones
+ */
+template <class STATE, class STATE_HASH, class STATE_EQUAL> class store_t {
+public:
+  /*!
+   \brief Type of nodes
+   */
+  using node_t = tchecker::algorithms::ufscc::node_t<STATE>;
+
+  /*!
+   \brief Constructor
+   \param shards : number of shards in the hash table
+   \param table_size : initial number of buckets per shard
+   \pre shards > 0
+   */
+  store_t(std::size_t shards, std::size_t table_size) : _shards(shards)
+  {
+    assert(shards > 0);
+    for (shard_t & shard : _shards)
+      shard.table.reserve(table_size / shards + 1);
+  }
+
+  /*!
+   \brief Copy constructor (deleted)
+   */
+  store_t(tchecker::algorithms::ufscc::store_t<STATE, STATE_HASH, STATE_EQUAL> const &) = delete;
+
+  /*!
+   \brief Assignment operator (deleted)
+   */
+  tchecker::algorithms::ufscc::store_t<STATE, STATE_HASH, STATE_EQUAL> &
+  operator=(tchecker::algorithms::ufscc::store_t<STATE, STATE_HASH, STATE_EQUAL> const &) = delete;
+
+  /*!
+   \brief Destructor
+   \pre no worker is accessing the store anymore
+   */
+  ~store_t() = default;
+
+  /*!
+   \brief Find or add a node
+   \param s : a state
+   \param labels : labels of s
+   \param owner : worker that has computed s
+   \return (true, n) with n a new node for s if the store did not contain a
+   node with a state equal to s, (false, n) with n the node in the store that
+   has a state equal to s otherwise
+   */
+  std::tuple<bool, node_t *> find_else_add(STATE const & s, boost::dynamic_bitset<> const & labels,
+                                           tchecker::algorithms::ufscc::worker_id_t owner)
+  {
+    std::size_t h = _hash(s);
+    shard_t & shard = _shards[h % _shards.size()];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto && [first, last] = shard.table.equal_range(h);
+    for (auto it = first; it != last; ++it)
+      if (_equal(it->second->state(), s))
+        return std::make_tuple(false, it->second);
+    node_t * n = &shard.nodes.emplace_back(s, labels, owner);
+    shard.table.emplace(h, n);
+    return std::make_tuple(true, n);
+  }
+
+  /*!
+   \brief Accessor
+   \return number of nodes in the store
+   \note not synchronized with concurrent insertions
+   */
+  std::size_t size() const
+  {
+    std::size_t size = 0;
+    for (shard_t const & shard : _shards)
+      size += shard.nodes.size();
+    return size;
+  }
+
+  /*!
+   \brief Claim a node for a worker
+   \param n : a node
+   \param w : a worker
+   \pre w < tchecker::algorithms::ufscc::MAX_WORKERS
+   \post w has been added to the workers of the set of n if the set is not dead
+   \return tchecker::algorithms::ufscc::CLAIM_DEAD if the set of n is dead,
+   tchecker::algorithms::ufscc::CLAIM_FOUND if w was already exploring the set
+   of n, tchecker::algorithms::ufscc::CLAIM_SUCCESS otherwise
+   */
+  enum tchecker::algorithms::ufscc::claim_status_t claim(node_t * n, tchecker::algorithms::ufscc::worker_id_t w)
+  {
+    std::lock_guard<std::mutex> lock(_uf_mutex);
+    node_t * r = find(n);
+    if (r->_dead)
+      return tchecker::algorithms::ufscc::CLAIM_DEAD;
+    std::uint64_t const mask = (std::uint64_t{1} << w);
+    if (r->_workers & mask)
+      return tchecker::algorithms::ufscc::CLAIM_FOUND;
+    r->_workers |= mask;
+    return tchecker::algorithms::ufscc::CLAIM_SUCCESS;
+  }
+
+  /*!
+   \brief Dead set predicate
+   \param n : a node
+   \return true if the set of n is dead, false otherwise
+   */
+  bool is_dead(node_t * n)
+  {
+    std::lock_guard<std::mutex> lock(_uf_mutex);
+    return find(n)->_dead;
+  }
+
+  /*!
+   \brief Same set predicate
+   \param n1 : a node
+   \param n2 : a node
+   \return true if n1 and n2 are in the same set, false otherwise
+   */
+  bool same_set(node_t * n1, node_t * n2)
+  {
+    std::lock_guard<std::mutex> lock(_uf_mutex);
+    return find(n1) == find(n2);
+  }
+
+  /*!
+   \brief Merge two sets
+   \param n1 : a node
+   \param n2 : a node
+   \post the sets of n1 and n2 have been merged. The merged set has the union
+   of workers, labels and busy nodes of both sets
+   */
+  void unite(node_t * n1, node_t * n2)
+  {
+    std::lock_guard<std::mutex> lock(_uf_mutex);
+    node_t * r1 = find(n1);
+    node_t * r2 = find(n2);
+    if (r1 == r2)
+      return;
+    if (r1->_busy.size() < r2->_busy.size())
+      std::swap(r1, r2);
+    r2->_parent = r1;
+    r1->_workers |= r2->_workers;
+    r1->_labels |= r2->_labels;
+    r1->_busy.insert(r1->_busy.end(), r2->_busy.begin(), r2->_busy.end());
+    r2->_busy.clear();
+    r2->_busy.shrink_to_fit();
+  }
+
+  /*!
+   \brief Accepting set predicate
+   \param n : a node
+   \param labels : accepting labels
+   \return true if labels is not empty and all labels in labels appear in the
+   set of n, false otherwise
+   */
+  bool accepting(node_t * n, boost::dynamic_bitset<> const & labels)
+  {
+    if (labels.none())
+      return false;
+    std::lock_guard<std::mutex> lock(_uf_mutex);
+    return labels.is_subset_of(find(n)->_labels);
+  }
+
+  /*!
+   \brief Pick a busy node in a set
+   \param n : a node
+   \param gen : random number generator
+   \return a node in the set of n that is not done if any, nullptr otherwise
+   \note nodes that are done are removed from the set of busy nodes
+   */
+  node_t * pick(node_t * n, std::minstd_rand & gen)
+  {
+    std::lock_guard<std::mutex> lock(_uf_mutex);
+    std::vector<node_t *> & busy = find(n)->_busy;
+    while (!busy.empty()) {
+      std::size_t i = gen() % busy.size();
+      if (!busy[i]->_done)
+        return busy[i];
+      busy[i] = busy.back();
+      busy.pop_back();
+    }
+    return nullptr;
+  }
+
+  /*!
+   \brief Mark a node done
+   \param n : a node
+   \post n is done: all its successors have been explored
+   */
+  void set_done(node_t * n)
+  {
+    std::lock_guard<std::mutex> lock(_uf_mutex);
+    n->_done = true;
+  }
+
+  /*!
+   \brief Mark a set dead
+   \param n : a node
+   \post the set of n is dead
+   */
+  void set_dead(node_t * n)
+  {
+    std::lock_guard<std::mutex> lock(_uf_mutex);
+    node_t * r = find(n);
+    r->_dead = true;
+    r->_busy.clear();
+    r->_busy.shrink_to_fit();
+  }
+
+private:
+  /*!
+   \brief Find the root of a set
+   \param n : a node
+   \pre _uf_mutex is held by the caller
+   \return root of the set of n
+   \post path from n to its root has been halved
+   */
+  node_t * find(node_t * n)
+  {
+    while (n->_parent != n) {
+      n->_parent = n->_parent->_parent;
+      n = n->_parent;
+    }
+    return n;
+  }
+
+  /*!
+   \class shard_t
+   \brief Independently locked part of the hash table
+   */
+  struct shard_t {
+    std::mutex mutex;                                      /*!< Lock */
+    std::unordered_multimap<std::size_t, node_t *> table;  /*!< Nodes indexed by hash value */
+    std::deque<node_t> nodes;                              /*!< Nodes (stable addresses) */
+  };
+
+  std::deque<shard_t> _shards; /*!< Shards of the hash table */
+  std::mutex _uf_mutex;        /*!< Lock on union-find structure */
+  STATE_HASH _hash;            /*!< Hash functor on states */
+  STATE_EQUAL _equal;          /*!< Equality predicate on states */
+};
+
+} // namespace ufscc
+
+} // namespace algorithms
+
+} // namespace tchecker
+
+#endif // TCHECKER_ALGORITHMS_UFSCC_STORE_HH
@@ -0,0 +1,114 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_ZG_UFSCC_ALGORITHM_HH
+#define TCHECKER_ZG_UFSCC_ALGORITHM_HH
+
+#include <string>
+
+#include "tchecker/algorithms/ufscc/algorithm.hh"
+#include "tchecker/algorithms/ufscc/stats.hh"
+#include "tchecker/parsing/declaration.hh"
+#include "tchecker/utils/progress.hh"
+#include "tchecker/zg/state.hh"
+#include "tchecker/zg/zg.hh"
+
+namespace tchecker {
+
+namespace algorithms {
+
+namespace zg_ufscc {
+
+/*!
+ \class state_hash_t
+ \brief Value-based hash functor on zone graph states
+ \note shared hash values cannot be used since workers do not share state
+ components
+ */
+class state_hash_t {
+public:
+  /*!
+   \brief Hash function
+   \param s : a state
+   \return hash value of the vloc, intval and zone in s
+   */
+  std::size_t operator()(tchecker::zg::state_sptr_t const & s) const;
+};
+
+/*!
+ \class state_equal_to_t
+ \brief Value-based equality predicate on zone graph states
+ */
+class state_equal_to_t {
+public:
+  /*!
+   \brief Equality predicate
+   \param s1 : a state
+   \param s2 : a state
+   \return true if s1 and s2 have equal vloc, intval and zone, false otherwise
+   */
+  bool operator()(tchecker::zg::state_sptr_t const & s1, tchecker::zg::state_sptr_t const & s2) const;
+};
+
+/*!
+ \class state_copy_t
+ \brief Copy of states between zone graphs
+ */
+class state_copy_t {
+public:
+  /*!
+   \brief Copy
+   \param zg : a zone graph
+   \param s : a state computed by another zone graph over the same system
+   \return a state of zg with same vloc, intval and zone as s
+   \note the reference counter of s is not modified
+   */
+  tchecker::zg::state_sptr_t operator()(tchecker::zg::zg_t & zg, tchecker::zg::state_sptr_t const & s) const;
+};
+
+/*!
+ \class algorithm_t
+ \brief Parallel union-find SCC-based liveness algorithm over the zone graph
+ with generalized Büchi conditions
+*/
+class algorithm_t
+    : public tchecker::algorithms::ufscc::algorithm_t<tchecker::zg::zg_t, tchecker::algorithms::zg_ufscc::state_hash_t,
+                                                      tchecker::algorithms::zg_ufscc::state_equal_to_t,
+                                                      tchecker::algorithms::zg_ufscc::state_copy_t> {
+public:
+  using tchecker::algorithms::ufscc::algorithm_t<
+      tchecker::zg::zg_t, tchecker::algorithms::zg_ufscc::state_hash_t, tchecker::algorithms::zg_ufscc::state_equal_to_t,
+      tchecker::algorithms::zg_ufscc::state_copy_t>::algorithm_t;
+};
+
+/*!
+ \brief Run the parallel union-find SCC algorithm on the zone graph of a system
+ \param sysdecl : system declaration
+ \param labels : comma-separated string of labels
+ \param threads : number of worker threads (0 means hardware concurrency)
+ \param block_size : number of elements allocated in one block
+ \param table_size : size of hash tables
+ \param progress : progress counters (nullptr for no progress reporting)
+ \pre labels must appear as node attributes in sysdecl
+ \return statistics on the run
+ \throw std::runtime_error : if clock bounds cannot be computed for the system modeled by sysdecl
+ \throw std::invalid_argument : if threads is greater than tchecker::algorithms::ufscc::MAX_WORKERS
+ \note each worker has its own system and zone graph, hence the memory used by
+ allocators grows with the number of threads
+ */
+tchecker::algorithms::ufscc::stats_t run(tchecker::parsing::system_declaration_t const & sysdecl,
+                                         std::string const & labels = "", std::size_t threads = 0,
+                                         std::size_t block_size = 10000, std::size_t table_size = 65536,
+                                         tchecker::progress_t * progress = nullptr);
+
+} // namespace zg_ufscc
+
+} // namespace algorithms
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_ZG_UFSCC_ALGORITHM_HH
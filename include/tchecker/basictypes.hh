@@ -225,6 +225,11 @@ bool valid_sync_id(tchecker::sync_id_t id);
  */
 using node_id_t = tchecker::id_t; // should be large enough
 
+/*!
+ \brief Type of words in bit-packed tuples of locations and valuations
+ */
+using packed_word_t = uint64_t;
+
 /*!
  \brief Strength of synchronization constraint
  */
@@ -60,6 +60,7 @@ public:
   using tchecker::ta::details::state_pool_allocator_t<STATE>::collect;
   using tchecker::ta::details::state_pool_allocator_t<STATE>::destruct_all;
   using tchecker::ta::details::state_pool_allocator_t<STATE>::memsize;
+  using tchecker::ta::details::state_pool_allocator_t<STATE>::memory_stats;
 
 protected:
   using tchecker::ta::details::state_pool_allocator_t<STATE>::construct_from_state;
@@ -99,6 +100,7 @@ public:
   using tchecker::syncprod::details::transition_pool_allocator_t<TRANSITION>::share;
   using tchecker::syncprod::details::transition_pool_allocator_t<TRANSITION>::destruct_all;
   using tchecker::syncprod::details::transition_pool_allocator_t<TRANSITION>::memsize;
+  using tchecker::syncprod::details::transition_pool_allocator_t<TRANSITION>::memory_stats;
 
 protected:
   using tchecker::syncprod::details::transition_pool_allocator_t<TRANSITION>::construct_from_transition;
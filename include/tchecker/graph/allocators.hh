@@ -10,6 +10,8 @@
 
 #include <tuple>
 
+#include "tchecker/utils/incremental_collector.hh"
+#include "tchecker/utils/memory_stats.hh"
 #include "tchecker/utils/pool.hh"
 #include "tchecker/utils/shared_objects.hh"
 
@@ -111,6 +113,44 @@ public:
    */
   std::size_t memsize() const { return _node_pool.memsize(); }
 
+  /*!
+   \brief Accumulate memory statistics
+   \param stats : memory statistics
+   \post the memory of nodes has been added to stats
+   */
+  void memory_stats(tchecker::memory_stats_t & stats) const
+  {
+    stats.add(tchecker::MEMORY_NODES, _node_pool.memsize(), _node_pool.livesize());
+  }
+
+  /*!
+   \brief Switch to concurrent mode
+   \param numa_local : whether memory is bound to the NUMA node of the thread
+   that allocates it
+   \pre no node has been allocated yet
+   \post nodes are allocated from per-thread pools (see
+   tchecker::pool_t::concurrent)
+   \throw std::logic_error : if the precondition is not satisfied
+   */
+  void concurrent(bool numa_local = false) { _node_pool.concurrent(numa_local); }
+
+  /*!
+   \brief Back memory by huge pages
+   \param huge_pages : huge pages mode
+   \pre no node has been allocated yet
+   \post nodes are allocated from memory backed by huge pages according to
+   huge_pages (see tchecker::pool_t::huge_pages)
+   \throw std::logic_error : if the precondition is not satisfied
+   */
+  void huge_pages(enum tchecker::huge_pages_t huge_pages) { _node_pool.huge_pages(huge_pages); }
+
+  /*!
+   \brief Enroll in an incremental garbage collector
+   \param collector : an incremental garbage collector
+   \post unused nodes are collected by collector
+   */
+  void enroll(tchecker::incremental_collector_t & collector) { collector.enroll(_node_pool); }
+
 protected:
   tchecker::pool_t<NODE> _node_pool; /*!< Pool of nodes */
 };
@@ -203,6 +243,44 @@ public:
    */
   std::size_t memsize() const { return _edge_pool.memsize(); }
 
+  /*!
+   \brief Accumulate memory statistics
+   \param stats : memory statistics
+   \post the memory of edges has been added to stats
+   */
+  void memory_stats(tchecker::memory_stats_t & stats) const
+  {
+    stats.add(tchecker::MEMORY_EDGES, _edge_pool.memsize(), _edge_pool.livesize());
+  }
+
+  /*!
+   \brief Switch to concurrent mode
+   \param numa_local : whether memory is bound to the NUMA node of the thread
+   that allocates it
+   \pre no edge has been allocated yet
+   \post edges are allocated from per-thread pools (see
+   tchecker::pool_t::concurrent)
+   \throw std::logic_error : if the precondition is not satisfied
+   */
+  void concurrent(bool numa_local = false) { _edge_pool.concurrent(numa_local); }
+
+  /*!
+   \brief Back memory by huge pages
+   \param huge_pages : huge pages mode
+   \pre no edge has been allocated yet
+   \post edges are allocated from memory backed by huge pages according to
+   huge_pages (see tchecker::pool_t::huge_pages)
+   \throw std::logic_error : if the precondition is not satisfied
+   */
+  void huge_pages(enum tchecker::huge_pages_t huge_pages) { _edge_pool.huge_pages(huge_pages); }
+
+  /*!
+   \brief Enroll in an incremental garbage collector
+   \param collector : an incremental garbage collector
+   \post unused edges are collected by collector
+   */
+  void enroll(tchecker::incremental_collector_t & collector) { collector.enroll(_edge_pool); }
+
 protected:
   tchecker::pool_t<EDGE> _edge_pool; /*!< Pool of edges */
 };
@@ -0,0 +1,594 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_GRAPH_BINARY_HH
+#define TCHECKER_GRAPH_BINARY_HH
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "tchecker/basictypes.hh"
+#include "tchecker/dbm/db.hh"
+#include "tchecker/syncprod/syncprod.hh"
+#include "tchecker/ta/system.hh"
+#include "tchecker/utils/iterator.hh"
+#include "tchecker/zg/state.hh"
+
+/*!
+ \file binary.hh
+ \brief Binary format of graphs over the zone graph
+ \note A binary graph file consists of the following sections, each section
+ starts at an offset that is a multiple of 8 bytes:
+ - a header (see tchecker::graph::binary::header_t)
+ - fixed-width node records: flags, labels, tuple of locations, valuation of
+ bounded integer variables and DBM
+ - the index of outgoing edges: entry i is the first outgoing edge of node i,
+ and entry nodes_count is edges_count
+ - edge records (see tchecker::graph::binary::edge_record_t) sorted w.r.t.
+ source node
+ - edge attributes (see tchecker::graph::binary::attribute_record_t)
+ - names of locations, bounded integer variables and clocks
+ - the index of the string table, and the (null-terminated) strings
+ All strings (names, labels and attributes) are stored once in the string
+ table and referred to by their index. Values are stored in the byte order of
+ the machine that has written the file, and the file records the sizes of the
+ types of TChecker, hence a file can only be read by the same build of
+ TChecker on the same kind of machine
+ */
+
+namespace tchecker {
+
+namespace graph {
+
+namespace binary {
+
+/*!
+ \brief Format version
+ */
+static constexpr std::uint32_t VERSION = 1;
+
+/*!
+ \brief Byte order marker
+ */
+static constexpr std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+/*!
+ \brief Node flags
+ */
+enum node_flags_t : std::uint32_t {
+  NODE_INITIAL = 1, /*!< Initial node */
+  NODE_FINAL = 2,   /*!< Final node */
+};
+
+/*!
+ \class header_t
+ \brief Header of binary graph files
+ \note offsets are in bytes from the beginning of the file
+ */
+struct header_t {
+  char magic[8];                       /*!< File signature "TCKGRAPH" */
+  std::uint32_t version;               /*!< Format version */
+  std::uint32_t byte_order;            /*!< Byte order marker */
+  std::uint32_t loc_id_size;           /*!< Size of tchecker::loc_id_t */
+  std::uint32_t integer_size;          /*!< Size of tchecker::integer_t */
+  std::uint32_t db_size;               /*!< Size of tchecker::dbm::db_t */
+  std::uint32_t reserved;              /*!< Reserved (0) */
+  std::uint64_t name;                  /*!< Graph name (string index) */
+  std::uint64_t processes_count;       /*!< Number of processes (size of tuples of locations) */
+  std::uint64_t intvars_count;         /*!< Number of flattened bounded integer variables */
+  std::uint64_t dim;                   /*!< Dimension of DBMs */
+  std::uint64_t locations_count;       /*!< Number of locations */
+  std::uint64_t nodes_count;           /*!< Number of nodes */
+  std::uint64_t edges_count;           /*!< Number of edges */
+  std::uint64_t attributes_count;      /*!< Number of edge attributes */
+  std::uint64_t strings_count;         /*!< Number of strings */
+  std::uint64_t node_size;             /*!< Size of node records */
+  std::uint64_t node_vloc;             /*!< Offset of tuple of locations in node records */
+  std::uint64_t node_intval;           /*!< Offset of integer valuation in node records */
+  std::uint64_t node_dbm;              /*!< Offset of DBM in node records */
+  std::uint64_t nodes_offset;          /*!< Offset of node records */
+  std::uint64_t edges_index_offset;    /*!< Offset of index of outgoing edges */
+  std::uint64_t edges_offset;          /*!< Offset of edge records */
+  std::uint64_t attributes_offset;     /*!< Offset of edge attributes */
+  std::uint64_t locations_offset;      /*!< Offset of location names */
+  std::uint64_t intvars_offset;        /*!< Offset of bounded integer variable names */
+  std::uint64_t clocks_offset;         /*!< Offset of clock names */
+  std::uint64_t strings_index_offset;  /*!< Offset of the index of the string table */
+  std::uint64_t strings_offset;        /*!< Offset of the strings */
+  std::uint64_t file_size;             /*!< Size of the file */
+};
+
+/*!
+ \class node_record_t
+ \brief Beginning of node records
+ \note followed by the tuple of locations, the valuation of bounded integer
+ variables and the DBM at offsets given by the header
+ */
+struct node_record_t {
+  std::uint32_t flags;  /*!< Node flags (see tchecker::graph::binary::node_flags_t) */
+  std::uint32_t labels; /*!< Comma-separated list of labels (string index) */
+};
+
+/*!
+ \class edge_record_t
+ \brief Edge records
+ */
+struct edge_record_t {
+  std::uint64_t src;              /*!< Source node */
+  std::uint64_t tgt;              /*!< Target node */
+  std::uint64_t attributes_first; /*!< First attribute */
+  std::uint64_t attributes_count; /*!< Number of attributes */
+};
+
+/*!
+ \class attribute_record_t
+ \brief Attribute records
+ */
+struct attribute_record_t {
+  std::uint32_t key;   /*!< Key (string index) */
+  std::uint32_t value; /*!< Value (string index) */
+};
+
+/*!
+ \class writer_t
+ \brief Writer of binary graph files
+ \note A graph is written in three steps. First, the strings of the nodes are
+ interned and the edges are added, in the order of their source nodes. Then
+ the header and the nodes are output in order. Finally, the footer is output.
+ Only the edges and the strings are kept in memory: node records are output
+ directly
+ */
+class writer_t {
+public:
+  /*!
+   \brief Constructor
+   \param system : a system of timed processes
+   \param name : graph name
+   \param nodes_count : number of nodes
+   \post the names of locations, bounded integer variables and clocks in system
+   have been interned
+   */
+  writer_t(tchecker::ta::system_t const & system, std::string const & name, std::size_t nodes_count);
+
+  /*!
+   \brief Intern a string
+   \param s : a string
+   \return index of s in the string table
+   \post s has been added to the string table if it was not already in
+   */
+  std::uint32_t intern(std::string const & s);
+
+  /*!
+   \brief Add an edge
+   \param src : source node
+   \param tgt : target node
+   \param attr : edge attributes
+   \pre src is greater than or equal to the source of the last edge added, and
+   less than the number of nodes
+   \post the edge from src to tgt with attributes attr has been added
+   \throw std::invalid_argument : if the precondition is not satisfied
+   */
+  void add_edge(std::uint64_t src, std::uint64_t tgt, std::map<std::string, std::string> const & attr);
+
+  /*!
+   \brief Output header
+   \param os : output stream
+   \pre all strings have been interned and all edges have been added
+   \post the header has been output to os
+   */
+  void output_header(std::ostream & os);
+
+  /*!
+   \brief Output a node
+   \param os : output stream
+   \param flags : node flags
+   \param labels : labels of the node (string index)
+   \param s : state of the node
+   \pre the header and the previous nodes have been output to os
+   \post the record of the node has been output to os
+   */
+  void output_node(std::ostream & os, std::uint32_t flags, std::uint32_t labels, tchecker::zg::state_t const & s);
+
+  /*!
+   \brief Output footer
+   \param os : output stream
+   \pre the header and all the nodes have been output to os
+   \post edges, names and strings have been output to os
+   \throw std::runtime_error : if the number of nodes output differs from the
+   number of nodes given to the constructor
+   */
+  void output_footer(std::ostream & os);
+
+private:
+  tchecker::graph::binary::header_t _header;                             /*!< Header */
+  std::vector<std::uint32_t> _locations;                                 /*!< Location names */
+  std::vector<std::uint32_t> _intvars;                                   /*!< Bounded integer variable names */
+  std::vector<std::uint32_t> _clocks;                                    /*!< Clock names */
+  std::vector<std::uint64_t> _edges_index;                               /*!< Index of outgoing edges */
+  std::vector<tchecker::graph::binary::edge_record_t> _edges;            /*!< Edges */
+  std::vector<tchecker::graph::binary::attribute_record_t> _attributes;  /*!< Edge attributes */
+  std::unordered_map<std::string, std::uint32_t> _strings_map;           /*!< Map: string -> index */
+  std::vector<std::string const *> _strings;                             /*!< Strings by index */
+  std::uint64_t _nodes_output;                                           /*!< Number of nodes output */
+  std::vector<char> _record;                                             /*!< Buffer for node records */
+};
+
+/*!
+ \brief Output a graph over the zone graph in binary format
+ \tparam GRAPH : type of graph, should provide types GRAPH::node_sptr_t,
+ GRAPH::edge_sptr_t, and method GRAPH::nodes() that returns the range of nodes,
+ and a method GRAPH::outgoing_edges(n) that returns the range of outgoing edges
+ of node n. Nodes should derive from tchecker::graph::node_flags_t and
+ tchecker::graph::node_zg_state_t
+ \tparam NODE_LE : total order on type GRAPH::node_sptr_t
+ \tparam EDGE_LE : total order on type GRAPH::edge_sptr_t
+ \param os : output stream
+ \param g : a graph
+ \param system : system of timed processes of the zone graph
+ \param name : graph name
+ \post the graph g has been output to os in binary format. The nodes and edges
+ are output following the order given by NODE_LE and EDGE_LE, i.e. in the same
+ order as tchecker::graph::dot_output
+ \note node attributes are encoded in node records, edge attributes are stored
+ as strings
+ */
+template <class GRAPH, class NODE_LE, class EDGE_LE>
+std::ostream & output(std::ostream & os, GRAPH const & g, tchecker::ta::system_t const & system, std::string const & name)
+{
+  using node_id_t = std::uint64_t;
+  using extended_edge_t = std::tuple<node_id_t, node_id_t, typename GRAPH::edge_sptr_t>; // <src, tgt, edge_sptr>
+
+  // Extend EDGE_LE on triples (src, tgt, edge)
+  class extended_edge_le_t : private EDGE_LE {
+  public:
+    bool operator()(extended_edge_t const & e1, extended_edge_t const & e2) const
+    {
+      auto && [src1, tgt1, edge_sptr1] = e1;
+      auto && [src2, tgt2, edge_sptr2] = e2;
+      if (src1 != src2)
+        return src1 < src2;
+      if (tgt1 != tgt2)
+        return tgt1 < tgt2;
+      return EDGE_LE::operator()(edge_sptr1, edge_sptr2);
+    }
+  };
+
+  // Sort nodes THEN give them an ID
+  std::map<typename GRAPH::node_sptr_t, node_id_t, NODE_LE> nodes_map;
+  for (typename GRAPH::node_sptr_t const & n : g.nodes())
+    nodes_map.insert(std::make_pair(n, 0));
+
+  node_id_t nodes_count = 0;
+  for (auto && [n, id] : nodes_map)
+    id = nodes_count++;
+
+  // Sort (extended) edges
+  std::multiset<extended_edge_t, extended_edge_le_t> edges_set;
+  for (typename GRAPH::node_sptr_t const & n : g.nodes()) {
+    for (typename GRAPH::edge_sptr_t const & e : g.outgoing_edges(n)) {
+      auto it_src = nodes_map.find(g.edge_src(e));
+      if (it_src == nodes_map.end())
+        throw std::runtime_error("tchecker::graph::binary::output: source node not found");
+      auto it_tgt = nodes_map.find(g.edge_tgt(e));
+      if (it_tgt == nodes_map.end())
+        throw std::runtime_error("tchecker::graph::binary::output: target node not found");
+      edges_set.insert(std::make_tuple(it_src->second, it_tgt->second, e));
+    }
+  }
+
+  // Intern strings and add edges
+  tchecker::graph::binary::writer_t writer{system, name, nodes_map.size()};
+
+  std::vector<std::uint32_t> labels;
+  labels.reserve(nodes_map.size());
+  for (auto && [node, id] : nodes_map)
+    labels.push_back(writer.intern(tchecker::syncprod::labels_str(system.as_syncprod_system(), node->state())));
+
+  std::map<std::string, std::string> attr;
+  for (auto && [src, tgt, edge] : edges_set) {
+    attr.clear();
+    g.attributes(edge, attr);
+    writer.add_edge(src, tgt, attr);
+  }
+  edges_set.clear();
+
+  // Output
+  writer.output_header(os);
+  for (auto && [node, id] : nodes_map) {
+    std::uint32_t flags = 0;
+    if (node->initial())
+      flags |= tchecker::graph::binary::NODE_INITIAL;
+    if (node->final())
+      flags |= tchecker::graph::binary::NODE_FINAL;
+    writer.output_node(os, flags, labels[id], node->state());
+  }
+  writer.output_footer(os);
+
+  return os;
+}
+
+/*!
+ \class node_t
+ \brief Node of a memory-mapped binary graph
+ \note Accessors return pointers into the mapped file
+ */
+class node_t {
+public:
+  /*!
+   \brief Constructor
+   \param record : node record
+   \param header : header of the graph
+   \param labels : labels of the node
+   */
+  node_t(char const * record, tchecker::graph::binary::header_t const & header, std::string_view labels)
+      : _record(record), _header(header), _labels(labels)
+  {
+  }
+
+  /*!
+   \brief Accessor
+   \return initial node flag
+   */
+  inline bool initial() const { return flags() & tchecker::graph::binary::NODE_INITIAL; }
+
+  /*!
+   \brief Accessor
+   \return final node flag
+   */
+  inline bool final() const { return flags() & tchecker::graph::binary::NODE_FINAL; }
+
+  /*!
+   \brief Accessor
+   \return comma-separated list of labels of this node
+   */
+  inline std::string_view labels() const { return _labels; }
+
+  /*!
+   \brief Accessor
+   \return tuple of locations of this node (array of size processes_count)
+   */
+  inline tchecker::loc_id_t const * vloc() const
+  {
+    return reinterpret_cast<tchecker::loc_id_t const *>(_record + _header.node_vloc);
+  }
+
+  /*!
+   \brief Accessor
+   \return valuation of bounded integer variables of this node (array of size
+   intvars_count)
+   */
+  inline tchecker::integer_t const * intval() const
+  {
+    return reinterpret_cast<tchecker::integer_t const *>(_record + _header.node_intval);
+  }
+
+  /*!
+   \brief Accessor
+   \return DBM of this node (array of size dim * dim)
+   */
+  inline tchecker::dbm::db_t const * dbm() const
+  {
+    return reinterpret_cast<tchecker::dbm::db_t const *>(_record + _header.node_dbm);
+  }
+
+private:
+  /*!
+   \brief Accessor
+   \return node flags
+   */
+  inline std::uint32_t flags() const
+  {
+    return reinterpret_cast<tchecker::graph::binary::node_record_t const *>(_record)->flags;
+  }
+
+  char const * _record;                              /*!< Node record */
+  tchecker::graph::binary::header_t const & _header; /*!< Header */
+  std::string_view _labels;                          /*!< Labels */
+};
+
+/*!
+ \class mapped_graph_t
+ \brief Read-only access to a binary graph file mapped in memory
+ \note Nothing is copied from the file: nodes, edges and strings are accessed
+ directly in the mapping. The whole file is validated when it is mapped, hence
+ accessors do not check their parameters
+ */
+class mapped_graph_t {
+public:
+  /*!
+   \brief Constructor
+   \param filename : binary graph file name
+   \post filename has been mapped in memory
+   \throw std::runtime_error : if filename cannot be mapped, if it is not a
+   binary graph file, or if it has not been written by the same build of
+   TChecker
+   */
+  explicit mapped_graph_t(std::string const & filename);
+
+  /*!
+   \brief Copy constructor (deleted)
+   */
+  mapped_graph_t(tchecker::graph::binary::mapped_graph_t const &) = delete;
+
+  /*!
+   \brief Destructor
+   \post the file has been unmapped
+   */
+  ~mapped_graph_t();
+
+  /*!
+   \brief Assignment operator (deleted)
+   */
+  tchecker::graph::binary::mapped_graph_t & operator=(tchecker::graph::binary::mapped_graph_t const &) = delete;
+
+  /*!
+   \brief Accessor
+   \return header of the graph
+   */
+  inline tchecker::graph::binary::header_t const & header() const { return *_header; }
+
+  /*!
+   \brief Accessor
+   \return graph name
+   */
+  inline std::string_view name() const { return string(_header->name); }
+
+  /*!
+   \brief Accessor
+   \return number of nodes
+   */
+  inline std::uint64_t nodes_count() const { return _header->nodes_count; }
+
+  /*!
+   \brief Accessor
+   \return number of edges
+   */
+  inline std::uint64_t edges_count() const { return _header->edges_count; }
+
+  /*!
+   \brief Accessor
+   \param id : node identifier
+   \pre id < nodes_count()
+   \return node with identifier id
+   */
+  tchecker::graph::binary::node_t node(std::uint64_t id) const;
+
+  /*!
+   \brief Accessor
+   \param id : node identifier
+   \pre id < nodes_count()
+   \return range of outgoing edges of node id
+   */
+  inline tchecker::range_t<tchecker::graph::binary::edge_record_t const *> outgoing_edges(std::uint64_t id) const
+  {
+    std::uint64_t const * index = section<std::uint64_t>(_header->edges_index_offset);
+    tchecker::graph::binary::edge_record_t const * edges =
+        section<tchecker::graph::binary::edge_record_t>(_header->edges_offset);
+    return tchecker::make_range(edges + index[id], edges + index[id + 1]);
+  }
+
+  /*!
+   \brief Accessor
+   \return range of all edges
+   */
+  inline tchecker::range_t<tchecker::graph::binary::edge_record_t const *> edges() const
+  {
+    tchecker::graph::binary::edge_record_t const * edges =
+        section<tchecker::graph::binary::edge_record_t>(_header->edges_offset);
+    return tchecker::make_range(edges, edges + _header->edges_count);
+  }
+
+  /*!
+   \brief Accessor
+   \param e : an edge
+   \return range of attributes of e
+   */
+  inline tchecker::range_t<tchecker::graph::binary::attribute_record_t const *>
+  attributes(tchecker::graph::binary::edge_record_t const & e) const
+  {
+    tchecker::graph::binary::attribute_record_t const * attributes =
+        section<tchecker::graph::binary::attribute_record_t>(_header->attributes_offset) + e.attributes_first;
+    return tchecker::make_range(attributes, attributes + e.attributes_count);
+  }
+
+  /*!
+   \brief Accessor
+   \param id : string index
+   \pre id < strings_count
+   \return string with index id
+   */
+  inline std::string_view string(std::uint64_t id) const
+  {
+    std::uint64_t const * index = section<std::uint64_t>(_header->strings_index_offset);
+    return std::string_view{section<char>(_header->strings_offset) + index[id], index[id + 1] - index[id] - 1};
+  }
+
+  /*!
+   \brief Accessor
+   \param id : location identifier
+   \pre id < locations_count
+   \return name of location id
+   */
+  inline std::string_view location_name(tchecker::loc_id_t id) const
+  {
+    return string(section<std::uint32_t>(_header->locations_offset)[id]);
+  }
+
+  /*!
+   \brief Accessor
+   \param id : flattened bounded integer variable identifier
+   \pre id < intvars_count
+   \return name of variable id
+   */
+  inline std::string_view intvar_name(tchecker::intvar_id_t id) const
+  {
+    return string(section<std::uint32_t>(_header->intvars_offset)[id]);
+  }
+
+  /*!
+   \brief Accessor
+   \param id : flattened clock identifier
+   \pre id < dim - 1
+   \return name of clock id
+   */
+  inline std::string_view clock_name(tchecker::clock_id_t id) const
+  {
+    return string(section<std::uint32_t>(_header->clocks_offset)[id]);
+  }
+
+private:
+  /*!
+   \brief Accessor
+   \param offset : offset in the file
+   \return pointer to offset in the file, as a pointer to T
+   */
+  template <class T> inline T const * section(std::uint64_t offset) const
+  {
+    return reinterpret_cast<T const *>(_data + offset);
+  }
+
+  /*!
+   \brief Check the layout and the records of the file
+   \throw std::runtime_error : if the file is not a well-formed binary graph
+   file written by the same build of TChecker: sections overlap or exceed the
+   file, or some record refers to a node, an edge attribute, a location or a
+   string that is not in the file
+   \note all records are checked, hence accessors never read out of the file
+   */
+  void check() const;
+
+  char const * _data;                                /*!< Mapped file */
+  std::size_t _size;                                 /*!< Size of mapped file */
+  tchecker::graph::binary::header_t const * _header; /*!< Header */
+};
+
+/*!
+ \brief Output a binary graph in graphviz DOT language
+ \param os : output stream
+ \param g : a binary graph
+ \post the graph g has been output to os in the graphviz DOT language, with
+ the same nodes, edges and attributes as tchecker::graph::dot_output
+ \return os after output
+ */
+std::ostream & dot_output(std::ostream & os, tchecker::graph::binary::mapped_graph_t const & g);
+
+} // end of namespace binary
+
+} // end of namespace graph
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_GRAPH_BINARY_HH
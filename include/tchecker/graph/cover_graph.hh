@@ -109,6 +109,16 @@ public:
    */
   void clear() { _nodes.clear(); }
 
+  /*!
+   \brief Back the graph by huge pages
+   \param huge_pages : huge pages mode
+   \pre the graph is empty
+   \post the table of the graph is allocated from memory backed by huge pages
+   according to huge_pages (see tchecker::collision_table_t::huge_pages)
+   \throw std::logic_error : if the precondition is not satisfied
+   */
+  void huge_pages(enum tchecker::huge_pages_t huge_pages) { _nodes.huge_pages(huge_pages); }
+
   /*!
    \brief Add node to the graph
    \param n : a node
@@ -173,12 +183,41 @@ public:
         ins = node;
   }
 
+  /*!
+   \brief Accessor to the nodes in the graph that cover a given node
+   \param n : a node
+   \param ins : an inserter iterator that accepts NODE_SPTR
+   \post All the nodes in this graph with the same hash value as n, and that are
+   bigger-than-or-equal-to n w.r.t. NODE_SPTR_LE have been inserted using ins
+   \note this function ensures that n is never covered by itself (i.e. n is not
+   added to ins if it belongs to this graph)
+   */
+  template <class INSERTER> void covering_nodes(NODE_SPTR const & n, INSERTER & ins) const
+  {
+    auto && range = _nodes.collision_range(n);
+    for (NODE_SPTR const & node : range)
+      if ((node != n) && _node_le(n, node))
+        ins = node;
+  }
+
   /*!
    \brief Accessor
    \return Number of nodes in this graph
    */
   inline std::size_t size() const { return _nodes.size(); }
 
+  /*!
+   \brief Accessor
+   \return Memory footprint of the set of nodes, excluding nodes
+   */
+  inline std::size_t memsize() const { return _nodes.memsize(); }
+
+  /*!
+   \brief Accessor
+   \return Memory used by the entries of the set of nodes, excluding nodes
+   */
+  inline std::size_t livesize() const { return _nodes.livesize(); }
+
   /*!
    \brief Type of iterator over the nodes in the graph
    */
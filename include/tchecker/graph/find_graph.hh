@@ -105,6 +105,16 @@ public:
    */
   inline void clear() { _nodes.clear(); }
 
+  /*!
+   \brief Back the graph by huge pages
+   \param huge_pages : huge pages mode
+   \pre the graph is empty
+   \post the buckets of the graph are allocated from memory backed by huge pages
+   according to huge_pages (see tchecker::hashtable_t::huge_pages)
+   \throw std::logic_error : if the precondition is not satisfied
+   */
+  inline void huge_pages(enum tchecker::huge_pages_t huge_pages) { _nodes.huge_pages(huge_pages); }
+
   /*!
    \brief Accessor
    \param n : a node
@@ -165,6 +175,18 @@ public:
    */
   inline std::size_t size() const { return _nodes.size(); }
 
+  /*!
+   \brief Accessor
+   \return Memory footprint of the set of nodes, excluding nodes
+   */
+  inline std::size_t memsize() const { return _nodes.memsize(); }
+
+  /*!
+   \brief Accessor
+   \return Memory used by the entries of the set of nodes, excluding nodes
+   */
+  inline std::size_t livesize() const { return _nodes.livesize(); }
+
 protected:
   tchecker::hashtable_t<NODE_SPTR, NODE_SPTR_HASH, NODE_SPTR_EQUAL> _nodes; /*!< Set of nodes */
 };
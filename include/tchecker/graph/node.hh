@@ -8,6 +8,7 @@
 #ifndef TCHECKER_GRAPH_NODE_HH
 #define TCHECKER_GRAPH_NODE_HH
 
+#include <cstdint>
 #include <map>
 #include <string>
 
@@ -88,6 +89,71 @@ int lexical_cmp(tchecker::graph::node_flags_t const & n1, tchecker::graph::node_
 */
 void attributes(tchecker::graph::node_flags_t const & n, std::map<std::string, std::string> & m);
 
+/*!
+ \class node_rank_t
+ \brief Node with a rank and an expanded flag, used to order the exploration
+ of covering reachability graphs
+ \note see Herbreteau and Tran, "Improving search order for reachability
+ testing in timed automata", FORMATS 2015
+ */
+class node_rank_t {
+public:
+  /*!
+   \brief Constructor
+   \post this node has rank 0 and is not expanded
+   */
+  node_rank_t();
+
+  /*!
+   \brief Accessor
+   \return rank of this node
+   */
+  inline std::uint32_t rank() const { return _rank; }
+
+  /*!
+   \brief Set rank
+   \param rank : rank
+   \post this node has rank rank
+   */
+  inline void rank(std::uint32_t rank) { _rank = rank; }
+
+  /*!
+   \brief Accessor
+   \return true if this node has been expanded, false otherwise
+   */
+  inline bool expanded() const { return _expanded; }
+
+  /*!
+   \brief Set expanded status
+   \param status : expanded status
+   \post this node is marked 'expanded' if status is true, 'non expanded' otherwise
+   */
+  inline void expanded(bool status) { _expanded = status; }
+
+private:
+  std::uint32_t _rank; /*!< Rank */
+  bool _expanded;      /*!< Expanded flag */
+};
+
+/*!
+ \class node_rank_greater_t
+ \brief Ordering on pointers to nodes by decreasing rank
+ \note nodes must derive from tchecker::graph::node_rank_t
+ */
+class node_rank_greater_t {
+public:
+  /*!
+   \brief Comparison
+   \param n1 : pointer to a node
+   \param n2 : pointer to a node
+   \return true if the rank of n1 is greater than the rank of n2, false otherwise
+   */
+  template <class NODE_PTR> inline bool operator()(NODE_PTR const & n1, NODE_PTR const & n2) const
+  {
+    return n1->rank() > n2->rank();
+  }
+};
+
 /*!
  \struct node_zg_state_t
  \brief Graph node that points to a state of a zone graph
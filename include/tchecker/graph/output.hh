@@ -67,6 +67,94 @@ std::ostream & dot_output_node(std::ostream & os, std::string const & name, std:
 std::ostream & dot_output_edge(std::ostream & os, std::string const & src, std::string const & tgt,
                                std::map<std::string, std::string> const & attr);
 
+/*!
+ \class dot_attributes_writer_t
+ \brief Output of attributes in graphviz DOT language, directly to an output
+ stream
+ \note allows to output attributes without building a map of attributes
+ */
+class dot_attributes_writer_t {
+public:
+  /*!
+   \brief Constructor
+   \param os : output stream
+   \post the beginning of a list of attributes has been output to os
+   */
+  explicit dot_attributes_writer_t(std::ostream & os);
+
+  /*!
+   \brief Copy constructor (deleted)
+   */
+  dot_attributes_writer_t(tchecker::graph::dot_attributes_writer_t const &) = delete;
+
+  /*!
+   \brief Destructor
+   \post the end of the list of attributes has been output
+   */
+  ~dot_attributes_writer_t();
+
+  /*!
+   \brief Assignment operator (deleted)
+   */
+  tchecker::graph::dot_attributes_writer_t & operator=(tchecker::graph::dot_attributes_writer_t const &) = delete;
+
+  /*!
+   \brief Output an attribute
+   \tparam F : type of value outputter, should be callable with an std::ostream &
+   \param key : attribute key
+   \param value : outputter of attribute value
+   \post the attribute (key, value) has been output, where the value has been
+   output by value
+   */
+  template <class F> void attribute_output(std::string const & key, F && value)
+  {
+    begin_attribute(key);
+    value(_os);
+    end_attribute();
+  }
+
+  /*!
+   \brief Output an attribute
+   \param key : attribute key
+   \param value : attribute value
+   \post the attribute (key, value) has been output
+   */
+  void attribute(std::string const & key, std::string const & value);
+
+private:
+  /*!
+   \brief Output the beginning of an attribute
+   \param key : attribute key
+   */
+  void begin_attribute(std::string const & key);
+
+  /*!
+   \brief Output the end of an attribute
+   */
+  void end_attribute();
+
+  std::ostream & _os; /*!< Output stream */
+  bool _first;        /*!< First attribute flag */
+};
+
+/*!
+ \brief Output a graph in graphviz DOT language in canonical order
+ \param is : input stream
+ \param os : output stream
+ \pre is contains a graph in graphviz DOT language with one node or edge per
+ line, as output by tchecker::graph::dot_output_node and
+ tchecker::graph::dot_output_edge (e.g. a graph output by streaming)
+ \post the graph in is has been output to os with nodes sorted w.r.t. their
+ attributes and named 0, 1, ..., and edges sorted w.r.t. their source, target
+ and attributes. Hence, graphs that only differ in the names and the order of
+ nodes and edges are output identically
+ \return os after output
+ \throw std::runtime_error : if is does not satisfy the precondition
+ \note this is meant as an offline post-processing of graphs that are output
+ in exploration order. It stores the entire graph in memory
+ */
+std::ostream & dot_canonical_output(std::istream & is, std::ostream & os);
+
 /*!
  \brief Output a graph in graphviz DOT language
  \tparam GRAPH : type of graph, should provide types GRAPH::node_sptr_t,
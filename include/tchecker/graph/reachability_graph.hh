@@ -270,6 +270,64 @@ public:
     _find_graph.clear();
     _node_pool.destruct_all();
     _edge_pool.destruct_all();
+    _store_edges = true;
+  }
+
+  /*!
+  \brief Drop all the edges and stop storing edges
+  \pre no edge of the graph is referenced outside the graph
+  \post all the edges have been removed from the graph and their memory has
+  been released. Edges added later are not stored
+  \note the graph cannot be used to build a counter-example anymore
+  */
+  void drop_edges()
+  {
+    for (node_sptr_t const & n : nodes())
+      _directed_graph.remove_edges(n);
+    _edge_pool.destruct_all();
+    _store_edges = false;
+  }
+
+  /*!
+  \brief Accessor
+  \return true if edges are stored in the graph, false otherwise (see drop_edges)
+  */
+  inline bool stores_edges() const { return _store_edges; }
+
+  /*!
+  \brief Accessor
+  \return Memory used by the nodes and edges of the graph, and by the node store
+  */
+  inline std::size_t memsize() const { return _find_graph.memsize() + _node_pool.memsize() + _edge_pool.memsize(); }
+
+  /*!
+  \brief Accumulate memory statistics
+  \param stats : memory statistics
+  \post the memory of the nodes, of the edges and of the node store has been
+  added to stats
+  \note linear in the number of allocated nodes and edges
+  */
+  void memory_stats(tchecker::memory_stats_t & stats) const
+  {
+    _node_pool.memory_stats(stats);
+    _edge_pool.memory_stats(stats);
+    stats.add(tchecker::MEMORY_HASHTABLE, _find_graph.memsize(), _find_graph.livesize());
+  }
+
+  /*!
+  \brief Back nodes, edges and the node store by huge pages
+  \param huge_pages : huge pages mode
+  \pre no node and no edge has been added to the graph yet
+  \post nodes and edges are allocated from memory backed by huge pages
+  according to huge_pages (see tchecker::pool_t::huge_pages), and so are the
+  buckets of the node store (see tchecker::hashtable_t::huge_pages)
+  \throw std::logic_error : if the precondition is not satisfied
+  */
+  void huge_pages(enum tchecker::huge_pages_t huge_pages)
+  {
+    _node_pool.huge_pages(huge_pages);
+    _edge_pool.huge_pages(huge_pages);
+    _find_graph.huge_pages(huge_pages);
   }
 
   /*!
@@ -298,10 +356,12 @@ public:
    \param args : arguments to a constructor of EDGE
    \pre n1 and n2 should be nodes of the graph
    \post an instance of EDGE(args) from node n1 to node n2 has been added to the
-   graph
+   graph, unless edges are not stored (see drop_edges)
    */
   template <class... ARGS> void add_edge(node_sptr_t const & n1, node_sptr_t const & n2, ARGS &&... args)
   {
+    if (!_store_edges)
+      return;
     edge_sptr_t edge = _edge_pool.construct(args...);
     _directed_graph.add_edge(n1, n2, edge);
   }
@@ -515,6 +575,7 @@ private:
   tchecker::graph::directed::graph_t<node_sptr_t, edge_sptr_t> _directed_graph;                    /*!< Edge store */
   tchecker::graph::node_pool_allocator_t<shared_node_t> _node_pool;                                /*!< Node pool allocator */
   tchecker::graph::edge_pool_allocator_t<shared_edge_t> _edge_pool;                                /*!< Edge pool allocator */
+  bool _store_edges{true};                                                                          /*!< Edges storage flag */
 };
 
 /*!
@@ -614,6 +675,20 @@ public:
     _edge_pool.destruct_all();
   }
 
+  /*!
+  \brief Back nodes and edges by huge pages
+  \param huge_pages : huge pages mode
+  \pre no node and no edge has been added to the graph yet
+  \post nodes and edges are allocated from memory backed by huge pages
+  according to huge_pages (see tchecker::pool_t::huge_pages)
+  \throw std::logic_error : if the precondition is not satisfied
+  */
+  void huge_pages(enum tchecker::huge_pages_t huge_pages)
+  {
+    _node_pool.huge_pages(huge_pages);
+    _edge_pool.huge_pages(huge_pages);
+  }
+
   /*!
   \brief Add a node
   \param args : arguments to a constructor of type NODE
@@ -314,6 +314,77 @@ public:
     _cover_graph.clear();
     _node_pool.destruct_all();
     _edge_pool.destruct_all();
+    _store_edges = true;
+  }
+
+  /*!
+  \brief Drop all the edges and stop storing edges
+  \pre no edge of the graph is referenced outside the graph
+  \post all the edges have been removed from the graph and their memory has
+  been released. Edges added later are not stored
+  \note the graph cannot be used to build a counter-example anymore. Covering
+  of nodes is not affected as it does not depend on edges
+  */
+  void drop_edges()
+  {
+    for (node_sptr_t const & n : _cover_graph)
+      _directed_graph.remove_edges(n);
+    _edge_pool.destruct_all();
+    _store_edges = false;
+  }
+
+  /*!
+  \brief Accessor
+  \return true if edges are stored in the graph, false otherwise (see drop_edges)
+  */
+  inline bool stores_edges() const { return _store_edges; }
+
+  /*!
+  \brief Accessor
+  \return Memory used by the nodes and edges of the graph, and by the node store
+  */
+  inline std::size_t memsize() const { return _cover_graph.memsize() + _node_pool.memsize() + _edge_pool.memsize(); }
+
+  /*!
+  \brief Accumulate memory statistics
+  \param stats : memory statistics
+  \post the memory of the nodes, of the edges and of the node store has been
+  added to stats
+  \note linear in the number of allocated nodes and edges
+  */
+  void memory_stats(tchecker::memory_stats_t & stats) const
+  {
+    _node_pool.memory_stats(stats);
+    _edge_pool.memory_stats(stats);
+    stats.add(tchecker::MEMORY_HASHTABLE, _cover_graph.memsize(), _cover_graph.livesize());
+  }
+
+  /*!
+  \brief Back nodes, edges and the node store by huge pages
+  \param huge_pages : huge pages mode
+  \pre no node and no edge has been added to the graph yet
+  \post nodes and edges are allocated from memory backed by huge pages
+  according to huge_pages (see tchecker::pool_t::huge_pages), and so is the
+  table of the node store (see tchecker::collision_table_t::huge_pages)
+  \throw std::logic_error : if the precondition is not satisfied
+  */
+  void huge_pages(enum tchecker::huge_pages_t huge_pages)
+  {
+    _node_pool.huge_pages(huge_pages);
+    _edge_pool.huge_pages(huge_pages);
+    _cover_graph.huge_pages(huge_pages);
+  }
+
+  /*!
+  \brief Enroll in an incremental garbage collector
+  \param collector : an incremental garbage collector
+  \post nodes and edges that have been removed from the graph, and that are not
+  referenced anymore, are collected by collector
+  */
+  void enroll(tchecker::incremental_collector_t & collector)
+  {
+    _node_pool.enroll(collector);
+    _edge_pool.enroll(collector);
   }
 
   /*!
@@ -335,12 +406,16 @@ public:
    \param edge_type : edge type
    \param args : arguments to a constructor of type EDGE
    \pre src and tgt are nodes stored in this graph
-   \post an instance of EDGE(args) has been added from src to tgt with type edge_type
+   \post an instance of EDGE(args) has been added from src to tgt with type
+   edge_type, unless edges are not stored (see drop_edges)
+   \return the added edge, or nullptr if edges are not stored
   */
   template <class... ARGS>
   edge_sptr_t add_edge(node_sptr_t const & src, node_sptr_t const & tgt,
                        enum tchecker::graph::subsumption::edge_type_t edge_type, ARGS &&... args)
   {
+    if (!_store_edges)
+      return edge_sptr_t{nullptr};
     edge_sptr_t edge = _edge_pool.construct(edge_type, args...);
     _directed_graph.add_edge(src, tgt, edge);
     return edge;
@@ -428,6 +503,18 @@ public:
     _cover_graph.covered_nodes(n, ins);
   }
 
+  /*!
+   \brief Compute the nodes in the graph that cover a given node
+   \param n : a node
+   \param ins : a node inserter
+   \post All the nodes in this graph that have the same hash value as n w.r.t.
+   NODE_HASH, and that cover n w.r.t. NODE_LE, have been inserted in ins
+   */
+  template <class INSERTER> void covering_nodes(node_sptr_t const & n, INSERTER & ins) const
+  {
+    _cover_graph.covering_nodes(n, ins);
+  }
+
   /*!
    \brief Type of incoming edges iterator
   */
@@ -610,6 +697,7 @@ private:
   tchecker::graph::directed::graph_t<node_sptr_t, edge_sptr_t> _directed_graph;                /*!< Edge store */
   tchecker::graph::node_pool_allocator_t<shared_node_t> _node_pool;                            /*!< Node pool allocator */
   tchecker::graph::edge_pool_allocator_t<shared_edge_t> _edge_pool;                            /*!< Edge pool allocator */
+  bool _store_edges{true};                                                                      /*!< Edges storage flag */
 };
 
 /* output */
@@ -125,6 +125,10 @@ namespace publicapi {
   \param inter_constraint : constraints between any clocks of both automata, or the empty string in case no such constraint is given
   \param generate_witness Whether a witness/Contradiction DAG shall be generated
   \param all_reachable_states Checks all reachable states of the first system.
+  \param progress_interval Time interval between two progress reports in seconds (0 for no report, see
+  tchecker::progress_reporter_t)
+  \param progress_file File of progress reports in JSON lines format (empty to report to standard error in text
+  format)
   \note This is the C++ API. For C/FFI usage, see the C-compatible version above.
   \note In inter_constraint, any clock of the first automaton must be given with the postfix _1. Analogously for any clock of the second TA.
 */
@@ -138,7 +142,9 @@ namespace publicapi {
                    std::string & second_starting_state_json,
                    std::string & inter_constraint,
                    bool generate_witness,
-                   bool all_reachable_states);
+                   bool all_reachable_states,
+                   std::size_t progress_interval = 0,
+                   std::string progress_file = "");
 
 } // end of namespace publicapi
 
@@ -21,6 +21,8 @@
 enum tck_liveness_algorithm_t {
   ALGO_COUVSCC, /*!< Couvreur's SCC algorithm */
   ALGO_NDFS,    /*!< Nested DFS algorithm */
+  ALGO_UFSCC,   /*!< Parallel union-find SCC algorithm */
+  ALGO_SNDFS,   /*!< Nested DFS algorithm with subsumption */
   ALGO_NONE,    /*!< No algorithm */
 };
 
@@ -28,6 +30,7 @@ enum tck_liveness_certificate_t {
   CERTIFICATE_GRAPH,    /*!< Graph of state-space */
   CERTIFICATE_SYMBOLIC, /*!< Symbolic counter-example */
   CERTIFICATE_NONE,     /*!< No certificate */
+  CERTIFICATE_BINARY,   /*!< Graph of state-space in binary format */
 };
 
 #ifdef __cplusplus
@@ -119,8 +122,14 @@ namespace publicapi {
   \param certificate Type of certificate to produce (see tck_liveness_certificate_t)
   \param block_size Block size for internal computation
   \param table_size Table size for internal computation
+  \param threads Number of worker threads for parallel algorithms (0 means hardware concurrency)
+  \param progress_interval Time interval between two progress reports in seconds (0 for no report, see
+  tchecker::progress_reporter_t)
+  \param progress_file File of progress reports in JSON lines format (empty to report to standard error in text
+  format)
 
   \note This is the C++ API. For C/FFI usage, see the C-compatible version above.
+  The C-compatible version uses hardware concurrency for parallel algorithms.
 */
   void tck_liveness(std::string output_filename, 
                    std::string sysdecl_filename, 
@@ -128,7 +137,10 @@ namespace publicapi {
                    tck_liveness_algorithm_t algorithm, 
                    tck_liveness_certificate_t certificate, 
                    std::size_t block_size, 
-                   std::size_t table_size);
+                   std::size_t table_size,
+                   std::size_t threads = 0,
+                   std::size_t progress_interval = 0,
+                   std::string progress_file = "");
 } // end of namespace publicapi
 
 } // end of namespace tchecker
@@ -25,7 +25,10 @@ enum tck_reach_algorithm_t {
   ALGO_CONCUR19,     /*!< Covering reachability algorithm over the local-time zone graph */
   ALGO_COVREACH,     /*!< Covering reachability algorithm */
   ALGO_ALU_COVREACH, /*!< Covering reachability algorithm with aLU subsumption*/
+  ALGO_PORTFOLIO,    /*!< Portfolio of all algorithms above run in parallel */
   ALGO_NONE,         /*!< No algorithm */
+  ALGO_BWD_REACH,    /*!< Backward reachability algorithm */
+  ALGO_BIDIR_REACH,  /*!< Bidirectional reachability algorithm */
 };
 
 
@@ -34,6 +37,7 @@ enum tck_reach_certificate_t {
   CERTIFICATE_SYMBOLIC, /*!< Symbolic counter-example */
   CERTIFICATE_CONCRETE, /*!< Concrete counter-example */
   CERTIFICATE_NONE,     /*!< No certificate */
+  CERTIFICATE_BINARY,   /*!< Graph of state-space in binary format */
 };
 
 enum tck_reach_search_order_t {
@@ -53,7 +57,8 @@ extern "C" {
 
   \param output_filename Path to the output file (results or certificate)
   \param sysdecl_filename Path to the system declaration file
-  \param labels String describing the labels for reachability checking
+  \param labels String describing the labels for reachability checking: a comma-separated set of labels, or a
+  semicolon-separated list of such sets to check all of them in a single exploration (reach and covreach only)
   \param algorithm Reachability checking algorithm (see tck_reach_algorithm_t)
   \param search_order Search order for state-space exploration ("BFS" or "DFS")
   \param certificate Type of certificate to produce (see tck_reach_certificate_t)
@@ -129,13 +134,45 @@ namespace publicapi {
 
   \param output_filename Path to the output file (results or certificate)
   \param sysdecl_filename Path to the system declaration file
-  \param labels String describing the labels for reachability checking
+  \param labels String describing the labels for reachability checking: a comma-separated set of labels, or a
+  semicolon-separated list of such sets to check all of them in a single exploration (reach and covreach only)
   \param algorithm Reachability checking algorithm (see tck_reach_algorithm_t)
   \param search_order Search order for state-space exploration ("BFS" or "DFS")
   \param certificate Type of certificate to produce (see tck_reach_certificate_t)
   \param block_size Block size for internal computation
   \param table_size Table size for internal computation
+  \param swarm Number of instances for swarm verification (0 for no swarm)
+  \param checkpoint_file File where the state of the run is saved periodically (empty for no checkpoint, reach only)
+  \param checkpoint_interval Time interval between two checkpoints, in seconds
+  \param resume_file Checkpoint file to resume the run from (empty to start from the initial states, reach only)
+  \param spill_directory Directory where zones and valuations of integer variables are spilled to memory-mapped files
+  when memory runs low (empty to keep them in memory, reach and covreach only)
+  \param stream_graph Output the graph certificate while it is explored, in exploration order (reach only)
+  \param slice Remove the processes, variables and clocks outside the cone of influence of the labels before
+  exploration (see tchecker::ta::cone_of_influence_t), certificates then refer to the sliced system
+  \param merge_clocks Merge the clocks that have the same value in every reachable state before exploration (see
+  tchecker::ta::clock_equivalence_t), certificates then refer to the merged system
+  \param huge_pages Back the allocation blocks of states and graphs, and large hash tables, by huge pages (reach and
+  covreach only, see tchecker::pool_t::huge_pages and tchecker::huge_pages_allocator_t)
+  \param incremental_gc Collect unused states, nodes and edges incrementally during the run (covreach only, see
+  tchecker::incremental_collector_t)
+  \param max_memory Memory budget of states and graphs in bytes (0 for no budget, reach and covreach only, see
+  tchecker::memory_budget_t)
+  \param memory_stats Output memory reserved and live in each subsystem along with statistics (reach and covreach
+  only, see tchecker::memory_stats_t)
+  \param progress_interval Time interval between two progress reports in seconds (0 for no report, reach and covreach
+  only, see tchecker::progress_reporter_t)
+  \param progress_file File of progress reports in JSON lines format (empty to report to standard error in text
+  format)
   \note state_space_storage will only be used, if algorithm == ALGO_REACH
+  \note if swarm > 0, algorithm and search_order are ignored: swarm diversified
+  searches are run in parallel and the first one that terminates provides the
+  result and the certificate (see tchecker::algorithms::zg_swarm::run)
+  \note a resumed run does not know the edges explored before the checkpoint, hence it does not produce any
+  certificate
+  \note with a memory budget, the graph stops storing edges when memory gets close to max_memory, and no
+  certificate is produced then. The exploration stops when max_memory is exceeded: negative verdicts
+  (REACHABLE and PROPERTY_i_REACHABLE) are then reported as inconclusive
   \note This is the C++ API. For C/FFI usage, see the C-compatible version above.
 */
   void tck_reach(std::string output_filename, 
@@ -145,7 +182,18 @@ namespace publicapi {
                  std::string search_order, 
                  tck_reach_certificate_t certificate, 
                  std::size_t block_size, 
-                 std::size_t table_size);
+                 std::size_t table_size,
+                 std::size_t swarm = 0,
+                 std::string checkpoint_file = "",
+                 std::size_t checkpoint_interval = 600,
+                 std::string resume_file = "",
+                 std::string spill_directory = "",
+                 bool stream_graph = false,
+                 bool slice = false,
+                 bool merge_clocks = false,
+                 enum tchecker::huge_pages_t huge_pages = tchecker::HUGE_PAGES_NONE, bool incremental_gc = false,
+                 std::size_t max_memory = 0, bool memory_stats = false, std::size_t progress_interval = 0,
+                 std::string progress_file = "");
 
 } // end of namespace publicapi
 
@@ -202,7 +202,23 @@ public:
    \brief Accessor
    \return Memory used by this state allocator
    */
-  std::size_t memsize() const { return tchecker::ta::details::state_pool_allocator_t<STATE>::memsize() + _zone_pool.memsize(); }
+  std::size_t memsize() const
+  {
+    return tchecker::ta::details::state_pool_allocator_t<STATE>::memsize() + _zone_pool.memsize() + _zone_cache->memsize();
+  }
+
+  /*!
+   \brief Accumulate memory statistics
+   \param stats : memory statistics
+   \post the memory of states and of their components, and of the sharing
+   caches of components, has been added to stats
+   */
+  void memory_stats(tchecker::memory_stats_t & stats) const
+  {
+    tchecker::ta::details::state_pool_allocator_t<STATE>::memory_stats(stats);
+    stats.add(tchecker::MEMORY_ZONES, _zone_pool.memsize(), _zone_pool.livesize());
+    stats.add(tchecker::MEMORY_HASHTABLE, _zone_cache->memsize(), _zone_cache->livesize());
+  }
 
 protected:
   /*!
@@ -257,6 +273,7 @@ public:
   using tchecker::ta::details::transition_pool_allocator_t<TRANSITION>::share;
   using tchecker::ta::details::transition_pool_allocator_t<TRANSITION>::destruct_all;
   using tchecker::ta::details::transition_pool_allocator_t<TRANSITION>::memsize;
+  using tchecker::ta::details::transition_pool_allocator_t<TRANSITION>::memory_stats;
 
 protected:
   using tchecker::ta::details::transition_pool_allocator_t<TRANSITION>::construct_from_transition;
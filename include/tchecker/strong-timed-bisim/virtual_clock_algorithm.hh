@@ -22,6 +22,7 @@
 #include "tchecker/strong-timed-bisim/visited_map.hh"
 #include "tchecker/strong-timed-bisim/contradiction.hh"
 #include "tchecker/strong-timed-bisim/non_bisim_cache.hh"
+#include "tchecker/utils/progress.hh"
 
 namespace tchecker {
 
@@ -43,10 +44,15 @@ public:
   \param input_second : the vcg of the second TA
   \param generate_witness : whether a witness/contradiction DAG should be generated
   \param generate_strategy : whether a strategy should be generated
+  \param progress : progress counters (nullptr for no progress reporting)
+  \note with progress, the numbers of visited pairs of symbolic states and of
+  pairs of TA states in the visited map are published to progress every
+  tchecker::PROGRESS_PERIOD visited pairs of symbolic states
    */
   Lieb_et_al(std::shared_ptr<tchecker::vcg::vcg_t> input_first, 
              std::shared_ptr<tchecker::vcg::vcg_t> input_second, 
-             bool generate_witness, bool generate_strategy);
+             bool generate_witness, bool generate_strategy,
+             tchecker::progress_t * progress = nullptr);
 
   /*!
    \brief running the algorithm of Lieb et al.
@@ -126,6 +132,8 @@ private:
   std::shared_ptr<non_bisim_cache::non_bisim_cache_t> _non_bisim_cache;
 
   const bool _witness;
+
+  tchecker::progress_t * _progress;
   
 };
 
@@ -46,6 +46,12 @@ public:
   */
   tchecker::clock_id_t no_of_virtual_clocks() const;
 
+  /*!
+   \brief Accessor
+   \return number of pairs of TA states in the visited map
+  */
+  std::size_t size() const;
+
   /*!
    \brief inserts given pair of symbolic states into visited map
    \param first : first symbolic state
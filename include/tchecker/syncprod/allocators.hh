@@ -191,7 +191,68 @@ public:
    \brief Accessor
    \return Memory used by this state allocator
    */
-  std::size_t memsize() const { return tchecker::ts::state_pool_allocator_t<STATE>::memsize() + _vloc_pool.memsize(); }
+  std::size_t memsize() const
+  {
+    return tchecker::ts::state_pool_allocator_t<STATE>::memsize() + _vloc_pool.memsize() + _vloc_cache->memsize();
+  }
+
+  /*!
+   \brief Accumulate memory statistics
+   \param stats : memory statistics
+   \post the memory of states, of tuples of locations and of their sharing cache
+   has been added to stats
+   */
+  void memory_stats(tchecker::memory_stats_t & stats) const
+  {
+    tchecker::ts::state_pool_allocator_t<STATE>::memory_stats(stats);
+    stats.add(tchecker::MEMORY_VLOCS, _vloc_pool.memsize(), _vloc_pool.livesize());
+    stats.add(tchecker::MEMORY_HASHTABLE, _vloc_cache->memsize(), _vloc_cache->livesize());
+  }
+
+  /*!
+   \brief Switch to concurrent mode
+   \param numa_local : whether memory is bound to the NUMA node of the thread
+   that allocates it
+   \pre no state has been allocated yet
+   \post states are allocated from per-thread pools (see
+   tchecker::pool_t::concurrent), as well as tuples of locations
+   \note caches of shared components are *NOT* thread-safe
+   \throw std::logic_error : if the precondition is not satisfied
+   */
+  void concurrent(bool numa_local = false)
+  {
+    tchecker::ts::state_pool_allocator_t<STATE>::concurrent(numa_local);
+    _vloc_pool.concurrent(numa_local);
+  }
+
+  /*!
+   \brief Back memory by huge pages
+   \param huge_pages : huge pages mode
+   \pre no state has been allocated yet
+   \post states and tuples of locations are allocated from memory backed by huge pages
+   according to huge_pages (see tchecker::pool_t::huge_pages), and so are the
+   buckets of the cache of tuples of locations (see tchecker::cache_t::huge_pages)
+   \throw std::logic_error : if the precondition is not satisfied
+   */
+  void huge_pages(enum tchecker::huge_pages_t huge_pages)
+  {
+    tchecker::ts::state_pool_allocator_t<STATE>::huge_pages(huge_pages);
+    _vloc_pool.huge_pages(huge_pages);
+    _vloc_cache->huge_pages(huge_pages);
+  }
+
+  /*!
+   \brief Enroll in an incremental garbage collector
+   \param collector : an incremental garbage collector
+   \post unused states, and unused tuples of locations, are collected by
+   collector
+   */
+  void enroll(tchecker::incremental_collector_t & collector)
+  {
+    tchecker::ts::state_pool_allocator_t<STATE>::enroll(collector);
+    collector.enroll(*_vloc_cache);
+    collector.enroll(_vloc_pool);
+  }
 
 protected:
   /*!
@@ -375,7 +436,49 @@ public:
    */
   std::size_t memsize() const
   {
-    return tchecker::ts::transition_pool_allocator_t<TRANSITION>::memsize() + _vedge_pool.memsize();
+    return tchecker::ts::transition_pool_allocator_t<TRANSITION>::memsize() + _vedge_pool.memsize() + _vedge_cache->memsize();
+  }
+
+  /*!
+   \brief Accumulate memory statistics
+   \param stats : memory statistics
+   \post the memory of transitions, of tuples of edges and of their sharing
+   cache has been added to stats
+   */
+  void memory_stats(tchecker::memory_stats_t & stats) const
+  {
+    tchecker::ts::transition_pool_allocator_t<TRANSITION>::memory_stats(stats);
+    stats.add(tchecker::MEMORY_VEDGES, _vedge_pool.memsize(), _vedge_pool.livesize());
+    stats.add(tchecker::MEMORY_HASHTABLE, _vedge_cache->memsize(), _vedge_cache->livesize());
+  }
+
+  /*!
+   \brief Switch to concurrent mode
+   \param numa_local : whether memory is bound to the NUMA node of the thread
+   that allocates it
+   \pre no transition has been allocated yet
+   \post transitions are allocated from per-thread pools (see
+   tchecker::pool_t::concurrent), as well as tuples of edges
+   \note caches of shared components are *NOT* thread-safe
+   \throw std::logic_error : if the precondition is not satisfied
+   */
+  void concurrent(bool numa_local = false)
+  {
+    tchecker::ts::transition_pool_allocator_t<TRANSITION>::concurrent(numa_local);
+    _vedge_pool.concurrent(numa_local);
+  }
+
+  /*!
+   \brief Enroll in an incremental garbage collector
+   \param collector : an incremental garbage collector
+   \post unused transitions, and unused tuples of edges, are collected by
+   collector
+   */
+  void enroll(tchecker::incremental_collector_t & collector)
+  {
+    tchecker::ts::transition_pool_allocator_t<TRANSITION>::enroll(collector);
+    collector.enroll(*_vedge_cache);
+    collector.enroll(_vedge_pool);
   }
 
 protected:
@@ -0,0 +1,136 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_PACKED_VLOC_HH
+#define TCHECKER_PACKED_VLOC_HH
+
+#include <cstdint>
+#include <vector>
+
+#include "tchecker/basictypes.hh"
+#include "tchecker/syncprod/vloc.hh"
+#include "tchecker/system/system.hh"
+
+/*!
+ \file packed_vloc.hh
+ \brief Bit-packed tuples of locations
+ */
+
+namespace tchecker {
+
+/*!
+ \class vloc_packing_t
+ \brief Layout of bit-packed tuples of locations
+ \note The location of a process with n locations is stored as its index among
+ the locations of the process, plus 1, on ceil(log2(n+1)) bits. Value 0 stands
+ for tchecker::NO_LOC. Processes are laid out in order of identifiers, and a
+ process that does not fit in the remaining bits of a word starts a new word,
+ hence packing and unpacking never read more than one word per process
+ \note Packed tuples of locations are the stored form of tuples of locations in
+ checkpoints (see tchecker::algorithms::zg_reach::save_checkpoint). The states
+ of the explorers keep tchecker::vloc_t: the synchronized product computes
+ successors on it in place, and tuples of locations are already hash-consed by
+ the state allocators
+ */
+class vloc_packing_t {
+public:
+  /*!
+   \brief Constructor
+   \param system : a system
+   \post this is the layout of packed tuples of locations of system
+   */
+  vloc_packing_t(tchecker::system::system_t const & system);
+
+  /*!
+   \brief Copy constructor
+   */
+  vloc_packing_t(tchecker::vloc_packing_t const &) = default;
+
+  /*!
+   \brief Move constructor
+   */
+  vloc_packing_t(tchecker::vloc_packing_t &&) = default;
+
+  /*!
+   \brief Destructor
+   */
+  ~vloc_packing_t() = default;
+
+  /*!
+   \brief Assignment operator
+   */
+  tchecker::vloc_packing_t & operator=(tchecker::vloc_packing_t const &) = default;
+
+  /*!
+   \brief Move-assignment operator
+   */
+  tchecker::vloc_packing_t & operator=(tchecker::vloc_packing_t &&) = default;
+
+  /*!
+   \brief Accessor
+   \return number of processes
+   */
+  inline std::size_t processes_count() const { return _fields.size(); }
+
+  /*!
+   \brief Accessor
+   \return number of words in packed tuples of locations
+   */
+  inline std::size_t words_count() const { return _words_count; }
+
+  /*!
+   \brief Accessor
+   \param pid : process identifier
+   \pre pid < processes_count()
+   \return number of bits used to store the location of process pid
+   */
+  inline unsigned bits(tchecker::process_id_t pid) const { return _fields[pid].bits; }
+
+  /*!
+   \brief Pack a tuple of locations
+   \param vloc : tuple of locations
+   \param words : array of packed words
+   \pre vloc has size processes_count(), words has size words_count()
+   \post words contains the packed tuple of locations vloc
+   \throw std::invalid_argument : if vloc does not have size processes_count(),
+   or if a location in vloc does not belong to its process
+   */
+  void pack(tchecker::vloc_t const & vloc, tchecker::packed_word_t * words) const;
+
+  /*!
+   \brief Unpack a tuple of locations
+   \param words : array of packed words
+   \param vloc : tuple of locations
+   \pre words has size words_count() and has been filled by pack, vloc has size
+   processes_count()
+   \post vloc is the tuple of locations packed in words
+   \throw std::invalid_argument : if vloc does not have size processes_count(),
+   or if words does not encode a tuple of locations
+   */
+  void unpack(tchecker::packed_word_t const * words, tchecker::vloc_t & vloc) const;
+
+private:
+  /*!
+   \brief Position of a process in packed tuples of locations
+   */
+  struct field_t {
+    std::uint32_t word;           /*!< Index of the word that stores the process location */
+    unsigned shift;               /*!< Position of the first bit in the word */
+    unsigned bits;                /*!< Number of bits */
+    tchecker::packed_word_t mask; /*!< Mask of bits (before shift) */
+  };
+
+  std::vector<field_t> _fields;                            /*!< Map : process ID -> position */
+  std::size_t _words_count;                                /*!< Number of words */
+  std::vector<tchecker::process_id_t> _process;            /*!< Map : location ID -> process ID */
+  std::vector<tchecker::loc_id_t> _index;                  /*!< Map : location ID -> index in process locations */
+  std::vector<std::vector<tchecker::loc_id_t>> _locations; /*!< Map : process ID -> locations of the process */
+};
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_PACKED_VLOC_HH
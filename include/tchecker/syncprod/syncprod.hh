@@ -9,6 +9,7 @@
 #define TCHECKER_SYNCPROD_SYNCPROD_HH
 
 #include <cstdlib>
+#include <vector>
 
 #include <boost/dynamic_bitset/dynamic_bitset.hpp>
 #include <boost/iterator/filter_iterator.hpp>
@@ -121,6 +122,21 @@ public:
   */
   final_iterator_t(tchecker::syncprod::system_t const & system, boost::dynamic_bitset<> final_labels);
 
+  /*!
+   \brief Constructor
+   \param system : system of synchronized processes
+   \param final_labels : labels on final states
+   \param locations : range of locations of each process
+   \pre locations has one range of locations of process pid at index pid, for
+   every process pid in system
+   \post this iterator ranges over final edges in system that match final_labels
+   and that only have locations in locations
+   \throw std::invalid_argument : if locations does not have one range per
+   process in system
+  */
+  final_iterator_t(tchecker::syncprod::system_t const & system, boost::dynamic_bitset<> final_labels,
+                   std::vector<tchecker::range_t<tchecker::system::locs_t::const_iterator_t>> const & locations);
+
   /*!
    \brief Copy contructor
   */
@@ -211,6 +227,20 @@ using final_range_t = tchecker::range_t<tchecker::syncprod::final_iterator_t, tc
 tchecker::syncprod::final_range_t final_edges(tchecker::syncprod::system_t const & system,
                                               boost::dynamic_bitset<> const & labels);
 
+/*!
+ \brief Accessor to final edges restricted to some locations
+ \param system : a system
+ \param labels : a set of labels
+ \param locations : range of locations of each process
+ \return range of final edges, i.e. edges to tuple of locations that match labels,
+ where the location of each process pid is in locations[pid]
+ \throw std::invalid_argument : if locations does not have one range per process
+ in system
+ */
+tchecker::syncprod::final_range_t
+final_edges(tchecker::syncprod::system_t const & system, boost::dynamic_bitset<> const & labels,
+            std::vector<tchecker::range_t<tchecker::system::locs_t::const_iterator_t>> const & locations);
+
 /*!
  \brief Dereference type for iterator over final edges
  */
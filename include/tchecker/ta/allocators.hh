@@ -196,7 +196,78 @@ public:
    */
   std::size_t memsize() const
   {
-    return tchecker::syncprod::details::state_pool_allocator_t<STATE>::memsize() + _intval_pool.memsize();
+    return tchecker::syncprod::details::state_pool_allocator_t<STATE>::memsize() + _intval_pool.memsize() +
+           _intval_cache->memsize();
+  }
+
+  /*!
+   \brief Accumulate memory statistics
+   \param stats : memory statistics
+   \post the memory of states and of their components, and of the sharing
+   caches of components, has been added to stats
+   */
+  void memory_stats(tchecker::memory_stats_t & stats) const
+  {
+    tchecker::syncprod::details::state_pool_allocator_t<STATE>::memory_stats(stats);
+    stats.add(tchecker::MEMORY_INTVALS, _intval_pool.memsize(), _intval_pool.livesize());
+    stats.add(tchecker::MEMORY_HASHTABLE, _intval_cache->memsize(), _intval_cache->livesize());
+  }
+
+  /*!
+   \brief Spill valuations of bounded integer variables to disk
+   \param directory : directory of segment files
+   \pre no state has been allocated yet
+   \post valuations of bounded integer variables are allocated from memory-mapped
+   segment files in directory (see tchecker::pool_t::spill)
+   \throw std::logic_error : if the precondition is not satisfied
+   */
+  void spill(std::string const & directory) { _intval_pool.spill(directory); }
+
+  /*!
+   \brief Switch to concurrent mode
+   \param numa_local : whether memory is bound to the NUMA node of the thread
+   that allocates it
+   \pre no state has been allocated yet
+   \post states are allocated from per-thread pools (see
+   tchecker::pool_t::concurrent), as well as tuples of locations and valuations of bounded
+   integer variables
+   \note caches of shared components are *NOT* thread-safe
+   \throw std::logic_error : if the precondition is not satisfied
+   */
+  void concurrent(bool numa_local = false)
+  {
+    tchecker::syncprod::details::state_pool_allocator_t<STATE>::concurrent(numa_local);
+    _intval_pool.concurrent(numa_local);
+  }
+
+  /*!
+   \brief Back memory by huge pages
+   \param huge_pages : huge pages mode
+   \pre no state has been allocated yet
+   \post states, tuples of locations and valuations of bounded integer
+   variables are allocated from memory backed by huge pages
+   according to huge_pages (see tchecker::pool_t::huge_pages), and so are the
+   buckets of their caches (see tchecker::cache_t::huge_pages)
+   \throw std::logic_error : if the precondition is not satisfied
+   */
+  void huge_pages(enum tchecker::huge_pages_t huge_pages)
+  {
+    tchecker::syncprod::details::state_pool_allocator_t<STATE>::huge_pages(huge_pages);
+    _intval_pool.huge_pages(huge_pages);
+    _intval_cache->huge_pages(huge_pages);
+  }
+
+  /*!
+   \brief Enroll in an incremental garbage collector
+   \param collector : an incremental garbage collector
+   \post unused states, unused tuples of locations, and unused valuations of
+   bounded integer variables are collected by collector
+   */
+  void enroll(tchecker::incremental_collector_t & collector)
+  {
+    tchecker::syncprod::details::state_pool_allocator_t<STATE>::enroll(collector);
+    collector.enroll(*_intval_cache);
+    collector.enroll(_intval_pool);
   }
 
 protected:
@@ -251,6 +322,9 @@ public:
   using tchecker::syncprod::details::transition_pool_allocator_t<TRANSITION>::share;
   using tchecker::syncprod::details::transition_pool_allocator_t<TRANSITION>::destruct_all;
   using tchecker::syncprod::details::transition_pool_allocator_t<TRANSITION>::memsize;
+  using tchecker::syncprod::details::transition_pool_allocator_t<TRANSITION>::memory_stats;
+  using tchecker::syncprod::details::transition_pool_allocator_t<TRANSITION>::concurrent;
+  using tchecker::syncprod::details::transition_pool_allocator_t<TRANSITION>::enroll;
 
 protected:
   using tchecker::syncprod::details::transition_pool_allocator_t<TRANSITION>::construct_from_transition;
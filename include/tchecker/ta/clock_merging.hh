@@ -0,0 +1,124 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_TA_CLOCK_MERGING_HH
+#define TCHECKER_TA_CLOCK_MERGING_HH
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "tchecker/basictypes.hh"
+#include "tchecker/parsing/declaration.hh"
+#include "tchecker/ta/system.hh"
+
+/*!
+ \file clock_merging.hh
+ \brief Detection and merging of equivalent clocks in systems of timed processes
+ */
+
+namespace tchecker {
+
+namespace ta {
+
+/*!
+ \class clock_equivalence_t
+ \brief Partition of the clocks of a system in classes of clocks that have the
+ same value in every reachable state
+ \note All clocks are initially 0 and elapse at the same rate, hence two clocks
+ are equivalent if, on every edge of the system, they are either both left
+ unchanged or both reset to the same constant value. The partition is computed
+ by refinement w.r.t. the clock updates of each edge (see
+ tchecker::compute_clock_updates). Guards and invariants are not needed: they
+ read equivalent clocks in the same state. Clocks that are updated to another
+ clock, to a non-constant value or to undetermined values, as well as clock
+ arrays, are only equivalent to themselves
+ */
+class clock_equivalence_t {
+public:
+  /*!
+   \brief Constructor
+   \param system : a system of timed processes
+   \post this is the partition of the flattened clocks of system in classes of
+   equivalent clocks
+   */
+  clock_equivalence_t(tchecker::ta::system_t const & system);
+
+  /*!
+   \brief Copy constructor
+   */
+  clock_equivalence_t(tchecker::ta::clock_equivalence_t const &) = default;
+
+  /*!
+   \brief Move constructor
+   */
+  clock_equivalence_t(tchecker::ta::clock_equivalence_t &&) = default;
+
+  /*!
+   \brief Destructor
+   */
+  ~clock_equivalence_t() = default;
+
+  /*!
+   \brief Assignment operator
+   */
+  tchecker::ta::clock_equivalence_t & operator=(tchecker::ta::clock_equivalence_t const &) = default;
+
+  /*!
+   \brief Move-assignment operator
+   */
+  tchecker::ta::clock_equivalence_t & operator=(tchecker::ta::clock_equivalence_t &&) = default;
+
+  /*!
+   \brief Accessor
+   \param id : flattened clock identifier
+   \pre id is a flattened clock identifier in the system
+   \return smallest flattened clock identifier in the class of id
+   \throw std::invalid_argument : if id is not a flattened clock identifier
+   */
+  tchecker::clock_id_t representative(tchecker::clock_id_t id) const;
+
+  /*!
+   \brief Accessor
+   \return number of classes of equivalent clocks
+   */
+  std::size_t classes_count() const;
+
+  /*!
+   \brief Accessor
+   \return number of flattened clocks
+   */
+  inline std::size_t clocks_count() const { return _representative.size(); }
+
+private:
+  std::vector<tchecker::clock_id_t> _representative; /*!< Map : flattened clock ID -> representative clock ID */
+};
+
+/*!
+ \brief Merge equivalent clocks in a system declaration
+ \param sysdecl : a system declaration
+ \param system : system of timed processes built from sysdecl
+ \param equivalence : equivalence of clocks in system
+ \return a declaration of the system obtained from sysdecl by removing the
+ declarations of the clocks that are not the representative of their class in
+ equivalence, and by renaming these clocks into their representative in the
+ guards, statements and invariants of edges and locations
+ \note renaming is done on the attributes "provided", "do" and "invariant" at
+ the level of identifiers, hence a local variable in a statement that has the
+ name of a merged clock is renamed as well
+ \note the declarations of processes, events, clocks, bounded integer variables
+ and synchronizations are shared with sysdecl
+ */
+std::shared_ptr<tchecker::parsing::system_declaration_t>
+merge_clocks(tchecker::parsing::system_declaration_t const & sysdecl, tchecker::ta::system_t const & system,
+             tchecker::ta::clock_equivalence_t const & equivalence);
+
+} // end of namespace ta
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_TA_CLOCK_MERGING_HH
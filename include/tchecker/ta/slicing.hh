@@ -0,0 +1,131 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_TA_SLICING_HH
+#define TCHECKER_TA_SLICING_HH
+
+#include <memory>
+
+#include <boost/dynamic_bitset.hpp>
+
+#include "tchecker/parsing/declaration.hh"
+#include "tchecker/ta/system.hh"
+
+/*!
+ \file slicing.hh
+ \brief Cone-of-influence slicing of systems of timed processes
+ */
+
+namespace tchecker {
+
+namespace ta {
+
+/*!
+ \brief Check if a process constrains other processes
+ \param system : a system of timed processes
+ \param pid : process identifier
+ \return true if process pid has no initial location, or has an invariant, an
+ urgent or a committed location, false otherwise
+ */
+bool is_constraining_process(tchecker::ta::system_t const & system, tchecker::process_id_t pid);
+
+/*!
+ \class cone_of_influence_t
+ \brief Processes, bounded integer variables and clocks that may influence the
+ reachability of a set of labels
+ \note The cone of influence is computed at the granularity of processes. It
+ initially contains the processes with a location that has one of the labels,
+ and the processes that may constrain other processes regardless of
+ synchronizations and variables: processes with an invariant, an urgent or a
+ committed location, and processes without initial location. It is then closed
+ w.r.t. synchronization (all the processes in a synchronization vector that
+ involves a process in the cone) and variables (all the processes that write a
+ variable that is read by a process in the cone). Variables are in the cone if
+ they are accessed by a process in the cone
+ */
+class cone_of_influence_t {
+public:
+  /*!
+   \brief Constructor
+   \param system : a system of timed processes
+   \param labels : set of labels
+   \pre labels has size system.labels_count()
+   \post this is the cone of influence of labels in system
+   \throw std::invalid_argument : if labels does not have size
+   system.labels_count()
+   */
+  cone_of_influence_t(tchecker::ta::system_t const & system, boost::dynamic_bitset<> const & labels);
+
+  /*!
+   \brief Copy constructor
+   */
+  cone_of_influence_t(tchecker::ta::cone_of_influence_t const &) = default;
+
+  /*!
+   \brief Move constructor
+   */
+  cone_of_influence_t(tchecker::ta::cone_of_influence_t &&) = default;
+
+  /*!
+   \brief Destructor
+   */
+  ~cone_of_influence_t() = default;
+
+  /*!
+   \brief Assignment operator
+   */
+  tchecker::ta::cone_of_influence_t & operator=(tchecker::ta::cone_of_influence_t const &) = default;
+
+  /*!
+   \brief Move-assignment operator
+   */
+  tchecker::ta::cone_of_influence_t & operator=(tchecker::ta::cone_of_influence_t &&) = default;
+
+  /*!
+   \brief Accessor
+   \return set of process identifiers in the cone
+   */
+  inline boost::dynamic_bitset<> const & processes() const { return _processes; }
+
+  /*!
+   \brief Accessor
+   \return set of flattened bounded integer variable identifiers in the cone
+   */
+  inline boost::dynamic_bitset<> const & intvars() const { return _intvars; }
+
+  /*!
+   \brief Accessor
+   \return set of flattened clock identifiers in the cone
+   */
+  inline boost::dynamic_bitset<> const & clocks() const { return _clocks; }
+
+private:
+  boost::dynamic_bitset<> _processes; /*!< Processes in the cone */
+  boost::dynamic_bitset<> _intvars;   /*!< Flattened bounded integer variables in the cone */
+  boost::dynamic_bitset<> _clocks;    /*!< Flattened clocks in the cone */
+};
+
+/*!
+ \brief Slice a system declaration
+ \param sysdecl : a system declaration
+ \param system : system of timed processes built from sysdecl
+ \param coi : cone of influence in system
+ \return a declaration of the system obtained from sysdecl by removing the
+ processes (along with their locations and edges), the bounded integer
+ variables and the clocks that are not in coi, as well as the synchronizations
+ that involve a removed process. Events are kept
+ \note the declarations in the returned system are shared with sysdecl
+ */
+std::shared_ptr<tchecker::parsing::system_declaration_t> slice(tchecker::parsing::system_declaration_t const & sysdecl,
+                                                               tchecker::ta::system_t const & system,
+                                                               tchecker::ta::cone_of_influence_t const & coi);
+
+} // end of namespace ta
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_TA_SLICING_HH
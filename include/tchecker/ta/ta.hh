@@ -9,6 +9,7 @@
 #define TCHECKER_TA_HH
 
 #include <cstdlib>
+#include <vector>
 
 #include <boost/dynamic_bitset.hpp>
 
@@ -136,6 +137,20 @@ using final_range_t = tchecker::range_t<tchecker::ta::final_iterator_t, tchecker
  */
 tchecker::ta::final_range_t final_edges(tchecker::ta::system_t const & system, boost::dynamic_bitset<> const & labels);
 
+/*!
+ \brief Accessor to final edges restricted to some locations
+ \param system : a system
+ \param labels : a set of labels
+ \param locations : range of locations of each process
+ \return range of final edges, i.e. edges to tuple of locations that match labels,
+ where the location of each process pid is in locations[pid]
+ \throw std::invalid_argument : if locations does not have one range per process
+ in system
+ */
+tchecker::ta::final_range_t
+final_edges(tchecker::ta::system_t const & system, boost::dynamic_bitset<> const & labels,
+            std::vector<tchecker::range_t<tchecker::system::locs_t::const_iterator_t>> const & locations);
+
 /*!
  \brief Dereference type for iterator over final edges
  */
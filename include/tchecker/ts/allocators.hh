@@ -11,6 +11,8 @@
 #include "tchecker/ts/state.hh"
 #include "tchecker/ts/transition.hh"
 #include "tchecker/utils/allocation_size.hh"
+#include "tchecker/utils/incremental_collector.hh"
+#include "tchecker/utils/memory_stats.hh"
 #include "tchecker/utils/pool.hh"
 #include "tchecker/utils/shared_objects.hh"
 #include "tchecker/utils/singleton_pool.hh"
@@ -144,6 +146,44 @@ public:
    */
   std::size_t memsize() const { return _state_pool.memsize(); }
 
+  /*!
+   \brief Accumulate memory statistics
+   \param stats : memory statistics
+   \post the memory of states has been added to stats
+   */
+  void memory_stats(tchecker::memory_stats_t & stats) const
+  {
+    stats.add(tchecker::MEMORY_STATES, _state_pool.memsize(), _state_pool.livesize());
+  }
+
+  /*!
+   \brief Switch to concurrent mode
+   \param numa_local : whether memory is bound to the NUMA node of the thread
+   that allocates it
+   \pre no state has been allocated yet
+   \post states are allocated from per-thread pools (see
+   tchecker::pool_t::concurrent)
+   \throw std::logic_error : if the precondition is not satisfied
+   */
+  void concurrent(bool numa_local = false) { _state_pool.concurrent(numa_local); }
+
+  /*!
+   \brief Back memory by huge pages
+   \param huge_pages : huge pages mode
+   \pre no state has been allocated yet
+   \post states are allocated from memory backed by huge pages
+   according to huge_pages (see tchecker::pool_t::huge_pages)
+   \throw std::logic_error : if the precondition is not satisfied
+   */
+  void huge_pages(enum tchecker::huge_pages_t huge_pages) { _state_pool.huge_pages(huge_pages); }
+
+  /*!
+   \brief Enroll in an incremental garbage collector
+   \param collector : an incremental garbage collector
+   \post unused states are collected by collector
+   */
+  void enroll(tchecker::incremental_collector_t & collector) { collector.enroll(_state_pool); }
+
 protected:
   /*!
    \brief Construct a state from a state
@@ -283,6 +323,34 @@ public:
    */
   std::size_t memsize() const { return _transition_pool.memsize(); }
 
+  /*!
+   \brief Accumulate memory statistics
+   \param stats : memory statistics
+   \post the memory of transitions has been added to stats
+   */
+  void memory_stats(tchecker::memory_stats_t & stats) const
+  {
+    stats.add(tchecker::MEMORY_TRANSITIONS, _transition_pool.memsize(), _transition_pool.livesize());
+  }
+
+  /*!
+   \brief Switch to concurrent mode
+   \param numa_local : whether memory is bound to the NUMA node of the thread
+   that allocates it
+   \pre no transition has been allocated yet
+   \post transitions are allocated from per-thread pools (see
+   tchecker::pool_t::concurrent)
+   \throw std::logic_error : if the precondition is not satisfied
+   */
+  void concurrent(bool numa_local = false) { _transition_pool.concurrent(numa_local); }
+
+  /*!
+   \brief Enroll in an incremental garbage collector
+   \param collector : an incremental garbage collector
+   \post unused transitions are collected by collector
+   */
+  void enroll(tchecker::incremental_collector_t & collector) { collector.enroll(_transition_pool); }
+
 protected:
   /*!
    \brief Construct a transition from a transition
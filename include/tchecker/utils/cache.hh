@@ -13,7 +13,9 @@
  \brief Cache of shared objects
  */
 
+#include <algorithm>
 #include <limits>
+#include <tuple>
 #include <vector>
 
 #include "tchecker/utils/hashtable.hh"
@@ -38,13 +40,14 @@ using cached_object_t = tchecker::hashtable_object_t;
  default constructible
  \note stored objects should derive from tchecker::cached_object_t
  */
-template <class SPTR, class HASH, class EQUAL> class cache_t : public tchecker::collectable_t {
+template <class SPTR, class HASH, class EQUAL>
+class cache_t : public tchecker::collectable_t, public tchecker::incremental_collectable_t {
 public:
   /*!
    \brief Constructor
    \param table_size : size of the hash table
    */
-  cache_t(std::size_t table_size = 65536) : _hashtable(table_size, _hash, _equal) {}
+  cache_t(std::size_t table_size = 65536) : _hashtable(table_size, _hash, _equal), _collect_bucket(0) {}
 
   /*!
    \brief Copy-construction
@@ -99,6 +102,16 @@ public:
    */
   inline void clear() { _hashtable.clear(); }
 
+  /*!
+   \brief Back the cache by huge pages
+   \param huge_pages : huge pages mode
+   \pre this cache is empty
+   \post the buckets of the cache are allocated from memory backed by huge pages
+   according to huge_pages (see tchecker::hashtable_t::huge_pages)
+   \throw std::logic_error : if the precondition is not satisfied
+   */
+  inline void huge_pages(enum tchecker::huge_pages_t huge_pages) { _hashtable.huge_pages(huge_pages); }
+
   /*!
    \brief Garbage collection
    \post All objects with reference counter 1 (i.e. objects with no reference
@@ -118,16 +131,57 @@ public:
     return previous_size - _hashtable.size();
   }
 
+  /*!
+   \brief Incremental garbage collection
+   \param size : number of objects to inspect
+   \post All objects with reference counter 1 in the next buckets of the hash
+   table, up to size objects, have been removed from this cache
+   \return number of collected objects, and true if the last bucket has been
+   reached, false otherwise
+   \note objects may be skipped, or inspected twice, in a pass during which the
+   hash table has been rehashed. They are inspected in the next pass
+   */
+  virtual std::tuple<std::size_t, bool> collect_slice(std::size_t size)
+  {
+    std::size_t const bucket_count = _hashtable.bucket_count();
+    std::size_t collected = 0, inspected = 0;
+    while ((_collect_bucket < bucket_count) && (inspected < size)) {
+      inspected += std::max<std::size_t>(_hashtable.bucket_size(_collect_bucket), 1);
+      collected += _hashtable.remove_if(_collect_bucket, [](SPTR const & o) { return o->refcount() == 1; });
+      ++_collect_bucket;
+    }
+
+    bool const completed = (_collect_bucket >= bucket_count);
+    if (completed)
+      _collect_bucket = 0;
+    return std::make_tuple(collected, completed);
+  }
+
   /*!
    \brief Accessor
    \return Number of objects in the cache
    */
   inline std::size_t size() const { return _hashtable.size(); }
 
+  /*!
+   \brief Accessor
+   \return Memory footprint of the cache, excluding cached objects (see
+   tchecker::hashtable_t::memsize)
+   */
+  inline std::size_t memsize() const { return _hashtable.memsize(); }
+
+  /*!
+   \brief Accessor
+   \return Memory used by the entries of the cache, excluding cached objects
+   (see tchecker::hashtable_t::livesize)
+   */
+  inline std::size_t livesize() const { return _hashtable.livesize(); }
+
 private:
   HASH _hash;                                          /*! Hash function */
   EQUAL _equal;                                        /*!< Equality predicate */
   tchecker::hashtable_t<SPTR, HASH, EQUAL> _hashtable; /*!< Table of stored objects */
+  std::size_t _collect_bucket;                         /*!< Next bucket to collect (see collect_slice) */
 };
 
 /*!
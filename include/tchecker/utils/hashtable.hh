@@ -13,10 +13,12 @@
  \brief Hashtable of shared objects
  */
 
+#include <stdexcept>
 #include <unordered_set>
 #include <vector>
 
 #include "tchecker/utils/iterator.hh"
+#include "tchecker/utils/segments.hh"
 #include "tchecker/utils/shared_objects.hh"
 
 namespace tchecker {
@@ -151,6 +153,7 @@ private:
 template <class SPTR, class HASH> class collision_table_t {
 protected:
   using collision_list_t = std::vector<SPTR>;
+  using table_t = std::vector<collision_list_t, tchecker::huge_pages_allocator_t<collision_list_t>>;
 
 public:
   /*!
@@ -256,12 +259,42 @@ public:
     remove(o->position_in_table(), o->position_in_collision_list());
   }
 
+  /*!
+   \brief Back the table by huge pages
+   \param huge_pages : huge pages mode
+   \pre this collision table is empty
+   \post the table of collision lists is allocated from memory backed by huge
+   pages according to huge_pages (see tchecker::huge_pages_allocator_t). The
+   collision lists are allocated from the heap
+   \throw std::logic_error : if the precondition is not satisfied
+   */
+  void huge_pages(enum tchecker::huge_pages_t huge_pages)
+  {
+    if (_size != 0)
+      throw std::logic_error("cannot use huge pages in a collision table that stores objects");
+    _table = table_t(_table.size(), tchecker::huge_pages_allocator_t<collision_list_t>{huge_pages});
+  }
+
   /*!
    \brief Accessor
    \return Number of objects in this collision table
    */
   inline std::size_t size() const { return _size; }
 
+  /*!
+   \brief Accessor
+   \return Memory footprint of this collision table, excluding stored objects
+   \note Constant time estimate, that ignores unused capacity of collision lists
+   */
+  inline std::size_t memsize() const { return _table.capacity() * sizeof(collision_list_t) + _size * sizeof(SPTR); }
+
+  /*!
+   \brief Accessor
+   \return Memory used by the entries of this collision table, excluding stored
+   objects
+   */
+  inline std::size_t livesize() const { return _size * sizeof(SPTR); }
+
   /*!
    \class iterator_t
    \brief Type of iterator over the objects in the table
@@ -275,7 +308,7 @@ public:
      \pre position_in_table <= table->size() (checked by assertion)
      \post this keeps a pointer to table
      */
-    iterator_t(std::vector<collision_list_t> * table, tchecker::collision_table_position_t position_in_table)
+    iterator_t(table_t * table, tchecker::collision_table_position_t position_in_table)
         : _table(table), _position_in_table(position_in_table), _position_in_collision_list(0)
     {
       assert(position_in_table <= table->size());
@@ -389,7 +422,7 @@ public:
       return (_position_in_table < _table->size() && _position_in_collision_list < (*_table)[_position_in_table].size());
     }
 
-    std::vector<collision_list_t> * _table;                           /*!< Pointer to iterated collision table */
+    table_t * _table;                                                 /*!< Pointer to iterated collision table */
     tchecker::collision_table_position_t _position_in_table;          /*!< Position in _table */
     tchecker::collision_table_position_t _position_in_collision_list; /*!< Position in _table[_position_in_table] */
     /* NB: implementation based on vector iterators would be more elegant,
@@ -439,7 +472,7 @@ public:
   /*!
    \brief Type of const iterator over the object in the table
    */
-  using const_iterator_t = tchecker::join_iterator_t<tchecker::range_t<typename std::vector<collision_list_t>::const_iterator>,
+  using const_iterator_t = tchecker::join_iterator_t<tchecker::range_t<typename table_t::const_iterator>,
                                                      tchecker::range_t<typename collision_list_t::const_iterator>>;
 
   /*!
@@ -586,14 +619,14 @@ protected:
    \return A range (begin, end) of objects in the collision list pointed by it
    */
   static tchecker::range_t<typename collision_list_t::const_iterator>
-  extract_collision_list_const_range(typename std::vector<collision_list_t>::const_iterator const & it)
+  extract_collision_list_const_range(typename table_t::const_iterator const & it)
   {
     return tchecker::make_range(it->begin(), it->end());
   }
 
-  std::vector<collision_list_t> _table; /*!< Table with collision lists */
-  HASH _hash;                           /*!< Hash function */
-  std::size_t _size;                    /*!< Number of stored objects */
+  table_t _table;    /*!< Table with collision lists */
+  HASH _hash;        /*!< Hash function */
+  std::size_t _size; /*!< Number of stored objects */
 };
 
 /*!
@@ -612,6 +645,9 @@ class hashtable_object_t {};
  \note stored objects should derive from tchecker::hashtable_object_t
 */
 template <class SPTR, class HASH, class EQUAL> class hashtable_t {
+protected:
+  using container_t = std::unordered_set<SPTR, HASH, EQUAL, tchecker::huge_pages_allocator_t<SPTR>>;
+
 public:
   /*!
    \brief Constructor
@@ -668,6 +704,23 @@ public:
    */
   void clear() { _table.clear(); }
 
+  /*!
+   \brief Back buckets by huge pages
+   \param huge_pages : huge pages mode
+   \pre this hash table is empty
+   \post the array of buckets is allocated from memory backed by huge pages
+   according to huge_pages (see tchecker::huge_pages_allocator_t). The elements
+   are allocated from the heap
+   \throw std::logic_error : if the precondition is not satisfied
+   */
+  void huge_pages(enum tchecker::huge_pages_t huge_pages)
+  {
+    if (!_table.empty())
+      throw std::logic_error("cannot use huge pages in a hash table that stores objects");
+    _table = container_t(_table.bucket_count(), _table.hash_function(), _table.key_eq(),
+                         tchecker::huge_pages_allocator_t<SPTR>{huge_pages});
+  }
+
   /*!
    \brief Add object to the hashtable
    \param o : an object
@@ -718,10 +771,28 @@ public:
    */
   inline std::size_t size() const { return _table.size(); }
 
+  /*!
+   \brief Accessor
+   \return Memory footprint of this hash table, excluding stored objects
+   \note Constant time estimate: each bucket holds a pointer, and each element
+   is stored in a node along with a pointer to the next node and a hash value
+   */
+  inline std::size_t memsize() const
+  {
+    return _table.bucket_count() * sizeof(void *) + _table.size() * (sizeof(SPTR) + sizeof(void *) + sizeof(std::size_t));
+  }
+
+  /*!
+   \brief Accessor
+   \return Memory used by the elements of this hash table, excluding stored
+   objects and buckets (see memsize)
+   */
+  inline std::size_t livesize() const { return _table.size() * (sizeof(SPTR) + sizeof(void *) + sizeof(std::size_t)); }
+
   /*!
    \brief Type of iterator
   */
-  using iterator_t = typename std::unordered_set<SPTR, HASH, EQUAL>::iterator;
+  using iterator_t = typename container_t::iterator;
 
   /*!
    \brief Iterator on first element (if any)
@@ -736,7 +807,7 @@ public:
   /*!
     \brief Type of const iterator
   */
-  using const_iterator_t = typename std::unordered_set<SPTR, HASH, EQUAL>::const_iterator;
+  using const_iterator_t = typename container_t::const_iterator;
 
   /*!
     \brief Const iterator on first element (if any)
@@ -772,8 +843,48 @@ public:
     return true;
   }
 
+  /*!
+   \brief Accessor
+   \return number of buckets in this hash table
+   */
+  inline std::size_t bucket_count() const { return _table.bucket_count(); }
+
+  /*!
+   \brief Accessor
+   \param n : bucket index
+   \pre n < bucket_count()
+   \return number of elements in bucket n
+   */
+  inline std::size_t bucket_size(std::size_t n) const { return _table.bucket_size(n); }
+
+  /*!
+   \brief Remove the elements of a bucket that satisfy a predicate
+   \tparam PRED : type of predicate over elements
+   \param n : bucket index
+   \param pred : predicate
+   \pre n < bucket_count()
+   \post all the elements in bucket n that satisfy pred have been removed from
+   this hash table
+   \return number of removed elements
+   */
+  template <class PRED> std::size_t remove_if(std::size_t n, PRED && pred)
+  {
+    std::size_t removed = 0;
+    auto it = _table.begin(n);
+    while (it != _table.end(n)) {
+      if (pred(*it)) {
+        _table.erase(_table.find(*it));
+        ++removed;
+        it = _table.begin(n); // erase invalidates iterators on bucket n
+      }
+      else
+        ++it;
+    }
+    return removed;
+  }
+
 protected:
-  std::unordered_set<SPTR, HASH, EQUAL> _table; /*!< Container */
+  container_t _table; /*!< Container */
 };
 
 } // end of namespace tchecker
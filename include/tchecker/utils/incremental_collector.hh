@@ -0,0 +1,115 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_INCREMENTAL_COLLECTOR_HH
+#define TCHECKER_INCREMENTAL_COLLECTOR_HH
+
+#include <chrono>
+#include <vector>
+
+#include "tchecker/utils/pool.hh"
+
+/*!
+ \file incremental_collector.hh
+ \brief Incremental garbage collection in time-bounded slices
+ */
+
+namespace tchecker {
+
+/*!
+ \class incremental_collector_t
+ \brief Garbage collector that collects unused objects from several data
+ structures, in small time-bounded slices
+ \note Data structures are collected in the order in which they have been
+ enrolled. They should be enrolled from the owners to the owned objects: a
+ collected object releases its references on the objects it owns, which can
+ then be collected later in the same pass. For instance, nodes of a graph should
+ be enrolled before states, and states before the caches of their components,
+ and caches before the pools of the components
+ \note The collector is *NOT* thread-safe. It should be run by the thread that
+ uses the enrolled data structures, between two steps of an algorithm
+ */
+class incremental_collector_t {
+public:
+  /*!
+   \brief Constructor
+   \param slice_size : number of objects inspected in a slice
+   \pre slice_size > 0
+   \throw std::invalid_argument : if slice_size is 0
+   */
+  incremental_collector_t(std::size_t slice_size = 4096);
+
+  /*!
+   \brief Copy constructor (deleted)
+   */
+  incremental_collector_t(tchecker::incremental_collector_t const &) = delete;
+
+  /*!
+   \brief Move constructor (deleted)
+   */
+  incremental_collector_t(tchecker::incremental_collector_t &&) = delete;
+
+  /*!
+   \brief Destructor
+   */
+  ~incremental_collector_t() = default;
+
+  /*!
+   \brief Assignment operator (deleted)
+   */
+  tchecker::incremental_collector_t & operator=(tchecker::incremental_collector_t const &) = delete;
+
+  /*!
+   \brief Move-assignment operator (deleted)
+   */
+  tchecker::incremental_collector_t & operator=(tchecker::incremental_collector_t &&) = delete;
+
+  /*!
+   \brief Enroll a data structure
+   \param collectable : a data structure
+   \post this collector keeps a pointer to collectable, and collects it after
+   the data structures that have been enrolled before
+   \note collectable should outlive this collector
+   */
+  void enroll(tchecker::incremental_collectable_t & collectable);
+
+  /*!
+   \brief Collect unused objects
+   \param budget : time budget
+   \post slices of the enrolled data structures have been collected, resuming
+   where the previous call stopped, until budget has elapsed or a pass over all
+   the enrolled data structures has been completed
+   \return number of collected objects
+   \note at least one slice is collected, hence budget may be exceeded by the
+   time needed to collect one slice
+   */
+  std::size_t collect(std::chrono::microseconds budget);
+
+  /*!
+   \brief Accessor
+   \return number of objects collected by this collector
+   */
+  inline unsigned long collected() const { return _collected; }
+
+  /*!
+   \brief Accessor
+   \return number of passes over the enrolled data structures that have been
+   completed by this collector
+   */
+  inline unsigned long passes() const { return _passes; }
+
+private:
+  std::size_t const _slice_size;                                    /*!< Number of objects inspected in a slice */
+  std::vector<tchecker::incremental_collectable_t *> _collectables; /*!< Enrolled data structures */
+  std::size_t _current;                                             /*!< Index of the data structure being collected */
+  unsigned long _collected;                                         /*!< Number of collected objects */
+  unsigned long _passes;                                            /*!< Number of completed passes */
+};
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_INCREMENTAL_COLLECTOR_HH
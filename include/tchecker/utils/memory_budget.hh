@@ -0,0 +1,133 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_MEMORY_BUDGET_HH
+#define TCHECKER_MEMORY_BUDGET_HH
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <string>
+
+/*!
+ \file memory_budget.hh
+ \brief Memory budget with graceful degradation
+ */
+
+namespace tchecker {
+
+/*!
+ \class memory_budget_t
+ \brief Memory budget of an algorithm
+ \note The memory used by the algorithm is measured by a user-provided
+ function. When memory reaches a fraction of the budget (the degradation
+ threshold), a user-provided degradation function is called once to switch the
+ algorithm to a cheaper mode (e.g. stop storing edges). When memory exceeds
+ the budget, the budget is exceeded and the algorithm should stop
+ */
+class memory_budget_t {
+public:
+  /*!
+   \brief Constructor
+   \param max_memory : maximum memory (in bytes)
+   \param degradation_ratio : fraction of max_memory that triggers degradation
+   \pre max_memory > 0 and 0 < degradation_ratio <= 1
+   \throw std::invalid_argument : if the precondition is not satisfied
+   */
+  memory_budget_t(std::size_t max_memory, double degradation_ratio = 0.75);
+
+  /*!
+   \brief Copy constructor (deleted)
+   */
+  memory_budget_t(tchecker::memory_budget_t const &) = delete;
+
+  /*!
+   \brief Move constructor (deleted)
+   */
+  memory_budget_t(tchecker::memory_budget_t &&) = delete;
+
+  /*!
+   \brief Destructor
+   */
+  ~memory_budget_t() = default;
+
+  /*!
+   \brief Assignment operator (deleted)
+   */
+  tchecker::memory_budget_t & operator=(tchecker::memory_budget_t const &) = delete;
+
+  /*!
+   \brief Move-assignment operator (deleted)
+   */
+  tchecker::memory_budget_t & operator=(tchecker::memory_budget_t &&) = delete;
+
+  /*!
+   \brief Set memory measurement
+   \param memsize : function that returns the memory used (in bytes)
+   */
+  void memsize(std::function<std::size_t()> memsize);
+
+  /*!
+   \brief Set degradation
+   \param degrade : function that switches to a cheaper mode
+   */
+  void degrade(std::function<void()> degrade);
+
+  /*!
+   \brief Check memory against the budget
+   \post memory has been measured and peak memory has been updated. The
+   degradation function has been called (once for all) if memory has reached the
+   degradation threshold, and memory has then been measured again
+   \return true if the budget has never been exceeded, false otherwise
+   */
+  bool check();
+
+  /*!
+   \brief Accessor
+   \return maximum memory (in bytes)
+   */
+  inline std::size_t max_memory() const { return _max_memory; }
+
+  /*!
+   \brief Accessor
+   \return peak memory measured by check() (in bytes)
+   */
+  inline std::size_t peak_memory() const { return _peak_memory; }
+
+  /*!
+   \brief Accessor
+   \return true if degradation has been triggered, false otherwise
+   */
+  inline bool degraded() const { return _degraded; }
+
+  /*!
+   \brief Accessor
+   \return true if the budget has been exceeded, false otherwise
+   */
+  inline bool exceeded() const { return _exceeded; }
+
+  /*!
+   \brief Extract memory budget as attributes (key, value)
+   \param m : attributes map
+   \post max memory, peak memory, degradation and exceeding of the budget have
+   been added to map m
+   */
+  void attributes(std::map<std::string, std::string> & m) const;
+
+private:
+  std::size_t const _max_memory;            /*!< Maximum memory */
+  std::size_t const _degradation_threshold; /*!< Memory that triggers degradation */
+  std::function<std::size_t()> _memsize;    /*!< Memory measurement */
+  std::function<void()> _degrade;           /*!< Degradation */
+  std::size_t _peak_memory;                 /*!< Peak measured memory */
+  bool _degraded;                           /*!< Degradation flag */
+  bool _exceeded;                           /*!< Exceeded budget flag */
+};
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_MEMORY_BUDGET_HH
@@ -0,0 +1,97 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_MEMORY_STATS_HH
+#define TCHECKER_MEMORY_STATS_HH
+
+#include <array>
+#include <cstddef>
+#include <map>
+#include <string>
+
+/*!
+ \file memory_stats.hh
+ \brief Per-subsystem memory statistics
+ */
+
+namespace tchecker {
+
+/*!
+ \brief Memory subsystems
+ */
+enum memory_subsystem_t {
+  MEMORY_STATES,      /*!< States */
+  MEMORY_TRANSITIONS, /*!< Transitions */
+  MEMORY_VLOCS,       /*!< Tuples of locations */
+  MEMORY_VEDGES,      /*!< Tuples of edges */
+  MEMORY_INTVALS,     /*!< Valuations of bounded integer variables */
+  MEMORY_ZONES,       /*!< Zones */
+  MEMORY_NODES,       /*!< Nodes of graphs */
+  MEMORY_EDGES,       /*!< Edges of graphs */
+  MEMORY_HASHTABLE,   /*!< Hash tables of graphs and sharing caches */
+  MEMORY_SUBSYSTEMS_COUNT,
+};
+
+/*!
+ \class memory_stats_t
+ \brief Memory reserved and memory live in each subsystem
+ \note reserved memory is the memory allocated by the data structures of a
+ subsystem (e.g. blocks of pools, buckets and entries of hash tables). Live
+ memory is the part of reserved memory that is used by objects that have not
+ been released
+ */
+class memory_stats_t {
+public:
+  /*!
+   \brief Constructor
+   \post no memory in all subsystems
+   */
+  memory_stats_t();
+
+  /*!
+   \brief Add memory to a subsystem
+   \param subsystem : a memory subsystem
+   \param reserved : reserved memory (bytes)
+   \param live : live memory (bytes)
+   \pre subsystem < MEMORY_SUBSYSTEMS_COUNT (checked by assertion)
+   \post reserved and live have been added to the memory of subsystem
+   */
+  void add(enum tchecker::memory_subsystem_t subsystem, std::size_t reserved, std::size_t live);
+
+  /*!
+   \brief Accessor
+   \param subsystem : a memory subsystem
+   \pre subsystem < MEMORY_SUBSYSTEMS_COUNT (checked by assertion)
+   \return reserved memory of subsystem (bytes)
+   */
+  std::size_t reserved(enum tchecker::memory_subsystem_t subsystem) const;
+
+  /*!
+   \brief Accessor
+   \param subsystem : a memory subsystem
+   \pre subsystem < MEMORY_SUBSYSTEMS_COUNT (checked by assertion)
+   \return live memory of subsystem (bytes)
+   */
+  std::size_t live(enum tchecker::memory_subsystem_t subsystem) const;
+
+  /*!
+   \brief Extract memory statistics as attributes (key, value)
+   \param m : attributes map
+   \post reserved memory (key MEMORY_<SUBSYSTEM>) and live memory (key
+   MEMORY_<SUBSYSTEM>_LIVE) of each subsystem, and in total, have been added to
+   map m
+   */
+  void attributes(std::map<std::string, std::string> & m) const;
+
+private:
+  std::array<std::size_t, tchecker::MEMORY_SUBSYSTEMS_COUNT> _reserved; /*!< Reserved memory of subsystems */
+  std::array<std::size_t, tchecker::MEMORY_SUBSYSTEMS_COUNT> _live;     /*!< Live memory of subsystems */
+};
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_MEMORY_STATS_HH
@@ -8,9 +8,20 @@
 #ifndef TCHECKER_POOL_HH
 #define TCHECKER_POOL_HH
 
+#include <atomic>
+#include <cstdint>
+#include <iterator>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <unordered_map>
 #include <vector>
 
+#include "tchecker/utils/segments.hh"
 #include "tchecker/utils/shared_objects.hh"
 
 /*!
@@ -38,23 +49,56 @@ public:
   virtual std::size_t collect() = 0;
 };
 
+/*!
+ \class incremental_collectable_t
+ \brief Data structure with incremental object collection
+ */
+class incremental_collectable_t {
+public:
+  /*!
+  \brief Destructor
+  */
+  virtual ~incremental_collectable_t() = default;
+
+  /*!
+  \brief Collect objects in a slice of the data structure
+  \param size : number of objects to inspect
+  \return number of collected objects, and true if the slice reached the end of
+  the data structure, false otherwise
+  \note each slice resumes where the previous one stopped. The next slice
+  restarts from the beginning once the end has been reached
+  */
+  virtual std::tuple<std::size_t, bool> collect_slice(std::size_t size) = 0;
+};
+
+namespace details {
+
+template <class T> class thread_pools_t;
+
+} // end of namespace details
+
 /*!
  \class pool_t
  \brief Pool allocator with memory collection
  \tparam T : type of allocated objects. Should derive from
- tchecker::make_shared_t<Y> for some Y
+ tchecker::make_shared_t<Y, REFCOUNT, RESERVED, POLICY> for some Y, and
+ RESERVED >= 1
  \note Pools allocate blocks of memory. Each block contains a fix number of
  chunks. A chunk stores an object of type T. All chunks have the same fixed
  size alloc_size. A block contains a fixed alloc_nb chunks. The size of a
  block is alloc_nb * alloc_size + sizeof(void *). The extra size for a pointer
  is used to maintain a simple linked list of blocks.
- \note The pool is *NOT* thread-safe
+ \note The pool is *NOT* thread-safe, unless it is in concurrent mode (see
+ tchecker::pool_t::concurrent)
  */
-template <class T> class pool_t {
+template <class T> class pool_t : public tchecker::incremental_collectable_t {
 public:
-  static_assert(std::is_same<T, tchecker::make_shared_t<typename T::object_t>>::value,
+  static_assert(std::is_same<T, tchecker::make_shared_t<typename T::object_t, typename T::refcount_t, T::REFCOUNT_RESERVED,
+                                                        typename T::refcount_policy_t>>::value,
                 "T should have type tchecker::make_shared_t<...>");
 
+  static_assert(T::REFCOUNT_RESERVED >= 1, "T should reserve a value of the reference counter for FREE_CHUNK");
+
   /*!
    \brief Size of the reference counter
    */
@@ -104,7 +148,8 @@ public:
   pool_t(std::size_t alloc_nb, std::size_t alloc_size)
       : _alloc_nb(alloc_nb), _alloc_size(std::max(alloc_size, MIN_ALLOC_SIZE)),
         _block_size(_alloc_nb * _alloc_size + sizeof(void *)), _blocks_count(0), _free_head(nullptr), _block_head(nullptr),
-        _raw_head(nullptr), _raw_end(nullptr)
+        _raw_head(nullptr), _raw_end(nullptr), _collect_cursor(nullptr), _segments(nullptr),
+        _huge_pages(tchecker::HUGE_PAGES_NONE), _threads(nullptr)
   {
     if (_alloc_nb < 1)
       throw std::invalid_argument("allocation number should be >= 1");
@@ -125,7 +170,7 @@ public:
    \post All the objects allocated by the pool have been destructed
    \note see tchecker::pool_t::destruct_all
    */
-  ~pool_t()
+  virtual ~pool_t()
   {
     _collectables.clear();
     destruct_all();
@@ -148,6 +193,9 @@ public:
    */
   template <class... ARGS> tchecker::intrusive_shared_ptr_t<T> construct(ARGS &&... args)
   {
+    if (_threads != nullptr)
+      return _threads->construct(std::forward<ARGS>(args)...);
+
     void * t = allocate();
     if (t == nullptr)
       return tchecker::intrusive_shared_ptr_t<T>(nullptr);
@@ -183,13 +231,12 @@ public:
       return false;
 
     T * t = p.ptr();
+    p = nullptr; // release the reference before the chunk is freed (and maybe reused by another thread)
     T::destruct(t);
 
     typename T::refcount_t * chunk = reinterpret_cast<typename T::refcount_t *>(t) - 1;
     release(chunk);
 
-    p = nullptr;
-
     return true;
   }
 
@@ -199,45 +246,62 @@ public:
    collected in the list of free objects, and their counters have been set to
    FREE_CHUNK
    \return Number of collected chunks
+   \note in concurrent mode, only the chunks in the blocks of the calling thread
+   are collected
    */
   std::size_t collect()
   {
+    if (_threads != nullptr)
+      return _threads->collect();
+
     std::size_t collected = 0;
     void *collected_begin = nullptr, *collected_end = nullptr;
 
     // Move to the free list all chunks in blocks list that are not in the
     // free list and that are unused
-    for (void * block = _block_head; block != nullptr; block = nextblock(block)) {
-      void * block_end = static_cast<char *>(block) + _block_size;
+    for (void * block = _block_head; block != nullptr; block = nextblock(block))
+      collected += collect_block(block, collected_begin, collected_end);
 
-      for (char * chunk = first_chunk_ptr(block); chunk != block_end; chunk += _alloc_size) {
-        // Ignore chunks inside unused raw block (refcount not set yet)
-        if ((_raw_head <= chunk) && (chunk < _raw_end))
-          break; // ignore the entire raw block
+    // release the collected chunks
+    if (collected > 0)
+      this->release(collected_begin, collected_end);
 
-        // Collect all unused chunks in the free list
-        typename T::refcount_t * refcount = reinterpret_cast<typename T::refcount_t *>(chunk);
-        if (*refcount == COLLECTABLE_CHUNK) {
-          // make the chunk free using its refcount
-          *refcount = FREE_CHUNK;
-          // destruct the object in the chunk
-          T * t = reinterpret_cast<T *>(refcount + 1);
-          T::destruct(t); // t->~T()
-          // add the chunk to the list of collected chunks
-          this->nextchunk(chunk) = collected_begin;
-          if (collected_end == nullptr)
-            collected_end = chunk;
-          collected_begin = chunk;
-          ++collected;
-        }
-      }
+    return collected;
+  }
+
+  /*!
+   \brief Collects unused chunks in a slice of blocks
+   \param size : number of chunks to inspect
+   \post All objects with reference counter = 0 (COLLECTABLE_CHUNK) in the next
+   blocks, up to size chunks, have been collected in the list of free objects
+   (see tchecker::pool_t::collect)
+   \return Number of collected chunks, and true if the last block has been
+   reached, false otherwise
+   \note blocks are visited from the most recently allocated one. Blocks
+   allocated during a pass are visited in the next pass
+   \note in concurrent mode, only the blocks of the calling thread are visited
+   */
+  virtual std::tuple<std::size_t, bool> collect_slice(std::size_t size)
+  {
+    if (_threads != nullptr)
+      return _threads->collect_slice(size);
+
+    if (_collect_cursor == nullptr)
+      _collect_cursor = _block_head;
+
+    std::size_t collected = 0, inspected = 0;
+    void *collected_begin = nullptr, *collected_end = nullptr;
+
+    while ((_collect_cursor != nullptr) && (inspected < size)) {
+      collected += collect_block(_collect_cursor, collected_begin, collected_end);
+      inspected += _alloc_nb;
+      _collect_cursor = static_cast<char *>(nextblock(_collect_cursor));
     }
 
-    // release the collected chunks
     if (collected > 0)
       this->release(collected_begin, collected_end);
 
-    return collected;
+    return std::make_tuple(collected, _collect_cursor == nullptr);
   }
 
   /*!
@@ -247,6 +311,11 @@ public:
    */
   void destruct_all()
   {
+    if (_threads != nullptr) {
+      _threads->destruct_all();
+      return;
+    }
+
     // Call destructor on all chunks in blocks list that
     // - are not in free list
     // - are not in raw block
@@ -287,17 +356,27 @@ public:
    */
   void free_all()
   {
-    void *p = _block_head, *tmp = nullptr;
-    while (p != nullptr) {
-      tmp = p;
-      p = nextblock(p);
-      delete[] static_cast<char *>(tmp);
+    if (_threads != nullptr) {
+      _threads->free_all();
+      return;
+    }
+
+    if (_segments != nullptr)
+      _segments->clear();
+    else {
+      void *p = _block_head, *tmp = nullptr;
+      while (p != nullptr) {
+        tmp = p;
+        p = nextblock(p);
+        delete[] static_cast<char *>(tmp);
+      }
     }
     _blocks_count = 0;
     _free_head = nullptr; // _free_head_lock access protection useless
     _block_head = nullptr;
     _raw_head = nullptr;
     _raw_end = nullptr;
+    _collect_cursor = nullptr;
   }
 
   /*!
@@ -305,7 +384,37 @@ public:
    \return Memory footprint of the pool
    \note Constant time
    */
-  inline constexpr std::size_t memsize() const { return (_blocks_count * _block_size); }
+  inline std::size_t memsize() const { return (blocks_count() * _block_size); }
+
+  /*!
+   \brief Accessor
+   \return Memory used by the chunks that have been allocated and that have not
+   been collected or released yet
+   \note Linear in the number of allocated chunks. Chunks that are not
+   referenced anymore but that have not been collected yet are counted
+   \note should not be called while objects are allocated or released
+   concurrently
+   */
+  std::size_t livesize() const
+  {
+    if (_threads != nullptr)
+      return _threads->livesize();
+
+    std::size_t live = 0;
+    for (void * block = _block_head; block != nullptr; block = nextblock(block)) {
+      void * block_end = static_cast<char *>(block) + _block_size;
+
+      for (char * chunk = first_chunk_ptr(block); chunk != block_end; chunk += _alloc_size) {
+        // Ignore chunks inside unused raw block
+        if ((_raw_head <= chunk) && (chunk < _raw_end))
+          break;
+
+        if (*reinterpret_cast<typename T::refcount_t const *>(chunk) <= T::REFCOUNT_MAX)
+          ++live;
+      }
+    }
+    return live * _alloc_size;
+  }
 
   /*!
    \brief Register a collectable
@@ -317,6 +426,111 @@ public:
    */
   void enroll(std::shared_ptr<collectable_t> const & collectable) { _collectables.push_back(collectable); }
 
+  /*!
+   \brief Spill memory to disk
+   \param directory : directory of segment files
+   \pre this pool has not allocated any block yet, it is not in concurrent mode,
+   and it does not use huge pages
+   \post this pool allocates its blocks from memory-mapped segment files in
+   directory (see tchecker::mmap_segments_t). The operating system keeps the
+   recently accessed blocks in memory, and evicts the other ones to the segment
+   files when memory runs low
+   \throw std::logic_error : if the precondition is not satisfied
+   \throw std::invalid_argument : if directory is not a directory
+   */
+  void spill(std::string const & directory)
+  {
+    if (_blocks_count != 0)
+      throw std::logic_error("cannot spill a pool that has allocated memory");
+    if (_threads != nullptr)
+      throw std::logic_error("cannot spill a concurrent pool");
+    if (_huge_pages != tchecker::HUGE_PAGES_NONE)
+      throw std::logic_error("cannot spill a pool with huge pages");
+    _segments = std::make_unique<tchecker::mmap_segments_t>(directory);
+  }
+
+  /*!
+   \brief Accessor
+   \return true if this pool allocates its blocks from segment files, false
+   otherwise
+   */
+  inline bool spilled() const { return dynamic_cast<tchecker::mmap_segments_t const *>(_segments.get()) != nullptr; }
+
+  /*!
+   \brief Back blocks by huge pages
+   \param huge_pages : huge pages mode
+   \pre this pool has not allocated any block yet, it is not spilled, and it is
+   not in concurrent mode
+   \post this pool allocates its blocks from anonymous segments backed by huge
+   pages according to huge_pages (see tchecker::anonymous_segments_t), or from
+   the heap if huge_pages is tchecker::HUGE_PAGES_NONE. Segments are aligned on
+   huge pages, and blocks are allocated contiguously in segments
+   \note huge pages are kept if this pool is switched to concurrent mode
+   \throw std::logic_error : if the precondition is not satisfied
+   */
+  void huge_pages(enum tchecker::huge_pages_t huge_pages)
+  {
+    if (_blocks_count != 0)
+      throw std::logic_error("cannot use huge pages in a pool that has allocated memory");
+    if (spilled())
+      throw std::logic_error("cannot use huge pages in a spilled pool");
+    if (_threads != nullptr)
+      throw std::logic_error("cannot use huge pages in a concurrent pool");
+    _huge_pages = huge_pages;
+    if (_huge_pages == tchecker::HUGE_PAGES_NONE)
+      _segments = nullptr;
+    else
+      _segments = std::make_unique<tchecker::anonymous_segments_t>(tchecker::segments_t::DEFAULT_SEGMENT_SIZE, -1, _huge_pages);
+  }
+
+  /*!
+   \brief Accessor
+   \return huge pages mode of this pool
+   */
+  inline enum tchecker::huge_pages_t huge_pages() const { return _huge_pages; }
+
+  /*!
+   \brief Switch to concurrent mode
+   \param numa_local : whether blocks are bound to the NUMA node of the thread
+   that allocates them
+   \pre this pool has not allocated any block yet, and it is not spilled
+   \post this pool can be used concurrently by several threads. Each thread
+   constructs objects in its own blocks, with its own free list, without
+   synchronization. Objects destructed by the thread that constructed them are
+   released to its free list. Objects destructed by another thread are pushed
+   to a lock-free queue of the owner thread, which reclaims them when its free
+   list is empty. If numa_local is true, blocks are allocated from anonymous
+   segments bound to the NUMA node of the owner thread (see
+   tchecker::anonymous_segments_t). Otherwise, blocks are placed by the
+   first-touch policy of the system. Blocks are backed by huge pages if this
+   pool uses huge pages (see tchecker::pool_t::huge_pages)
+   \note collect() only collects the blocks of the calling thread, and the
+   registered collectables are not inspected: they are usually not thread-safe
+   \note destruct_all() and free_all() must not be called concurrently with any
+   other method
+   \note objects should not be shared among threads, except to be destructed
+   by another thread, unless T has atomic reference counters (see
+   tchecker::atomic_refcount_t)
+   \throw std::logic_error : if the precondition is not satisfied
+   */
+  void concurrent(bool numa_local = false)
+  {
+    if (_blocks_count != 0)
+      throw std::logic_error("cannot make concurrent a pool that has allocated memory");
+    if (spilled())
+      throw std::logic_error("cannot make concurrent a spilled pool");
+    if (_threads == nullptr) {
+      _threads = std::make_unique<tchecker::details::thread_pools_t<T>>(_alloc_nb, _alloc_size, numa_local, _huge_pages);
+      _segments = nullptr; // blocks are allocated by the per-thread pools
+    }
+  }
+
+  /*!
+   \brief Accessor
+   \return true if this pool is in concurrent mode, false otherwise
+   */
+  inline bool is_concurrent() const { return _threads != nullptr; }
+
   /*!
    \brief Accessor
    \return number of allocated objects per block
@@ -339,7 +553,7 @@ public:
    \brief Accessor
    \return number of allocated blocks
   */
-  inline std::size_t blocks_count() const { return _blocks_count; }
+  inline std::size_t blocks_count() const { return (_threads == nullptr ? _blocks_count : _threads->blocks_count()); }
 
 protected:
   /*!
@@ -410,6 +624,46 @@ protected:
     return chunk;
   }
 
+  /*!
+   \brief Collects unused chunks in a block
+   \param block : a block
+   \param collected_begin : first chunk in the list of collected chunks
+   \param collected_end : last chunk in the list of collected chunks
+   \post All objects with reference counter = 0 (COLLECTABLE_CHUNK) in block
+   have been destructed, their counters have been set to FREE_CHUNK, and they
+   have been added in front of the list collected_begin..collected_end
+   \return Number of collected chunks
+   */
+  std::size_t collect_block(void * block, void *& collected_begin, void *& collected_end)
+  {
+    std::size_t collected = 0;
+    void * block_end = static_cast<char *>(block) + _block_size;
+
+    for (char * chunk = first_chunk_ptr(block); chunk != block_end; chunk += _alloc_size) {
+      // Ignore chunks inside unused raw block (refcount not set yet)
+      if ((_raw_head <= chunk) && (chunk < _raw_end))
+        break; // ignore the entire raw block
+
+      // Collect all unused chunks in the free list, making them free using
+      // their refcount. With atomic reference counters, this fails if a
+      // reference has been taken on the chunk concurrently
+      typename T::refcount_t * refcount = reinterpret_cast<typename T::refcount_t *>(chunk);
+      if (T::refcount_policy_t::compare_and_set(refcount, COLLECTABLE_CHUNK, FREE_CHUNK)) {
+        // destruct the object in the chunk
+        T * t = reinterpret_cast<T *>(refcount + 1);
+        T::destruct(t); // t->~T()
+        // add the chunk to the list of collected chunks
+        this->nextchunk(chunk) = collected_begin;
+        if (collected_end == nullptr)
+          collected_end = chunk;
+        collected_begin = chunk;
+        ++collected;
+      }
+    }
+
+    return collected;
+  }
+
   /*!
    \brief Allocate a new block
    \pre The raw block is empty, i.e. _raw_head == _raw_end (checked by
@@ -420,7 +674,7 @@ protected:
   {
     assert(_raw_head == _raw_end);
     // allocate
-    _raw_head = new char[_block_size];
+    _raw_head = (_segments == nullptr ? new char[_block_size] : static_cast<char *>(_segments->allocate(_block_size)));
     _raw_end = _raw_head + _block_size;
     // link to allocated blocks
     nextblock(_raw_head) = _block_head;
@@ -466,6 +720,11 @@ protected:
    */
   void release(void const * chunk)
   {
+    if (_threads != nullptr) {
+      _threads->release(chunk);
+      return;
+    }
+
     typename T::refcount_t * refcount = static_cast<typename T::refcount_t *>(const_cast<void *>(chunk));
     *refcount = FREE_CHUNK;
     this->release(chunk, chunk);
@@ -497,9 +756,392 @@ protected:
   char * _block_head;                                                  /*!< head pointer to list of blocks */
   char * _raw_head;                                                    /*!< pointer to raw block */
   char * _raw_end;                                                     /*!< pointer to past-the-end raw block */
+  char * _collect_cursor;                                              /*!< next block to collect (see collect_slice) */
   std::vector<std::shared_ptr<tchecker::collectable_t>> _collectables; /*!< collectable data structures for memory collection */
+  std::unique_ptr<tchecker::segments_t> _segments;                     /*!< segments (nullptr if blocks are on the heap) */
+  enum tchecker::huge_pages_t _huge_pages;                             /*!< huge pages mode */
+  std::unique_ptr<tchecker::details::thread_pools_t<T>> _threads;      /*!< per-thread pools (nullptr if not concurrent) */
+};
+
+namespace details {
+
+/*!
+ \class local_pool_t
+ \brief Pool owned by a thread, with a lock-free queue of chunks released by
+ other threads
+ \tparam T : type of allocated objects
+ */
+template <class T> class local_pool_t final : public tchecker::pool_t<T> {
+public:
+  /*!
+   \brief Constructor
+   \param alloc_nb : number of chunks in a block
+   \param alloc_size : size of chunks
+   \param numa_node : NUMA node of blocks (-1 for no binding)
+   \param huge_pages : huge pages mode
+   \post empty pool (see tchecker::pool_t). If numa_node >= 0 or if huge pages
+   are used, blocks are allocated from anonymous segments bound to numa_node
+   and backed by huge pages according to huge_pages. Otherwise, blocks are
+   allocated on the heap
+   */
+  local_pool_t(std::size_t alloc_nb, std::size_t alloc_size, int numa_node, enum tchecker::huge_pages_t huge_pages)
+      : tchecker::pool_t<T>(alloc_nb, alloc_size), _remote_head(nullptr)
+  {
+    this->_huge_pages = huge_pages;
+    if (numa_node >= 0 || huge_pages != tchecker::HUGE_PAGES_NONE)
+      this->_segments = std::make_unique<tchecker::anonymous_segments_t>(tchecker::segments_t::DEFAULT_SEGMENT_SIZE,
+                                                                         numa_node, huge_pages);
+  }
+
+  /*!
+   \brief Construct an object
+   \param args : parameters to a constructor of type T
+   \return A new instance of T built with args and allocated by the pool
+   \note chunks released by other threads are reclaimed first if there is no
+   free chunk left
+   \pre must be called by the owner thread
+   */
+  template <class... ARGS> tchecker::intrusive_shared_ptr_t<T> construct(ARGS &&... args)
+  {
+    if (this->_free_head == nullptr && this->_raw_head == this->_raw_end)
+      reclaim();
+    return tchecker::pool_t<T>::construct(std::forward<ARGS>(args)...);
+  }
+
+  /*!
+   \brief Collects unused chunks
+   \post Chunks released by other threads have been reclaimed, and unused
+   chunks have been collected (see tchecker::pool_t::collect)
+   \return Number of collected chunks
+   \pre must be called by the owner thread
+   */
+  std::size_t collect()
+  {
+    reclaim();
+    return tchecker::pool_t<T>::collect();
+  }
+
+  /*!
+   \brief Collects unused chunks in a slice of blocks
+   \param size : number of chunks to inspect
+   \post Chunks released by other threads have been reclaimed, and unused
+   chunks in a slice of blocks have been collected (see
+   tchecker::pool_t::collect_slice)
+   \return Number of collected chunks, and true if the last block has been
+   reached, false otherwise
+   \pre must be called by the owner thread
+   */
+  virtual std::tuple<std::size_t, bool> collect_slice(std::size_t size)
+  {
+    reclaim();
+    return tchecker::pool_t<T>::collect_slice(size);
+  }
+
+  /*!
+   \brief Destruct all the objects allocated by the pool
+   \post see tchecker::pool_t::destruct_all
+   */
+  void destruct_all()
+  {
+    tchecker::pool_t<T>::destruct_all();
+    _remote_head.store(nullptr, std::memory_order_relaxed);
+  }
+
+  /*!
+   \brief Free all allocated memory
+   \post see tchecker::pool_t::free_all
+   */
+  void free_all()
+  {
+    tchecker::pool_t<T>::free_all();
+    _remote_head.store(nullptr, std::memory_order_relaxed);
+  }
+
+  /*!
+   \brief Release a chunk from the owner thread
+   \param chunk : pointer to chunk
+   \pre chunk has been allocated by this pool. Must be called by the owner
+   thread
+   \post chunk is in the free list
+   */
+  inline void release_local(void const * chunk) { tchecker::pool_t<T>::release(chunk); }
+
+  /*!
+   \brief Release a chunk from another thread
+   \param chunk : pointer to chunk
+   \pre chunk has been allocated by this pool
+   \post chunk has been pushed to the queue of remotely released chunks
+   \note lock-free
+   */
+  void release_remote(void const * chunk)
+  {
+    char * c = static_cast<char *>(const_cast<void *>(chunk));
+    *reinterpret_cast<typename T::refcount_t *>(c) = tchecker::pool_t<T>::FREE_CHUNK;
+    char * head = _remote_head.load(std::memory_order_relaxed);
+    do {
+      tchecker::pool_t<T>::nextchunk(c) = head;
+    } while (!_remote_head.compare_exchange_weak(head, c, std::memory_order_release, std::memory_order_relaxed));
+  }
+
+  /*!
+   \brief Accessor
+   \return last allocated block, nullptr if none
+   */
+  inline char * last_block() const { return this->_block_head; }
+
+private:
+  /*!
+   \brief Reclaim chunks released by other threads
+   \post all the chunks in the queue of remotely released chunks have been
+   moved to the free list
+   */
+  void reclaim()
+  {
+    char * head = _remote_head.exchange(nullptr, std::memory_order_acquire);
+    if (head == nullptr)
+      return;
+    void * tail = head;
+    while (tchecker::pool_t<T>::nextchunk(tail) != nullptr)
+      tail = tchecker::pool_t<T>::nextchunk(tail);
+    tchecker::pool_t<T>::release(head, tail);
+  }
+
+  std::atomic<char *> _remote_head; /*!< Queue of chunks released by other threads */
+};
+
+/*!
+ \brief Identifier of a set of thread pools
+ \return a new identifier
+ */
+inline std::uint64_t new_thread_pools_id()
+{
+  static std::atomic<std::uint64_t> next_id{0};
+  return next_id.fetch_add(1, std::memory_order_relaxed);
+}
+
+/*!
+ \class thread_pools_t
+ \brief Per-thread pools of a pool in concurrent mode
+ \tparam T : type of allocated objects
+ \note each thread that constructs objects gets its own pool, found from a
+ thread-local cache without synchronization. Blocks are registered with their
+ owner pool in order to release chunks from any thread
+ */
+template <class T> class thread_pools_t {
+public:
+  /*!
+   \brief Constructor
+   \param alloc_nb : number of chunks in a block
+   \param alloc_size : size of chunks
+   \param numa_local : whether blocks are bound to the NUMA node of their thread
+   \param huge_pages : huge pages mode of blocks
+   */
+  thread_pools_t(std::size_t alloc_nb, std::size_t alloc_size, bool numa_local, enum tchecker::huge_pages_t huge_pages)
+      : _id(tchecker::details::new_thread_pools_id()), _alloc_nb(alloc_nb), _alloc_size(alloc_size),
+        _numa_local(numa_local), _huge_pages(huge_pages), _blocks_count(0)
+  {
+  }
+
+  /*!
+   \brief Copy constructor (deleted)
+   */
+  thread_pools_t(tchecker::details::thread_pools_t<T> const &) = delete;
+
+  /*!
+   \brief Move constructor (deleted)
+   */
+  thread_pools_t(tchecker::details::thread_pools_t<T> &&) = delete;
+
+  /*!
+   \brief Destructor
+   */
+  ~thread_pools_t() = default;
+
+  /*!
+   \brief Assignment operator (deleted)
+   */
+  tchecker::details::thread_pools_t<T> & operator=(tchecker::details::thread_pools_t<T> const &) = delete;
+
+  /*!
+   \brief Move-assignment operator (deleted)
+   */
+  tchecker::details::thread_pools_t<T> & operator=(tchecker::details::thread_pools_t<T> &&) = delete;
+
+  /*!
+   \brief Construct an object in the pool of the calling thread
+   \param args : parameters to a constructor of type T
+   \return A new instance of T built with args
+   */
+  template <class... ARGS> tchecker::intrusive_shared_ptr_t<T> construct(ARGS &&... args)
+  {
+    tchecker::details::local_pool_t<T> & pool = local();
+    std::size_t const blocks_count = pool.blocks_count();
+    tchecker::intrusive_shared_ptr_t<T> p = pool.construct(std::forward<ARGS>(args)...);
+    if (pool.blocks_count() != blocks_count) {
+      std::unique_lock lock(_mutex);
+      _owners.emplace(pool.last_block(), &pool);
+      _blocks_count.fetch_add(1, std::memory_order_relaxed);
+    }
+    return p;
+  }
+
+  /*!
+   \brief Release a chunk
+   \param chunk : pointer to chunk
+   \pre chunk has been allocated by one of the pools
+   \post chunk has been released to the free list of its pool if the calling
+   thread owns it, and to the queue of remotely released chunks otherwise
+   */
+  void release(void const * chunk)
+  {
+    tchecker::details::local_pool_t<T> * pool = owner(chunk);
+    if (pool == lookup())
+      pool->release_local(chunk);
+    else
+      pool->release_remote(chunk);
+  }
+
+  /*!
+   \brief Collect unused chunks in the pool of the calling thread
+   \return number of collected chunks
+   */
+  std::size_t collect()
+  {
+    tchecker::details::local_pool_t<T> * pool = lookup();
+    return (pool == nullptr ? 0 : pool->collect());
+  }
+
+  /*!
+   \brief Collect unused chunks in a slice of the blocks of the calling thread
+   \param size : number of chunks to inspect
+   \return number of collected chunks, and true if the last block has been
+   reached, false otherwise
+   */
+  std::tuple<std::size_t, bool> collect_slice(std::size_t size)
+  {
+    tchecker::details::local_pool_t<T> * pool = lookup();
+    if (pool == nullptr)
+      return std::make_tuple(std::size_t{0}, true);
+    return pool->collect_slice(size);
+  }
+
+  /*!
+   \brief Destruct all the objects in all the pools
+   \post see tchecker::pool_t::destruct_all
+   */
+  void destruct_all()
+  {
+    std::unique_lock lock(_mutex);
+    for (std::unique_ptr<tchecker::details::local_pool_t<T>> & pool : _pools)
+      pool->destruct_all();
+    _owners.clear();
+    _blocks_count.store(0, std::memory_order_relaxed);
+  }
+
+  /*!
+   \brief Free all the memory in all the pools
+   \post see tchecker::pool_t::free_all
+   */
+  void free_all()
+  {
+    std::unique_lock lock(_mutex);
+    for (std::unique_ptr<tchecker::details::local_pool_t<T>> & pool : _pools)
+      pool->free_all();
+    _owners.clear();
+    _blocks_count.store(0, std::memory_order_relaxed);
+  }
+
+  /*!
+   \brief Accessor
+   \return number of blocks in all the pools
+   */
+  inline std::size_t blocks_count() const { return _blocks_count.load(std::memory_order_relaxed); }
+
+  /*!
+   \brief Accessor
+   \return Memory used by the live chunks in all the pools (see
+   tchecker::pool_t::livesize)
+   */
+  std::size_t livesize() const
+  {
+    std::shared_lock lock(_mutex);
+    std::size_t live = 0;
+    for (std::unique_ptr<tchecker::details::local_pool_t<T>> const & pool : _pools)
+      live += pool->livesize();
+    return live;
+  }
+
+private:
+  /*!
+   \brief Cache of pools of the calling thread
+   \return map from identifiers of thread pools to the pool of the calling
+   thread
+   \note identifiers are never reused, hence entries of destroyed thread pools
+   are never accessed
+   */
+  static std::unordered_map<std::uint64_t, tchecker::details::local_pool_t<T> *> & thread_cache()
+  {
+    static thread_local std::unordered_map<std::uint64_t, tchecker::details::local_pool_t<T> *> cache;
+    return cache;
+  }
+
+  /*!
+   \brief Accessor
+   \return pool of the calling thread, nullptr if none
+   */
+  tchecker::details::local_pool_t<T> * lookup() const
+  {
+    auto & cache = thread_cache();
+    auto it = cache.find(_id);
+    return (it == cache.end() ? nullptr : it->second);
+  }
+
+  /*!
+   \brief Accessor
+   \return pool of the calling thread
+   \post a pool has been created for the calling thread if it had none
+   */
+  tchecker::details::local_pool_t<T> & local()
+  {
+    tchecker::details::local_pool_t<T> * pool = lookup();
+    if (pool != nullptr)
+      return *pool;
+
+    int const numa_node = (_numa_local ? tchecker::current_numa_node() : -1);
+    std::unique_lock lock(_mutex);
+    _pools.push_back(std::make_unique<tchecker::details::local_pool_t<T>>(_alloc_nb, _alloc_size, numa_node, _huge_pages));
+    pool = _pools.back().get();
+    thread_cache().emplace(_id, pool);
+    return *pool;
+  }
+
+  /*!
+   \brief Accessor
+   \param chunk : pointer to a chunk
+   \pre chunk has been allocated by one of the pools
+   \return pool that owns chunk
+   */
+  tchecker::details::local_pool_t<T> * owner(void const * chunk) const
+  {
+    std::shared_lock lock(_mutex);
+    auto it = _owners.upper_bound(static_cast<char *>(const_cast<void *>(chunk)));
+    assert(it != _owners.begin());
+    return std::prev(it)->second;
+  }
+
+  std::uint64_t const _id;                                                 /*!< Identifier */
+  std::size_t const _alloc_nb;                                             /*!< Number of chunks per block */
+  std::size_t const _alloc_size;                                           /*!< Size of chunks */
+  bool const _numa_local;                                                  /*!< Whether blocks are NUMA-local */
+  enum tchecker::huge_pages_t const _huge_pages;                           /*!< Huge pages mode of blocks */
+  std::atomic<std::size_t> _blocks_count;                                  /*!< Number of blocks in all pools */
+  mutable std::shared_mutex _mutex;                                        /*!< Lock on pools and owners */
+  std::vector<std::unique_ptr<tchecker::details::local_pool_t<T>>> _pools; /*!< Pools, one per thread */
+  std::map<char *, tchecker::details::local_pool_t<T> *> _owners;          /*!< Map : block -> owner pool */
 };
 
+} // end of namespace details
+
 } // end of namespace tchecker
 
 #endif // TCHECKER_POOL_HH
@@ -0,0 +1,217 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_PROGRESS_HH
+#define TCHECKER_PROGRESS_HH
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <ostream>
+#include <thread>
+
+/*!
+ \file progress.hh
+ \brief Live progress reporting of algorithms
+ */
+
+namespace tchecker {
+
+/*!
+ \brief Number of iterations of an algorithm between two publications of
+ progress (see tchecker::progress_t)
+ */
+static constexpr unsigned long PROGRESS_PERIOD = 1024;
+
+/*!
+ \class progress_t
+ \brief Progress counters of a running algorithm
+ \note Counters are published by the thread that runs the algorithm, and read
+ by a reporting thread. Relaxed atomics are used: the counters of a snapshot
+ may be slightly out of sync, which is fine for progress reporting
+ */
+class progress_t {
+public:
+  /*!
+   \brief Constructor
+   \post all counters are 0
+   */
+  progress_t();
+
+  /*!
+   \brief Copy constructor (deleted)
+   */
+  progress_t(tchecker::progress_t const &) = delete;
+
+  /*!
+   \brief Move constructor (deleted)
+   */
+  progress_t(tchecker::progress_t &&) = delete;
+
+  /*!
+   \brief Destructor
+   */
+  ~progress_t() = default;
+
+  /*!
+   \brief Assignment operator (deleted)
+   */
+  tchecker::progress_t & operator=(tchecker::progress_t const &) = delete;
+
+  /*!
+   \brief Move-assignment operator (deleted)
+   */
+  tchecker::progress_t & operator=(tchecker::progress_t &&) = delete;
+
+  /*!
+   \brief Publish counters
+   \param visited : number of visited states
+   \param stored : number of stored states
+   \param waiting : number of waiting states
+   \param covered : number of covered states
+   \post counters have been set to the given values
+   */
+  void publish(unsigned long visited, unsigned long stored, unsigned long waiting, unsigned long covered);
+
+  /*!
+   \brief Accessor
+   \return number of visited states
+   */
+  inline unsigned long visited() const { return _visited.load(std::memory_order_relaxed); }
+
+  /*!
+   \brief Accessor
+   \return number of stored states
+   */
+  inline unsigned long stored() const { return _stored.load(std::memory_order_relaxed); }
+
+  /*!
+   \brief Accessor
+   \return number of waiting states
+   */
+  inline unsigned long waiting() const { return _waiting.load(std::memory_order_relaxed); }
+
+  /*!
+   \brief Accessor
+   \return number of covered states
+   */
+  inline unsigned long covered() const { return _covered.load(std::memory_order_relaxed); }
+
+private:
+  std::atomic<unsigned long> _visited; /*!< Number of visited states */
+  std::atomic<unsigned long> _stored;  /*!< Number of stored states */
+  std::atomic<unsigned long> _waiting; /*!< Number of waiting states */
+  std::atomic<unsigned long> _covered; /*!< Number of covered states */
+};
+
+/*!
+ \brief Format of progress reports
+ */
+enum progress_format_t {
+  PROGRESS_TEXT,       /*!< One human-readable line per report */
+  PROGRESS_JSON_LINES, /*!< One JSON object per line */
+};
+
+/*!
+ \class progress_reporter_t
+ \brief Thread that reports the progress of an algorithm at fixed intervals
+ \note The algorithm publishes its progress to the counters of the reporter
+ (see progress()). Each report contains the elapsed time, the numbers of visited, stored
+ and waiting states, the number of visited states per second since the
+ previous report, the ratio of covered states among covered and stored
+ states, and the resident set size of the process
+ */
+class progress_reporter_t {
+public:
+  /*!
+   \brief Constructor
+   \param os : output stream
+   \param format : format of reports
+   \param interval : time interval between two reports
+   \pre interval > 0
+   \post a thread reports progress to os every interval, until this reporter is
+   stopped
+   \note os should outlive this reporter
+   \throw std::invalid_argument : if interval is 0
+   */
+  progress_reporter_t(std::ostream & os, enum tchecker::progress_format_t format, std::chrono::milliseconds interval);
+
+  /*!
+   \brief Copy constructor (deleted)
+   */
+  progress_reporter_t(tchecker::progress_reporter_t const &) = delete;
+
+  /*!
+   \brief Move constructor (deleted)
+   */
+  progress_reporter_t(tchecker::progress_reporter_t &&) = delete;
+
+  /*!
+   \brief Destructor
+   \post this reporter has been stopped
+   */
+  ~progress_reporter_t();
+
+  /*!
+   \brief Assignment operator (deleted)
+   */
+  tchecker::progress_reporter_t & operator=(tchecker::progress_reporter_t const &) = delete;
+
+  /*!
+   \brief Move-assignment operator (deleted)
+   */
+  tchecker::progress_reporter_t & operator=(tchecker::progress_reporter_t &&) = delete;
+
+  /*!
+   \brief Stop reporting
+   \post a last report has been output, and the reporting thread has been
+   joined. Does nothing if this reporter has already been stopped
+   */
+  void stop();
+
+  /*!
+   \brief Accessor
+   \return progress counters reported by this reporter
+   */
+  inline tchecker::progress_t & progress() { return _progress; }
+
+private:
+  /*!
+   \brief Reporting loop
+   */
+  void run();
+
+  /*!
+   \brief Output a report
+   \post a report of the current progress has been output to _os
+   */
+  void report();
+
+  tchecker::progress_t _progress;                     /*!< Progress counters */
+  std::ostream & _os;                                 /*!< Output stream */
+  enum tchecker::progress_format_t const _format;     /*!< Format of reports */
+  std::chrono::milliseconds const _interval;          /*!< Interval between two reports */
+  std::chrono::steady_clock::time_point const _start; /*!< Start time */
+  std::chrono::steady_clock::time_point _last_time;   /*!< Time of last report */
+  unsigned long _last_visited;                        /*!< Visited states at last report */
+  std::mutex _mutex;                                  /*!< Lock on _stopped */
+  std::condition_variable _cv;                        /*!< Stop notification */
+  bool _stopped;                                      /*!< Stop flag */
+  std::thread _thread;                                /*!< Reporting thread */
+};
+
+/*!
+ \brief Resident set size of the process
+ \return resident set size of the process in bytes, 0 if unknown
+ */
+std::size_t resident_set_size();
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_PROGRESS_HH
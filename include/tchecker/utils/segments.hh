@@ -0,0 +1,404 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_SEGMENTS_HH
+#define TCHECKER_SEGMENTS_HH
+
+#include <cstddef>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/*!
+ \file segments.hh
+ \brief Append-only memory-mapped segments
+ */
+
+namespace tchecker {
+
+/*!
+ \brief Size of huge pages (bytes)
+ */
+static constexpr std::size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+/*!
+ \brief Huge pages modes
+ */
+enum huge_pages_t {
+  HUGE_PAGES_NONE,        /*!< Regular pages */
+  HUGE_PAGES_TRANSPARENT, /*!< Transparent huge pages, promoted by the kernel (see madvise(MADV_HUGEPAGE)) */
+  HUGE_PAGES_EXPLICIT,    /*!< Explicit huge pages from the pool reserved by the system (see mmap(MAP_HUGETLB)) */
+};
+
+/*!
+ \class segments_t
+ \brief Append-only memory allocator backed by memory-mapped segments
+ \note Memory is allocated from segments, i.e. large memory mappings. The way
+ segments are mapped is defined by derived classes
+ \note Memory cannot be freed individually: all the segments are unmapped
+ together by clear()
+ \note This allocator is *NOT* thread-safe
+ */
+class segments_t {
+public:
+  /*!
+   \brief Default segment size (bytes)
+   */
+  static constexpr std::size_t DEFAULT_SEGMENT_SIZE = 64 * 1024 * 1024;
+
+  /*!
+   \brief Constructor
+   \param segment_size : size of segments
+   \param page_size : size of pages (0 for the size of system pages)
+   \post each segment has size at least segment_size (rounded to a multiple of
+   the page size)
+   */
+  segments_t(std::size_t segment_size = DEFAULT_SEGMENT_SIZE, std::size_t page_size = 0);
+
+  /*!
+   \brief Copy constructor (deleted)
+   */
+  segments_t(tchecker::segments_t const &) = delete;
+
+  /*!
+   \brief Move constructor (deleted)
+   */
+  segments_t(tchecker::segments_t &&) = delete;
+
+  /*!
+   \brief Destructor
+   \post all segments have been unmapped
+   */
+  virtual ~segments_t();
+
+  /*!
+   \brief Assignment operator (deleted)
+   */
+  tchecker::segments_t & operator=(tchecker::segments_t const &) = delete;
+
+  /*!
+   \brief Move-assignment operator (deleted)
+   */
+  tchecker::segments_t & operator=(tchecker::segments_t &&) = delete;
+
+  /*!
+   \brief Allocate memory
+   \param size : size of memory to allocate (bytes)
+   \return pointer to size bytes of zero-initialized memory, aligned for any
+   fundamental type
+   \post a new segment has been mapped if the current segment does not have
+   size bytes left
+   \throw std::runtime_error : if a new segment cannot be mapped
+   */
+  void * allocate(std::size_t size);
+
+  /*!
+   \brief Unmap all segments
+   \post all segments have been unmapped. All the memory returned by
+   allocate() has been invalidated
+   */
+  void clear();
+
+  /*!
+   \brief Accessor
+   \return number of segments
+   */
+  inline std::size_t segments_count() const { return _segments.size(); }
+
+  /*!
+   \brief Accessor
+   \return total size of segments (bytes)
+   */
+  std::size_t memsize() const;
+
+protected:
+  /*!
+   \brief Map a segment
+   \param size : size of the segment (bytes), a multiple of the page size
+   \return address of a zero-initialized mapping of size bytes, that can be
+   unmapped with munmap
+   \throw std::runtime_error : if the segment cannot be mapped
+   */
+  virtual void * map_segment(std::size_t size) = 0;
+
+private:
+  /*!
+   \brief Create a new segment
+   \param size : minimal size of the segment
+   \post a new segment of size at least max(size, segment size) has been
+   mapped, and it is the current segment
+   \throw std::runtime_error : if the segment cannot be mapped
+   */
+  void new_segment(std::size_t size);
+
+  std::size_t const _page_size;                          /*!< Size of pages */
+  std::size_t const _segment_size;                       /*!< Size of segments */
+  std::vector<std::pair<void *, std::size_t>> _segments; /*!< Mapped segments (address, size) */
+  char * _head;                                          /*!< First free byte in current segment */
+  char * _end;                                           /*!< Past-the-end byte of current segment */
+};
+
+/*!
+ \class mmap_segments_t
+ \brief Append-only memory allocator backed by memory-mapped files
+ \note Segments are files created in a directory and mapped in memory with
+ shared write access. Pages of a segment are backed by the file instead of swap
+ space: the operating system writes them back to the file and evicts them from
+ memory under memory pressure, and reloads them when they are accessed. Hence,
+ the resident memory is a bounded cache of the recently accessed pages, and the
+ allocated memory is bounded by the size of the storage device.
+ \note Segment files are unlinked as soon as they are mapped, hence they are
+ removed when they are unmapped, even if the program crashes
+ */
+class mmap_segments_t final : public tchecker::segments_t {
+public:
+  /*!
+   \brief Constructor
+   \param directory : directory where segment files are created
+   \param segment_size : size of segments
+   \pre directory exists and is writable
+   \post this allocator creates its segment files in directory. Each segment has
+   size at least segment_size (rounded to a multiple of the page size)
+   \throw std::invalid_argument : if directory is not a directory
+   */
+  mmap_segments_t(std::string const & directory, std::size_t segment_size = DEFAULT_SEGMENT_SIZE);
+
+  /*!
+   \brief Destructor
+   \post all segments have been unmapped and their files have been removed
+   */
+  virtual ~mmap_segments_t() = default;
+
+  /*!
+   \brief Accessor
+   \return directory of segment files
+   */
+  inline std::string const & directory() const { return _directory; }
+
+protected:
+  /*!
+   \brief Map a segment file
+   \param size : size of the segment (bytes)
+   \return address of a new segment file of size bytes in the directory,
+   mapped in memory
+   \throw std::runtime_error : if the segment file cannot be created or mapped
+   */
+  virtual void * map_segment(std::size_t size);
+
+private:
+  std::string const _directory; /*!< Directory of segment files */
+};
+
+/*!
+ \class anonymous_segments_t
+ \brief Append-only memory allocator backed by anonymous memory mappings
+ \note Segments can be bound to a NUMA node, in which case their pages are
+ preferably allocated on that node. Otherwise, pages are allocated on the node
+ of the thread that first accesses them (first-touch policy)
+ \note Segments can be backed by huge pages, which reduces TLB misses when
+ large amounts of memory are accessed randomly. Segments are then aligned on
+ huge pages, and their size is a multiple of HUGE_PAGE_SIZE
+ */
+class anonymous_segments_t final : public tchecker::segments_t {
+public:
+  /*!
+   \brief Constructor
+   \param segment_size : size of segments
+   \param numa_node : NUMA node of segments (-1 for no binding)
+   \param huge_pages : huge pages mode
+   \post each segment has size at least segment_size (rounded to a multiple of
+   the page size). If numa_node >= 0, segments are bound to numa_node. Segments
+   are backed by huge pages according to huge_pages
+   \note binding and transparent huge pages are hints: they are silently
+   ignored if they are not supported by the system
+   */
+  anonymous_segments_t(std::size_t segment_size = DEFAULT_SEGMENT_SIZE, int numa_node = -1,
+                       enum tchecker::huge_pages_t huge_pages = tchecker::HUGE_PAGES_NONE);
+
+  /*!
+   \brief Destructor
+   */
+  virtual ~anonymous_segments_t() = default;
+
+  /*!
+   \brief Accessor
+   \return NUMA node of segments (-1 if segments are not bound)
+   */
+  inline int numa_node() const { return _numa_node; }
+
+  /*!
+   \brief Accessor
+   \return huge pages mode of segments
+   */
+  inline enum tchecker::huge_pages_t huge_pages() const { return _huge_pages; }
+
+protected:
+  /*!
+   \brief Map an anonymous segment
+   \param size : size of the segment (bytes)
+   \return address of a new anonymous mapping of size bytes, bound to the NUMA
+   node if any, and backed by huge pages if required
+   \throw std::runtime_error : if the segment cannot be mapped, in particular if
+   explicit huge pages are required and the system has not enough huge pages
+   */
+  virtual void * map_segment(std::size_t size);
+
+private:
+  int const _numa_node;                           /*!< NUMA node of segments (-1 if none) */
+  enum tchecker::huge_pages_t const _huge_pages; /*!< Huge pages mode */
+};
+
+/*!
+ \brief Map anonymous memory
+ \param size : size of memory (bytes), a multiple of HUGE_PAGE_SIZE if
+ huge_pages is not tchecker::HUGE_PAGES_NONE
+ \param huge_pages : huge pages mode
+ \return address of a zero-initialized anonymous mapping of size bytes, backed
+ by huge pages according to huge_pages (see tchecker::anonymous_segments_t)
+ \throw std::runtime_error : if memory cannot be mapped, in particular if
+ explicit huge pages are required and the system has not enough huge pages
+ */
+void * map_anonymous(std::size_t size, enum tchecker::huge_pages_t huge_pages);
+
+/*!
+ \brief Unmap anonymous memory
+ \param address : address of a mapping returned by tchecker::map_anonymous
+ \param size : size of the mapping (bytes)
+ \post the mapping has been unmapped
+ */
+void unmap_anonymous(void * address, std::size_t size);
+
+/*!
+ \class huge_pages_allocator_t
+ \brief Allocator of large arrays backed by huge pages
+ \tparam T : type of allocated objects
+ \note Arrays of at least HUGE_PAGE_SIZE bytes are mapped on huge pages
+ according to the huge pages mode of the allocator, and their size is rounded to
+ a multiple of HUGE_PAGE_SIZE. Smaller arrays, and all arrays when the mode is
+ tchecker::HUGE_PAGES_NONE, are allocated from the heap. Hence, the bucket
+ arrays of large hash tables are backed by huge pages, whereas small
+ allocations such as the nodes of a hash table stay on the heap
+ \note The mode is propagated along with containers (copy, move and swap)
+ */
+template <class T> class huge_pages_allocator_t {
+public:
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+
+  /*!
+   \brief Constructor
+   \param huge_pages : huge pages mode
+   */
+  huge_pages_allocator_t(enum tchecker::huge_pages_t huge_pages = tchecker::HUGE_PAGES_NONE) noexcept
+      : _huge_pages(huge_pages)
+  {
+  }
+
+  /*!
+   \brief Converting constructor
+   \param a : an allocator
+   \post this allocator has the huge pages mode of a
+   */
+  template <class U>
+  huge_pages_allocator_t(tchecker::huge_pages_allocator_t<U> const & a) noexcept : _huge_pages(a.huge_pages())
+  {
+  }
+
+  /*!
+   \brief Allocate an array
+   \param n : number of objects
+   \return pointer to uninitialized memory for n objects of type T
+   \throw std::bad_alloc : if memory cannot be allocated from the heap
+   \throw std::runtime_error : if memory cannot be mapped
+   */
+  T * allocate(std::size_t n)
+  {
+    std::size_t const size = n * sizeof(T);
+    if (!mapped(size))
+      return static_cast<T *>(::operator new(size));
+    return static_cast<T *>(tchecker::map_anonymous(mapped_size(size), _huge_pages));
+  }
+
+  /*!
+   \brief Deallocate an array
+   \param p : pointer returned by allocate(n)
+   \param n : number of objects
+   \post the memory pointed by p has been released
+   */
+  void deallocate(T * p, std::size_t n) noexcept
+  {
+    std::size_t const size = n * sizeof(T);
+    if (!mapped(size))
+      ::operator delete(p);
+    else
+      tchecker::unmap_anonymous(p, mapped_size(size));
+  }
+
+  /*!
+   \brief Accessor
+   \return huge pages mode of this allocator
+   */
+  inline enum tchecker::huge_pages_t huge_pages() const { return _huge_pages; }
+
+  /*!
+   \brief Equality predicate
+   \param a : an allocator
+   \return true if this allocator and a have the same huge pages mode, false
+   otherwise
+   */
+  template <class U> bool operator==(tchecker::huge_pages_allocator_t<U> const & a) const
+  {
+    return _huge_pages == a.huge_pages();
+  }
+
+  /*!
+   \brief Disequality predicate
+   \param a : an allocator
+   \return false if this allocator and a have the same huge pages mode, true
+   otherwise
+   */
+  template <class U> bool operator!=(tchecker::huge_pages_allocator_t<U> const & a) const { return !(*this == a); }
+
+private:
+  /*!
+   \brief Check if memory is mapped
+   \param size : size of memory (bytes)
+   \return true if size bytes are mapped on huge pages by this allocator, false
+   if they are allocated from the heap
+   */
+  inline bool mapped(std::size_t size) const
+  {
+    return (_huge_pages != tchecker::HUGE_PAGES_NONE) && (size >= tchecker::HUGE_PAGE_SIZE);
+  }
+
+  /*!
+   \brief Size of mapped memory
+   \param size : size of memory (bytes)
+   \return the smallest multiple of HUGE_PAGE_SIZE that is greater than or equal
+   to size
+   */
+  static inline std::size_t mapped_size(std::size_t size)
+  {
+    return ((size + tchecker::HUGE_PAGE_SIZE - 1) / tchecker::HUGE_PAGE_SIZE) * tchecker::HUGE_PAGE_SIZE;
+  }
+
+  enum tchecker::huge_pages_t _huge_pages; /*!< Huge pages mode */
+};
+
+/*!
+ \brief NUMA node of the calling thread
+ \return NUMA node of the CPU the calling thread is running on, -1 if unknown
+ */
+int current_numa_node();
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_SEGMENTS_HH
@@ -9,6 +9,7 @@
 #define TCHECKER_SHARED_OBJECTS_HH
 
 #include <exception>
+#include <stdexcept>
 #include <limits>
 
 #if BOOST_VERSION <= 106600
@@ -26,6 +27,172 @@
 
 namespace tchecker {
 
+// reference counting policies
+
+/*!
+ \class sequential_refcount_t
+ \brief Reference counting policy with plain reference counters
+ \note Objects with this policy should not be shared among threads
+ */
+class sequential_refcount_t {
+public:
+  /*!
+   \brief Load a reference counter
+   \param refcount : pointer to a reference counter
+   \return value of *refcount
+   */
+  template <class REFCOUNT> static inline REFCOUNT load(REFCOUNT const * refcount) { return *refcount; }
+
+  /*!
+   \brief Store a reference counter
+   \param refcount : pointer to a reference counter
+   \param value : a value
+   \post *refcount has value
+   */
+  template <class REFCOUNT> static inline void store(REFCOUNT * refcount, REFCOUNT value) { *refcount = value; }
+
+  /*!
+   \brief Increment a reference counter
+   \param refcount : pointer to a reference counter
+   \post *refcount has been incremented
+   \return value of *refcount before increment
+   */
+  template <class REFCOUNT> static inline REFCOUNT fetch_add(REFCOUNT * refcount) { return (*refcount)++; }
+
+  /*!
+   \brief Increment a reference counter below a bound
+   \param refcount : pointer to a reference counter
+   \param bound : a value
+   \post *refcount has been incremented if its value was smaller than bound,
+   and it is unchanged otherwise
+   \return value of *refcount before increment
+   */
+  template <class REFCOUNT> static inline REFCOUNT fetch_add_below(REFCOUNT * refcount, REFCOUNT bound)
+  {
+    REFCOUNT const value = *refcount;
+    if (value < bound)
+      *refcount = value + 1;
+    return value;
+  }
+
+  /*!
+   \brief Decrement a reference counter
+   \param refcount : pointer to a reference counter
+   \post *refcount has been decremented
+   \return value of *refcount before decrement
+   */
+  template <class REFCOUNT> static inline REFCOUNT fetch_sub(REFCOUNT * refcount) { return (*refcount)--; }
+
+  /*!
+   \brief Compare and set a reference counter
+   \param refcount : pointer to a reference counter
+   \param expected : expected value
+   \param desired : new value
+   \post *refcount has value desired if it had value expected, and it is
+   unchanged otherwise
+   \return true if *refcount had value expected, false otherwise
+   */
+  template <class REFCOUNT> static inline bool compare_and_set(REFCOUNT * refcount, REFCOUNT expected, REFCOUNT desired)
+  {
+    if (*refcount != expected)
+      return false;
+    *refcount = desired;
+    return true;
+  }
+};
+
+/*!
+ \class atomic_refcount_t
+ \brief Reference counting policy with atomic reference counters
+ \note Objects with this policy can be shared among threads. Increments are
+ relaxed, since a reference can only be taken from an existing reference.
+ Decrements have acquire-release ordering, so that all accesses to an object
+ through a reference happen before the object is collected. Allocators read
+ and write reference counters with acquire and release ordering
+ \note reference counters are plain unsigned integers accessed with the
+ __atomic builtins of GCC and Clang, hence the memory layout is the same as
+ with tchecker::sequential_refcount_t
+ */
+class atomic_refcount_t {
+public:
+  /*!
+   \brief Load a reference counter
+   \param refcount : pointer to a reference counter
+   \return value of *refcount
+   */
+  template <class REFCOUNT> static inline REFCOUNT load(REFCOUNT const * refcount)
+  {
+    return __atomic_load_n(refcount, __ATOMIC_ACQUIRE);
+  }
+
+  /*!
+   \brief Store a reference counter
+   \param refcount : pointer to a reference counter
+   \param value : a value
+   \post *refcount has value
+   */
+  template <class REFCOUNT> static inline void store(REFCOUNT * refcount, REFCOUNT value)
+  {
+    __atomic_store_n(refcount, value, __ATOMIC_RELEASE);
+  }
+
+  /*!
+   \brief Increment a reference counter
+   \param refcount : pointer to a reference counter
+   \post *refcount has been incremented
+   \return value of *refcount before increment
+   */
+  template <class REFCOUNT> static inline REFCOUNT fetch_add(REFCOUNT * refcount)
+  {
+    return __atomic_fetch_add(refcount, 1, __ATOMIC_RELAXED);
+  }
+
+  /*!
+   \brief Increment a reference counter below a bound
+   \param refcount : pointer to a reference counter
+   \param bound : a value
+   \post *refcount has been incremented if its value was smaller than bound,
+   and it is unchanged otherwise
+   \return value of *refcount before increment
+   \note the value is checked and incremented atomically. Hence, a counter
+   that is set to a value above bound concurrently (e.g. FREE_CHUNK by
+   tchecker::pool_t::collect) is never incremented
+   */
+  template <class REFCOUNT> static inline REFCOUNT fetch_add_below(REFCOUNT * refcount, REFCOUNT bound)
+  {
+    REFCOUNT value = __atomic_load_n(refcount, __ATOMIC_RELAXED);
+    while (value < bound &&
+           !__atomic_compare_exchange_n(refcount, &value, value + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+      ;
+    return value;
+  }
+
+  /*!
+   \brief Decrement a reference counter
+   \param refcount : pointer to a reference counter
+   \post *refcount has been decremented
+   \return value of *refcount before decrement
+   */
+  template <class REFCOUNT> static inline REFCOUNT fetch_sub(REFCOUNT * refcount)
+  {
+    return __atomic_fetch_sub(refcount, 1, __ATOMIC_ACQ_REL);
+  }
+
+  /*!
+   \brief Compare and set a reference counter
+   \param refcount : pointer to a reference counter
+   \param expected : expected value
+   \param desired : new value
+   \post *refcount has value desired if it had value expected, and it is
+   unchanged otherwise
+   \return true if *refcount had value expected, false otherwise
+   */
+  template <class REFCOUNT> static inline bool compare_and_set(REFCOUNT * refcount, REFCOUNT expected, REFCOUNT desired)
+  {
+    return __atomic_compare_exchange_n(refcount, &expected, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+  }
+};
+
 // shared objects
 
 /*!
@@ -44,8 +211,12 @@ namespace tchecker {
  reference counting. The values above REFCOUNT_MAX can be used by allocators
  to represent other states of this object. The default value, 1, is the number
  of states needed by tchecker::pool_t
+ \tparam POLICY : reference counting policy, either
+ tchecker::sequential_refcount_t (default) or tchecker::atomic_refcount_t for
+ objects that are shared among threads
  */
-template <class T, class REFCOUNT = std::size_t, std::size_t RESERVED = 1> class make_shared_t final : public T {
+template <class T, class REFCOUNT = std::size_t, std::size_t RESERVED = 1, class POLICY = tchecker::sequential_refcount_t>
+class make_shared_t final : public T {
 
   static_assert(std::is_unsigned<REFCOUNT>::value, "REFCOUNT must be an unsigned type");
   static_assert(sizeof(REFCOUNT) % alignof(T *) == 0, "REFCOUNT size must be a multiple of pointer alignment");
@@ -61,6 +232,16 @@ public:
    */
   using refcount_t = REFCOUNT;
 
+  /*!
+   \brief Reference counting policy
+   */
+  using refcount_policy_t = POLICY;
+
+  /*!
+   \brief Number of reserved values of the reference counter
+   */
+  constexpr static std::size_t REFCOUNT_RESERVED = RESERVED;
+
   /*!
    \brief Maximal value of the reference counter
    \note Values above REFCOUNT_MAX are used by pool allocators to represent
@@ -81,7 +262,7 @@ public:
    */
   template <class... ARGS> static inline void construct(void * ptr, ARGS &&... args)
   {
-    new (ptr) make_shared_t<T, REFCOUNT, RESERVED>(args...);
+    new (ptr) make_shared_t<T, REFCOUNT, RESERVED, POLICY>(args...);
   }
 
   /*!
@@ -89,10 +270,11 @@ public:
    \param args : parameters to a constructor of type T
    \note see tchecker::make_shared_t::construct
    */
-  template <class... ARGS> static tchecker::make_shared_t<T, REFCOUNT, RESERVED> * allocate_and_construct(ARGS &&... args)
+  template <class... ARGS>
+  static tchecker::make_shared_t<T, REFCOUNT, RESERVED, POLICY> * allocate_and_construct(ARGS &&... args)
   {
     std::size_t const alloc_size =
-        tchecker::allocation_size_t<tchecker::make_shared_t<T, REFCOUNT, RESERVED>>().alloc_size(args...);
+        tchecker::allocation_size_t<tchecker::make_shared_t<T, REFCOUNT, RESERVED, POLICY>>().alloc_size(args...);
 
     char * ptr = new char[alloc_size];
     ptr += sizeof(refcount_t); // shared object starts after refcount
@@ -106,7 +288,7 @@ public:
       throw;
     }
 
-    return reinterpret_cast<tchecker::make_shared_t<T, REFCOUNT, RESERVED> *>(ptr);
+    return reinterpret_cast<tchecker::make_shared_t<T, REFCOUNT, RESERVED, POLICY> *>(ptr);
   }
 
   /*!
@@ -114,7 +296,10 @@ public:
    \param ptr : shared object
    \post the destructor of ptr has been called
    */
-  static void destruct(make_shared_t<T, REFCOUNT, RESERVED> * ptr) { ptr->~make_shared_t<T, REFCOUNT, RESERVED>(); }
+  static void destruct(make_shared_t<T, REFCOUNT, RESERVED, POLICY> * ptr)
+  {
+    ptr->~make_shared_t<T, REFCOUNT, RESERVED, POLICY>();
+  }
 
   /*!
    \brief Object destruction and deallocation
@@ -123,9 +308,9 @@ public:
    maked_shared_t<T, REFCOUNT, RESERVED>::allocate_and_construct()
    \post the destructor of ptr has been called, and ptr has been deleted
    */
-  static void destruct_and_deallocate(make_shared_t<T, REFCOUNT, RESERVED> * ptr)
+  static void destruct_and_deallocate(make_shared_t<T, REFCOUNT, RESERVED, POLICY> * ptr)
   {
-    make_shared_t<T, REFCOUNT, RESERVED>::destruct(ptr);
+    make_shared_t<T, REFCOUNT, RESERVED, POLICY>::destruct(ptr);
 
     char * p = reinterpret_cast<char *>(ptr) - sizeof(refcount_t);
     delete[] p;
@@ -137,7 +322,7 @@ public:
    \post t has been assign to this
    \note the reference counter is not touched
    */
-  make_shared_t<T, REFCOUNT, RESERVED> & operator=(tchecker::make_shared_t<T, REFCOUNT, RESERVED> const & t)
+  make_shared_t<T, REFCOUNT, RESERVED, POLICY> & operator=(tchecker::make_shared_t<T, REFCOUNT, RESERVED, POLICY> const & t)
   {
     this->T::operator=(t);
     return *this;
@@ -149,7 +334,7 @@ public:
    \post t has been moved to this
    \note the reference counter is not touched
    */
-  make_shared_t<T, REFCOUNT, RESERVED> & operator=(tchecker::make_shared_t<T, REFCOUNT, RESERVED> && t)
+  make_shared_t<T, REFCOUNT, RESERVED, POLICY> & operator=(tchecker::make_shared_t<T, REFCOUNT, RESERVED, POLICY> && t)
   {
     this->T::operator=(std::move(t));
     return *this;
@@ -160,13 +345,21 @@ public:
    \post The reference counter has been incremented
    \thow std::overflow_error : if the value of the reference counter exceeds
    the maximal value
+   \throw std::logic_error : if this object has been collected (i.e. the
+   reference counter has a reserved value). The reference counter is left
+   unchanged
+   \note with tchecker::atomic_refcount_t, a reference cannot be taken on an
+   object that is being collected concurrently
    */
   inline void take_reference(void) const
   {
     refcount_t * refcount = refcount_addr();
-    *refcount += 1;
-    if (*refcount == REFCOUNT_MAX) // overflow
-      throw std::overflow_error("reference counter overflow");
+    refcount_t const value = POLICY::fetch_add_below(refcount, refcount_t(REFCOUNT_MAX - 1));
+    if (value < REFCOUNT_MAX - 1)
+      return;
+    if (value > REFCOUNT_MAX)
+      throw std::logic_error("reference on a collected object");
+    throw std::overflow_error("reference counter overflow");
   }
 
   /*!
@@ -178,16 +371,17 @@ public:
   inline void release_reference(void) const
   {
     refcount_t * refcount = refcount_addr();
-    if (*refcount == 0)
+    if (POLICY::fetch_sub(refcount) == 0) {
+      POLICY::fetch_add(refcount);
       throw std::underflow_error("reference counter underflow");
-    *refcount -= 1;
+    }
   }
 
   /*!
    \brief Accessor
    \return The value of the reference counter
    */
-  inline constexpr std::size_t refcount(void) const { return *(refcount_addr()); }
+  inline std::size_t refcount(void) const { return POLICY::load(refcount_addr()); }
 
 private:
   /*!
@@ -199,7 +393,7 @@ private:
   template <class... ARGS> make_shared_t(ARGS &&... args) : T(std::forward<ARGS>(args)...)
   {
     refcount_t * const refcount = refcount_addr();
-    *refcount = 0;
+    POLICY::store(refcount, refcount_t(0));
   }
 
   /*!
@@ -208,10 +402,10 @@ private:
    \post this is a copy of shared
    The reference counter has value 0
    */
-  make_shared_t(make_shared_t<T, REFCOUNT, RESERVED> const & shared) : T(shared)
+  make_shared_t(make_shared_t<T, REFCOUNT, RESERVED, POLICY> const & shared) : T(shared)
   {
     refcount_t * const refcount = refcount_addr();
-    *refcount = 0;
+    POLICY::store(refcount, refcount_t(0));
   }
 
   /*!
@@ -225,10 +419,20 @@ private:
    */
   constexpr refcount_t * refcount_addr() const
   {
-    return (reinterpret_cast<refcount_t *>(const_cast<tchecker::make_shared_t<T> *>(this)) - 1);
+    return (reinterpret_cast<refcount_t *>(const_cast<tchecker::make_shared_t<T, REFCOUNT, RESERVED, POLICY> *>(this)) - 1);
   }
 };
 
+/*!
+ \brief Type of shared objects with atomic reference counters
+ \tparam T : type to share
+ \note these objects can be shared among threads, and allocated by
+ tchecker::pool_t. Sequential code should use tchecker::make_shared_t<T>,
+ that does not pay for atomic operations
+ */
+template <class T>
+using make_atomic_shared_t = tchecker::make_shared_t<T, std::size_t, 1, tchecker::atomic_refcount_t>;
+
 // allocation size for shared objects
 
 /*!
@@ -238,7 +442,8 @@ private:
  \note A specialization of tchecker::allocation_size_t should be defined for
  type T in namespace tchecker
  */
-template <class T> class allocation_size_t<tchecker::make_shared_t<T>> {
+template <class T, class REFCOUNT, std::size_t RESERVED, class POLICY>
+class allocation_size_t<tchecker::make_shared_t<T, REFCOUNT, RESERVED, POLICY>> {
 public:
   /*!
    \brief Accessor
@@ -250,7 +455,7 @@ public:
   template <class... ARGS> static constexpr std::size_t alloc_size(ARGS &&... args)
   {
     // allocation size for T + size of reference counter
-    return (tchecker::allocation_size_t<T>().alloc_size(args...) + sizeof(typename tchecker::make_shared_t<T>::refcount_t));
+    return (tchecker::allocation_size_t<T>().alloc_size(args...) + sizeof(REFCOUNT));
   }
 };
 
@@ -262,9 +467,9 @@ public:
  \param shared2 : shared object
  \return true if shared1 and shared2 are equal w.r.t. equality for type T, false otherwise
  */
-template <class T, class REFCOUNT, std::size_t RESERVED>
-bool operator==(tchecker::make_shared_t<T, REFCOUNT, RESERVED> const & shared1,
-                tchecker::make_shared_t<T, REFCOUNT, RESERVED> const & shared2)
+template <class T, class REFCOUNT, std::size_t RESERVED, class POLICY>
+bool operator==(tchecker::make_shared_t<T, REFCOUNT, RESERVED, POLICY> const & shared1,
+                tchecker::make_shared_t<T, REFCOUNT, RESERVED, POLICY> const & shared2)
 {
   return (static_cast<T const &>(shared1) == static_cast<T const &>(shared2));
 }
@@ -275,9 +480,9 @@ bool operator==(tchecker::make_shared_t<T, REFCOUNT, RESERVED> const & shared1,
  \param shared2 : shared object
  \return false if shared1 and shared2 are equal w.r.t. equality for type T, true otherwise
  */
-template <class T, class REFCOUNT, std::size_t RESERVED>
-bool operator!=(tchecker::make_shared_t<T, REFCOUNT, RESERVED> const & shared1,
-                tchecker::make_shared_t<T, REFCOUNT, RESERVED> const & shared2)
+template <class T, class REFCOUNT, std::size_t RESERVED, class POLICY>
+bool operator!=(tchecker::make_shared_t<T, REFCOUNT, RESERVED, POLICY> const & shared1,
+                tchecker::make_shared_t<T, REFCOUNT, RESERVED, POLICY> const & shared2)
 {
   return (!(shared1 == shared2));
 }
@@ -287,8 +492,8 @@ bool operator!=(tchecker::make_shared_t<T, REFCOUNT, RESERVED> const & shared1,
  \param shared : shared object
  \return hash value for shared
  */
-template <class T, class REFCOUNT, std::size_t RESERVED>
-std::size_t hash_value(tchecker::make_shared_t<T, REFCOUNT, RESERVED> const & shared)
+template <class T, class REFCOUNT, std::size_t RESERVED, class POLICY>
+std::size_t hash_value(tchecker::make_shared_t<T, REFCOUNT, RESERVED, POLICY> const & shared)
 {
   return hash_value(static_cast<T const &>(shared));
 }
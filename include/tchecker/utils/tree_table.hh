@@ -0,0 +1,182 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_TREE_TABLE_HH
+#define TCHECKER_TREE_TABLE_HH
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "tchecker/basictypes.hh"
+#include "tchecker/utils/spinlock.hh"
+
+/*!
+ \file tree_table.hh
+ \brief Tree compression of fixed-width vectors of words
+ */
+
+namespace tchecker {
+
+/*!
+ \class tree_table_t
+ \brief Table of vectors of words stored as hash-consed binary trees
+ \note A vector of width n > 1 is split in two halves, which are stored
+ recursively, and the vector is represented by the pair of the representations
+ of its halves, hash-consed in a table of pairs. A vector of width 1 is
+ represented by its word. Hence, vectors that share halves (e.g. tuples of
+ locations that differ on one process only) share the corresponding subtrees,
+ and each new vector costs as few as one pair of indices in the table.
+ Pairs at all levels of the trees are stored in the same table
+ \note Pairs are identified by their insertion order, which is stable: a table
+ that is rebuilt by inserting the pairs of another table in order (see
+ find_or_add) has the same identifiers
+ \note This table is thread-safe: all operations are serialized by a spin lock
+ \note Checkpoints store the discrete parts of their nodes in a tree table (see
+ tchecker::algorithms::zg_reach::save_checkpoint). The states of the explorers
+ do not: their tuples of locations and valuations are shared as a whole by the
+ state allocators, and their memory is dominated by zones
+ */
+class tree_table_t {
+public:
+  /*!
+   \brief Type of identifiers of vectors
+   */
+  using index_t = std::uint64_t;
+
+  /*!
+   \brief Constructor
+   \param width : number of words in vectors
+   \param table_size : initial number of pairs that can be stored before the
+   table is resized
+   \post this is an empty table of vectors of width words
+   */
+  tree_table_t(std::size_t width, std::size_t table_size = 65536);
+
+  /*!
+   \brief Copy constructor (deleted)
+   */
+  tree_table_t(tchecker::tree_table_t const &) = delete;
+
+  /*!
+   \brief Move constructor (deleted)
+   */
+  tree_table_t(tchecker::tree_table_t &&) = delete;
+
+  /*!
+   \brief Destructor
+   */
+  ~tree_table_t() = default;
+
+  /*!
+   \brief Assignment operator (deleted)
+   */
+  tchecker::tree_table_t & operator=(tchecker::tree_table_t const &) = delete;
+
+  /*!
+   \brief Move-assignment operator (deleted)
+   */
+  tchecker::tree_table_t & operator=(tchecker::tree_table_t &&) = delete;
+
+  /*!
+   \brief Accessor
+   \return number of words in vectors
+   */
+  inline std::size_t width() const { return _width; }
+
+  /*!
+   \brief Insert a vector
+   \param v : array of words
+   \pre v has width() words
+   \post all the pairs in the tree of v have been added to the table (if not yet in)
+   \return identifier of v
+   */
+  index_t insert(tchecker::packed_word_t const * v);
+
+  /*!
+   \brief Retrieve a vector
+   \param id : identifier of a vector
+   \param v : array of words
+   \pre id has been returned by insert, v has width() words
+   \post v is the vector identified by id
+   \throw std::out_of_range : if id is not a valid identifier
+   */
+  void get(index_t id, tchecker::packed_word_t * v) const;
+
+  /*!
+   \brief Find or add a pair
+   \param left : left component
+   \param right : right component
+   \post the pair (left,right) has been added to the table (if not yet in)
+   \return identifier of the pair (left,right)
+   */
+  index_t find_or_add(index_t left, index_t right);
+
+  /*!
+   \brief Accessor
+   \param id : identifier of a pair
+   \pre id < pairs_count()
+   \return the pair identified by id
+   \throw std::out_of_range : if id >= pairs_count()
+   */
+  std::pair<index_t, index_t> pair(index_t id) const;
+
+  /*!
+   \brief Accessor
+   \return number of pairs in the table
+   */
+  std::size_t pairs_count() const;
+
+  /*!
+   \brief Accessor
+   \return memory used by this table (in bytes)
+   */
+  std::size_t memsize() const;
+
+private:
+  /*!
+   \brief Find or add a pair (without locking)
+   \param left : left component
+   \param right : right component
+   \post the pair (left,right) has been added to the table (if not yet in)
+   \return identifier of the pair (left,right)
+   */
+  index_t find_or_add_unlocked(index_t left, index_t right);
+
+  /*!
+   \brief Insert a vector (without locking)
+   \param v : array of words
+   \param width : number of words in v
+   \return identifier of v
+   */
+  index_t insert_unlocked(tchecker::packed_word_t const * v, std::size_t width);
+
+  /*!
+   \brief Retrieve a vector (without locking)
+   \param id : identifier of a vector
+   \param v : array of words
+   \param width : number of words in v
+   \post v is the vector identified by id
+   */
+  void get_unlocked(index_t id, tchecker::packed_word_t * v, std::size_t width) const;
+
+  /*!
+   \brief Double the number of buckets
+   \post all pairs have been rehashed in the new buckets
+   */
+  void grow();
+
+  std::size_t _width;                              /*!< Number of words in vectors */
+  std::vector<std::pair<index_t, index_t>> _pairs; /*!< Pairs, in insertion order */
+  std::vector<index_t> _buckets;                   /*!< Open-addressing table : pair ID + 1 (0 for empty) */
+  mutable tchecker::spinlock_t _lock;              /*!< Lock */
+};
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_TREE_TABLE_HH
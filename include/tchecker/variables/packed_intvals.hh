@@ -0,0 +1,132 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_PACKED_INTVALS_HH
+#define TCHECKER_PACKED_INTVALS_HH
+
+#include <cstdint>
+#include <vector>
+
+#include "tchecker/basictypes.hh"
+#include "tchecker/variables/intvars.hh"
+
+/*!
+ \file packed_intvals.hh
+ \brief Bit-packed valuations of bounded integer variables
+ */
+
+namespace tchecker {
+
+/*!
+ \class intval_packing_t
+ \brief Layout of bit-packed valuations of bounded integer variables
+ \note Each flattened variable with domain [min,max] is stored as value-min on
+ ceil(log2(max-min+1)) bits. Variables are laid out in order of identifiers,
+ and a variable that does not fit in the remaining bits of a word starts a new
+ word, hence packing and unpacking never read more than one word per variable.
+ Variables with a singleton domain take no bit at all
+ \note Packed valuations are the stored form of valuations in checkpoints (see
+ tchecker::algorithms::zg_reach::save_checkpoint). The states of the explorers
+ keep tchecker::intval_t: the VM evaluates guards and statements on it, and
+ valuations are already hash-consed by the state allocators
+ */
+class intval_packing_t {
+public:
+  /*!
+   \brief Constructor
+   \param intvars : flat bounded integer variables
+   \post this is the layout of packed valuations of intvars
+   */
+  intval_packing_t(tchecker::flat_integer_variables_t const & intvars);
+
+  /*!
+   \brief Copy constructor
+   */
+  intval_packing_t(tchecker::intval_packing_t const &) = default;
+
+  /*!
+   \brief Move constructor
+   */
+  intval_packing_t(tchecker::intval_packing_t &&) = default;
+
+  /*!
+   \brief Destructor
+   */
+  ~intval_packing_t() = default;
+
+  /*!
+   \brief Assignment operator
+   */
+  tchecker::intval_packing_t & operator=(tchecker::intval_packing_t const &) = default;
+
+  /*!
+   \brief Move-assignment operator
+   */
+  tchecker::intval_packing_t & operator=(tchecker::intval_packing_t &&) = default;
+
+  /*!
+   \brief Accessor
+   \return number of flattened variables
+   */
+  inline std::size_t intvars_count() const { return _fields.size(); }
+
+  /*!
+   \brief Accessor
+   \return number of words in packed valuations
+   */
+  inline std::size_t words_count() const { return _words_count; }
+
+  /*!
+   \brief Accessor
+   \param id : flattened variable identifier
+   \pre id < intvars_count()
+   \return number of bits used to store variable id
+   */
+  inline unsigned bits(tchecker::intvar_id_t id) const { return _fields[id].bits; }
+
+  /*!
+   \brief Pack a valuation
+   \param intval : valuation of bounded integer variables
+   \param words : array of packed words
+   \pre intval has size intvars_count(), words has size words_count()
+   \post words contains the packed valuation intval
+   \throw std::invalid_argument : if intval does not have size intvars_count()
+   \throw std::out_of_range : if a value in intval is not in the domain of its variable
+   */
+  void pack(tchecker::intval_t const & intval, tchecker::packed_word_t * words) const;
+
+  /*!
+   \brief Unpack a valuation
+   \param words : array of packed words
+   \param intval : valuation of bounded integer variables
+   \pre words has size words_count() and has been filled by pack, intval has
+   size intvars_count()
+   \post intval is the valuation packed in words
+   \throw std::invalid_argument : if intval does not have size intvars_count()
+   */
+  void unpack(tchecker::packed_word_t const * words, tchecker::intval_t & intval) const;
+
+private:
+  /*!
+   \brief Position of a variable in packed valuations
+   */
+  struct field_t {
+    tchecker::integer_t min;      /*!< Minimal value of the variable */
+    tchecker::integer_t max;      /*!< Maximal value of the variable */
+    std::uint32_t word;           /*!< Index of the word that stores the variable */
+    unsigned shift;               /*!< Position of the first bit in the word */
+    unsigned bits;                /*!< Number of bits */
+    tchecker::packed_word_t mask; /*!< Mask of bits (before shift) */
+  };
+
+  std::vector<field_t> _fields; /*!< Map : flattened variable ID -> position */
+  std::size_t _words_count;     /*!< Number of words */
+};
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_PACKED_INTVALS_HH
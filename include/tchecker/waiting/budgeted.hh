@@ -0,0 +1,131 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_WAITING_BUDGETED_HH
+#define TCHECKER_WAITING_BUDGETED_HH
+
+#include <memory>
+
+#include "tchecker/utils/memory_budget.hh"
+#include "tchecker/waiting/waiting.hh"
+
+/*!
+ \file budgeted.hh
+ \brief Waiting container that enforces a memory budget
+ */
+
+namespace tchecker {
+
+namespace waiting {
+
+/*!
+ \class budgeted_t
+ \brief Waiting container that checks a memory budget at regular intervals, and
+ that appears empty once the budget has been exceeded
+ \tparam T : type of waiting elements
+ \note The budget is checked from empty(), i.e. between two iterations of the
+ algorithms that loop until their waiting container is empty. Hence, degradation
+ (see tchecker::memory_budget_t) happens when the algorithm holds no reference
+ to edges of its graph, and exceeding the budget stops the algorithm as if the
+ state-space had been fully explored. Waiting elements are kept, and the
+ verdict is only valid for the explored part of the state-space
+ */
+template <class T> class budgeted_t : public tchecker::waiting::waiting_t<T> {
+public:
+  /*!
+   \brief Constructor
+   \param w : a waiting container
+   \param budget : a memory budget
+   \param period : number of iterations between two checks of budget
+   \pre w is not nullptr
+   \post this container owns w, it keeps a reference to budget, and it checks
+   budget every period calls to empty()
+   */
+  budgeted_t(tchecker::waiting::waiting_t<T> * w, tchecker::memory_budget_t & budget, unsigned long period)
+      : _w(w), _budget(budget), _period(period), _count(0)
+  {
+  }
+
+  /*!
+   \brief Copy constructor (deleted)
+   */
+  budgeted_t(tchecker::waiting::budgeted_t<T> const &) = delete;
+
+  /*!
+   \brief Destructor
+   */
+  virtual ~budgeted_t() = default;
+
+  /*!
+   \brief Assignment operator (deleted)
+   */
+  tchecker::waiting::budgeted_t<T> & operator=(tchecker::waiting::budgeted_t<T> const &) = delete;
+
+  /*!
+   \brief Accessor
+   \return true if the container is empty or if the budget has been exceeded,
+   false otherwise
+   \post the budget has been checked if period calls have been made since last
+   check
+   */
+  virtual bool empty()
+  {
+    if (_budget.exceeded() || _w->empty())
+      return true;
+    if (++_count >= _period) {
+      _count = 0;
+      return !_budget.check();
+    }
+    return false;
+  }
+
+  /*!
+   \brief Clear the container
+   \post this container is empty
+   */
+  virtual void clear() { _w->clear(); }
+
+  /*!
+   \brief Insert
+   \param t : element
+   \post t has been inserted in this container
+   */
+  virtual void insert(T const & t) { _w->insert(t); }
+
+  /*!
+   \brief Remove first element
+   \pre not empty()
+   \post the first element has been removed from this container
+   */
+  virtual void remove_first() { _w->remove_first(); }
+
+  /*!
+   \brief Accessor
+   \pre not empty()
+   \return first element of this container
+   */
+  virtual T const & first() { return _w->first(); }
+
+  /*!
+   \brief Remove an element
+   \param t : element
+   \post t is not waiting anymore
+   */
+  virtual void remove(T const & t) { _w->remove(t); }
+
+private:
+  std::unique_ptr<tchecker::waiting::waiting_t<T>> _w; /*!< Waiting container */
+  tchecker::memory_budget_t & _budget;                 /*!< Memory budget */
+  unsigned long _period;                               /*!< Number of iterations between two checks */
+  unsigned long _count;                                /*!< Number of iterations since last check */
+};
+
+} // end of namespace waiting
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_WAITING_BUDGETED_HH
@@ -0,0 +1,129 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_WAITING_CANCELLABLE_HH
+#define TCHECKER_WAITING_CANCELLABLE_HH
+
+#include <atomic>
+#include <memory>
+
+#include "tchecker/waiting/waiting.hh"
+
+/*!
+ \file cancellable.hh
+ \brief Waiting container that can be cancelled from another thread
+ */
+
+namespace tchecker {
+
+namespace waiting {
+
+/*!
+ \class cancellable_t
+ \brief Waiting container that appears empty once cancellation has been
+ requested
+ \tparam T : type of waiting elements
+ \note Algorithms that iterate until their waiting container is empty stop
+ after their current iteration when cancellation is requested. This allows to
+ interrupt an algorithm running in a thread without modifying the algorithm
+ */
+template <class T> class cancellable_t : public tchecker::waiting::waiting_t<T> {
+public:
+  /*!
+   \brief Constructor
+   \param w : a waiting container
+   \param cancel : cancellation flag
+   \pre w is not nullptr
+   \post this container owns w, and it keeps a reference to cancel
+   */
+  cancellable_t(tchecker::waiting::waiting_t<T> * w, std::atomic<bool> const & cancel) : _w(w), _cancel(cancel), _cancelled(false)
+  {
+  }
+
+  /*!
+   \brief Copy constructor (deleted)
+   */
+  cancellable_t(tchecker::waiting::cancellable_t<T> const &) = delete;
+
+  /*!
+   \brief Destructor
+   */
+  virtual ~cancellable_t() = default;
+
+  /*!
+   \brief Assignment operator (deleted)
+   */
+  tchecker::waiting::cancellable_t<T> & operator=(tchecker::waiting::cancellable_t<T> const &) = delete;
+
+  /*!
+   \brief Accessor
+   \return true if cancellation has been requested or the container is empty,
+   false otherwise
+   \post cancelled() is true if cancellation has been requested while the
+   container was not empty
+   */
+  virtual bool empty()
+  {
+    if (_w->empty())
+      return true;
+    if (_cancel.load(std::memory_order_relaxed))
+      _cancelled = true;
+    return _cancelled;
+  }
+
+  /*!
+   \brief Clear the container
+   \post this container is empty
+   */
+  virtual void clear() { _w->clear(); }
+
+  /*!
+   \brief Insert
+   \param t : element
+   \post t has been inserted in this container
+   */
+  virtual void insert(T const & t) { _w->insert(t); }
+
+  /*!
+   \brief Remove first element
+   \pre not empty()
+   \post the first element has been removed from this container
+   */
+  virtual void remove_first() { _w->remove_first(); }
+
+  /*!
+   \brief Accessor
+   \pre not empty()
+   \return first element of this container
+   */
+  virtual T const & first() { return _w->first(); }
+
+  /*!
+   \brief Remove an element
+   \param t : element
+   \post t is not waiting anymore
+   */
+  virtual void remove(T const & t) { _w->remove(t); }
+
+  /*!
+   \brief Accessor
+   \return true if this container has appeared empty due to a cancellation
+   request while there were still waiting elements, false otherwise
+   */
+  inline bool cancelled() const { return _cancelled; }
+
+private:
+  std::unique_ptr<tchecker::waiting::waiting_t<T>> _w; /*!< Waiting container */
+  std::atomic<bool> const & _cancel;                   /*!< Cancellation flag */
+  bool _cancelled;                                     /*!< Cancellation status */
+};
+
+} // end of namespace waiting
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_WAITING_CANCELLABLE_HH
@@ -0,0 +1,196 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_WAITING_CHECKPOINTING_HH
+#define TCHECKER_WAITING_CHECKPOINTING_HH
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "tchecker/waiting/factory.hh"
+#include "tchecker/waiting/waiting.hh"
+
+/*!
+ \file checkpointing.hh
+ \brief Waiting container that periodically calls a checkpoint function
+ */
+
+namespace tchecker {
+
+namespace waiting {
+
+/*!
+ \brief Move the elements of a waiting container to a vector
+ \tparam T : type of waiting elements
+ \param w : a waiting container
+ \param v : a vector
+ \post the elements of w have been appended to v in the order in which they
+ are removed from w, and w is empty
+ */
+template <class T> void drain(tchecker::waiting::waiting_t<T> & w, std::vector<T> & v)
+{
+  while (!w.empty()) {
+    v.push_back(w.first());
+    w.remove_first();
+  }
+}
+
+/*!
+ \brief Fill a waiting container from a vector
+ \tparam T : type of waiting elements
+ \param w : a waiting container
+ \param v : a vector of elements in the order in which they must be removed
+ from w
+ \param policy : policy of w
+ \pre policy is QUEUE, FAST_REMOVE_QUEUE, STACK or FAST_REMOVE_STACK
+ \post the elements in v have been inserted in w, in such a way that they are
+ removed from w in the order of v
+ \throw std::invalid_argument : if policy is a priority queue (the order of
+ elements is determined by the container)
+ */
+template <class T>
+void fill(tchecker::waiting::waiting_t<T> & w, std::vector<T> const & v, enum tchecker::waiting::policy_t policy)
+{
+  switch (policy) {
+  case tchecker::waiting::QUEUE:
+  case tchecker::waiting::FAST_REMOVE_QUEUE:
+    for (T const & t : v)
+      w.insert(t);
+    break;
+  case tchecker::waiting::STACK:
+  case tchecker::waiting::FAST_REMOVE_STACK:
+    for (auto it = v.rbegin(); it != v.rend(); ++it)
+      w.insert(*it);
+    break;
+  default:
+    throw std::invalid_argument("Unsupported waiting policy");
+  }
+}
+
+/*!
+ \class checkpointing_t
+ \brief Waiting container that calls a checkpoint function at regular time
+ intervals
+ \tparam T : type of waiting elements
+ \note The checkpoint function is called from empty(), i.e. between two
+ iterations of the algorithms that loop until their waiting container is
+ empty. At this point, the algorithm has completely processed all the elements
+ that are not waiting anymore. This allows to checkpoint an algorithm without
+ modifying the algorithm
+ */
+template <class T> class checkpointing_t : public tchecker::waiting::waiting_t<T> {
+public:
+  /*!
+   \brief Type of checkpoint functions
+   \note a checkpoint function may modify its argument as long as it restores
+   the same waiting elements in the same order
+   */
+  using checkpoint_t = std::function<void(tchecker::waiting::waiting_t<T> &)>;
+
+  /*!
+   \brief Constructor
+   \param w : a waiting container
+   \param interval : time interval between two checkpoints
+   \param checkpoint : checkpoint function
+   \pre w is not nullptr
+   \post this container owns w, and it calls checkpoint on w every interval
+   */
+  checkpointing_t(tchecker::waiting::waiting_t<T> * w, std::chrono::seconds interval, checkpoint_t checkpoint)
+      : _w(w), _interval(interval), _checkpoint(checkpoint), _last(std::chrono::steady_clock::now()), _checkpoints(0)
+  {
+  }
+
+  /*!
+   \brief Copy constructor (deleted)
+   */
+  checkpointing_t(tchecker::waiting::checkpointing_t<T> const &) = delete;
+
+  /*!
+   \brief Destructor
+   */
+  virtual ~checkpointing_t() = default;
+
+  /*!
+   \brief Assignment operator (deleted)
+   */
+  tchecker::waiting::checkpointing_t<T> & operator=(tchecker::waiting::checkpointing_t<T> const &) = delete;
+
+  /*!
+   \brief Accessor
+   \return true if the container is empty, false otherwise
+   \post the checkpoint function has been called if the container is not empty
+   and the time interval has elapsed since last checkpoint
+   */
+  virtual bool empty()
+  {
+    if (_w->empty())
+      return true;
+    auto now = std::chrono::steady_clock::now();
+    if (now - _last >= _interval) {
+      _checkpoint(*_w);
+      ++_checkpoints;
+      _last = std::chrono::steady_clock::now();
+    }
+    return _w->empty();
+  }
+
+  /*!
+   \brief Clear the container
+   \post this container is empty
+   */
+  virtual void clear() { _w->clear(); }
+
+  /*!
+   \brief Insert
+   \param t : element
+   \post t has been inserted in this container
+   */
+  virtual void insert(T const & t) { _w->insert(t); }
+
+  /*!
+   \brief Remove first element
+   \pre not empty()
+   \post the first element has been removed from this container
+   */
+  virtual void remove_first() { _w->remove_first(); }
+
+  /*!
+   \brief Accessor
+   \pre not empty()
+   \return first element of this container
+   */
+  virtual T const & first() { return _w->first(); }
+
+  /*!
+   \brief Remove an element
+   \param t : element
+   \post t is not waiting anymore
+   */
+  virtual void remove(T const & t) { _w->remove(t); }
+
+  /*!
+   \brief Accessor
+   \return number of calls to the checkpoint function
+   */
+  inline unsigned long checkpoints() const { return _checkpoints; }
+
+private:
+  std::unique_ptr<tchecker::waiting::waiting_t<T>> _w; /*!< Waiting container */
+  std::chrono::seconds _interval;                      /*!< Time interval between checkpoints */
+  checkpoint_t _checkpoint;                            /*!< Checkpoint function */
+  std::chrono::steady_clock::time_point _last;         /*!< Time of last checkpoint */
+  unsigned long _checkpoints;                          /*!< Number of checkpoints */
+};
+
+} // end of namespace waiting
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_WAITING_CHECKPOINTING_HH
@@ -0,0 +1,133 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_WAITING_COLLECTING_HH
+#define TCHECKER_WAITING_COLLECTING_HH
+
+#include <chrono>
+#include <memory>
+
+#include "tchecker/utils/incremental_collector.hh"
+#include "tchecker/waiting/waiting.hh"
+
+/*!
+ \file collecting.hh
+ \brief Waiting container that runs an incremental garbage collector
+ */
+
+namespace tchecker {
+
+namespace waiting {
+
+/*!
+ \class collecting_t
+ \brief Waiting container that runs a time-bounded slice of an incremental
+ garbage collector at regular intervals
+ \tparam T : type of waiting elements
+ \note The collector is run from empty(), i.e. between two iterations of the
+ algorithms that loop until their waiting container is empty. At this point,
+ the objects that are not referenced anymore by the algorithm can be safely
+ collected. This allows to collect memory during a run without modifying the
+ algorithm
+ */
+template <class T> class collecting_t : public tchecker::waiting::waiting_t<T> {
+public:
+  /*!
+   \brief Constructor
+   \param w : a waiting container
+   \param collector : an incremental garbage collector
+   \param budget : time budget of a slice of collection
+   \param period : number of iterations between two slices of collection
+   \pre w is not nullptr
+   \post this container owns w, it keeps a reference to collector, and it runs
+   collector for budget every period calls to empty()
+   */
+  collecting_t(tchecker::waiting::waiting_t<T> * w, tchecker::incremental_collector_t & collector,
+               std::chrono::microseconds budget, unsigned long period)
+      : _w(w), _collector(collector), _budget(budget), _period(period), _count(0)
+  {
+  }
+
+  /*!
+   \brief Copy constructor (deleted)
+   */
+  collecting_t(tchecker::waiting::collecting_t<T> const &) = delete;
+
+  /*!
+   \brief Destructor
+   */
+  virtual ~collecting_t() = default;
+
+  /*!
+   \brief Assignment operator (deleted)
+   */
+  tchecker::waiting::collecting_t<T> & operator=(tchecker::waiting::collecting_t<T> const &) = delete;
+
+  /*!
+   \brief Accessor
+   \return true if the container is empty, false otherwise
+   \post a slice of collection has been run if the container is not empty and
+   period calls have been made since last slice
+   */
+  virtual bool empty()
+  {
+    if (_w->empty())
+      return true;
+    if (++_count >= _period) {
+      _collector.collect(_budget);
+      _count = 0;
+    }
+    return false;
+  }
+
+  /*!
+   \brief Clear the container
+   \post this container is empty
+   */
+  virtual void clear() { _w->clear(); }
+
+  /*!
+   \brief Insert
+   \param t : element
+   \post t has been inserted in this container
+   */
+  virtual void insert(T const & t) { _w->insert(t); }
+
+  /*!
+   \brief Remove first element
+   \pre not empty()
+   \post the first element has been removed from this container
+   */
+  virtual void remove_first() { _w->remove_first(); }
+
+  /*!
+   \brief Accessor
+   \pre not empty()
+   \return first element of this container
+   */
+  virtual T const & first() { return _w->first(); }
+
+  /*!
+   \brief Remove an element
+   \param t : element
+   \post t is not waiting anymore
+   */
+  virtual void remove(T const & t) { _w->remove(t); }
+
+private:
+  std::unique_ptr<tchecker::waiting::waiting_t<T>> _w; /*!< Waiting container */
+  tchecker::incremental_collector_t & _collector;      /*!< Incremental garbage collector */
+  std::chrono::microseconds _budget;                   /*!< Time budget of a slice of collection */
+  unsigned long _period;                               /*!< Number of iterations between two slices */
+  unsigned long _count;                                /*!< Number of iterations since last slice */
+};
+
+} // end of namespace waiting
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_WAITING_COLLECTING_HH
@@ -0,0 +1,177 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_WAITING_GUIDED_HH
+#define TCHECKER_WAITING_GUIDED_HH
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+
+#include "tchecker/waiting/pqueue.hh"
+#include "tchecker/waiting/waiting.hh"
+
+/*!
+ \file guided.hh
+ \brief Waiting container ordered by a heuristic
+ */
+
+namespace tchecker {
+
+namespace waiting {
+
+/*!
+ \brief Type of guidance
+ */
+enum guidance_t {
+  GUIDANCE_BEST_FIRST, /*!< Order elements by their heuristic value */
+  GUIDANCE_ASTAR,      /*!< Order elements by their depth plus their heuristic value */
+};
+
+/*!
+ \brief Infinite heuristic value
+ */
+static constexpr std::uint32_t INFINITE_HEURISTIC = std::numeric_limits<std::uint32_t>::max();
+
+/*!
+ \class guided_t
+ \brief Waiting container implementing a priority queue w.r.t. a heuristic
+ \tparam T : type of waiting elements
+ \note The depth of an element is the depth of the last element removed by
+ remove_first() plus 1, or 0 if no element has been removed yet. This is the
+ depth of the element in the graph explored by an algorithm that inserts the
+ successors of the element it has just removed (e.g. reachability)
+ \note Elements with same priority are ordered w.r.t. insertion (fifo)
+ \note Elements with infinite heuristic value come last
+ */
+template <class T> class guided_t : public tchecker::waiting::waiting_t<T> {
+public:
+  /*!
+   \brief Type of heuristic functions
+   */
+  using heuristic_t = std::function<std::uint32_t(T const &)>;
+
+  /*!
+   \brief Constructor
+   \param guidance : type of guidance
+   \param heuristic : heuristic function, returns
+   tchecker::waiting::INFINITE_HEURISTIC for elements that cannot lead to a
+   goal
+   \post this container is empty
+   */
+  guided_t(enum tchecker::waiting::guidance_t guidance, heuristic_t heuristic)
+      : _guidance(guidance), _heuristic(heuristic), _sequence(0), _depth(0), _removed(false)
+  {
+  }
+
+  /*!
+   \brief Copy constructor (deleted)
+   */
+  guided_t(tchecker::waiting::guided_t<T> const &) = delete;
+
+  /*!
+   \brief Destructor
+   */
+  virtual ~guided_t() = default;
+
+  /*!
+   \brief Assignment operator (deleted)
+   */
+  tchecker::waiting::guided_t<T> & operator=(tchecker::waiting::guided_t<T> const &) = delete;
+
+  /*!
+   \brief Accessor
+   \return true if the container is empty, false otherwise
+   */
+  virtual inline bool empty() { return _pq.empty(); }
+
+  /*!
+   \brief Clear the container
+   \post this container is empty
+   */
+  virtual inline void clear() { _pq.clear(); }
+
+  /*!
+   \brief Insert
+   \param t : element
+   \post t has been inserted w.r.t. its priority
+   */
+  virtual void insert(T const & t)
+  {
+    std::uint32_t const depth = (_removed ? _depth + 1 : 0);
+    std::uint32_t const h = _heuristic(t);
+    std::uint64_t priority = std::numeric_limits<std::uint64_t>::max();
+    if (h != tchecker::waiting::INFINITE_HEURISTIC)
+      priority = (_guidance == tchecker::waiting::GUIDANCE_ASTAR ? static_cast<std::uint64_t>(depth) + h : h);
+    _pq.insert(entry_t{priority, _sequence++, depth, t});
+  }
+
+  /*!
+   \brief Remove first element
+   \pre not empty()
+   \post first element has been removed from the container
+   */
+  virtual void remove_first()
+  {
+    _depth = _pq.first().depth;
+    _removed = true;
+    _pq.remove_first();
+  }
+
+  /*!
+   \brief Accessor
+   \pre not empty()
+   \return element with highest priority in the container
+   */
+  virtual inline T const & first() { return _pq.first().t; }
+
+  /*!
+   \brief Remove an element
+   \param t : element
+   \post all occurrences of t have been removed from the container
+   \note complexity is linear in the size of the container
+   */
+  virtual void remove(T const & t) { _pq.remove(entry_t{0, 0, 0, t}); }
+
+private:
+  /*!
+   \class entry_t
+   \brief Entries of the priority queue
+   */
+  struct entry_t {
+    std::uint64_t priority; /*!< Priority (lower first) */
+    std::uint64_t sequence; /*!< Insertion sequence number */
+    std::uint32_t depth;    /*!< Depth */
+    T t;                    /*!< Element */
+
+    /*!
+     \brief Less-than order w.r.t. priority, then insertion
+     */
+    bool operator<(entry_t const & e) const
+    {
+      return (priority != e.priority ? priority < e.priority : sequence < e.sequence);
+    }
+
+    /*!
+     \brief Equality of elements
+     */
+    bool operator==(entry_t const & e) const { return t == e.t; }
+  };
+
+  enum tchecker::waiting::guidance_t _guidance;     /*!< Guidance */
+  heuristic_t _heuristic;                           /*!< Heuristic */
+  tchecker::waiting::priority_queue_t<entry_t> _pq; /*!< Priority queue */
+  std::uint64_t _sequence;                          /*!< Next insertion sequence number */
+  std::uint32_t _depth;                             /*!< Depth of last removed element */
+  bool _removed;                                    /*!< Some element has been removed */
+};
+
+} // end of namespace waiting
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_WAITING_GUIDED_HH
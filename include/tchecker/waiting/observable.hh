@@ -0,0 +1,162 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_WAITING_OBSERVABLE_HH
+#define TCHECKER_WAITING_OBSERVABLE_HH
+
+#include <functional>
+#include <memory>
+#include <optional>
+
+#include "tchecker/waiting/waiting.hh"
+
+/*!
+ \file observable.hh
+ \brief Waiting container that notifies when elements have been processed
+ */
+
+namespace tchecker {
+
+namespace waiting {
+
+/*!
+ \class observable_t
+ \brief Waiting container that calls an observer function on each element that
+ has been processed, and on each element that has been dropped
+ \tparam T : type of waiting elements
+ \note An element is processed when it has been removed by remove_first() and
+ the algorithm calls empty() or clear() next, i.e. after the algorithm has
+ completed its iteration on the element. An element is dropped when it has
+ been removed by remove(), or when it is still waiting when the container is
+ cleared. This allows to observe an algorithm without modifying the algorithm
+ */
+template <class T> class observable_t : public tchecker::waiting::waiting_t<T> {
+public:
+  /*!
+   \brief Type of observer functions
+   */
+  using observer_t = std::function<void(T const &)>;
+
+  /*!
+   \brief Constructor
+   \param w : a waiting container
+   \param processed : observer of processed elements
+   \param dropped : observer of dropped elements
+   \pre w is not nullptr
+   \post this container owns w
+   */
+  observable_t(tchecker::waiting::waiting_t<T> * w, observer_t processed, observer_t dropped)
+      : _w(w), _processed(processed), _dropped(dropped)
+  {
+  }
+
+  /*!
+   \brief Copy constructor (deleted)
+   */
+  observable_t(tchecker::waiting::observable_t<T> const &) = delete;
+
+  /*!
+   \brief Destructor
+   */
+  virtual ~observable_t() = default;
+
+  /*!
+   \brief Assignment operator (deleted)
+   */
+  tchecker::waiting::observable_t<T> & operator=(tchecker::waiting::observable_t<T> const &) = delete;
+
+  /*!
+   \brief Accessor
+   \return true if the container is empty, false otherwise
+   \post the last element removed by remove_first() has been notified as
+   processed
+   */
+  virtual bool empty()
+  {
+    notify_processed();
+    return _w->empty();
+  }
+
+  /*!
+   \brief Clear the container
+   \post the last element removed by remove_first() has been notified as
+   processed, all waiting elements have been notified as dropped, and this
+   container is empty
+   */
+  virtual void clear()
+  {
+    notify_processed();
+    while (!_w->empty()) {
+      T t = _w->first();
+      _w->remove_first();
+      _dropped(t);
+    }
+  }
+
+  /*!
+   \brief Insert
+   \param t : element
+   \post t has been inserted in this container
+   */
+  virtual void insert(T const & t) { _w->insert(t); }
+
+  /*!
+   \brief Remove first element
+   \pre not empty()
+   \post the first element has been removed from this container
+   */
+  virtual void remove_first()
+  {
+    notify_processed();
+    _last = _w->first();
+    _w->remove_first();
+  }
+
+  /*!
+   \brief Accessor
+   \pre not empty()
+   \return first element of this container
+   */
+  virtual T const & first() { return _w->first(); }
+
+  /*!
+   \brief Remove an element
+   \param t : element
+   \post t is not waiting anymore, and it has been notified as dropped
+   */
+  virtual void remove(T const & t)
+  {
+    _w->remove(t);
+    _dropped(t);
+  }
+
+private:
+  /*!
+   \brief Notify last removed element as processed
+   \post the last element removed by remove_first() has been notified as
+   processed, if not yet notified
+   */
+  void notify_processed()
+  {
+    if (!_last.has_value())
+      return;
+    T t = *_last;
+    _last.reset();
+    _processed(t);
+  }
+
+  std::unique_ptr<tchecker::waiting::waiting_t<T>> _w; /*!< Waiting container */
+  observer_t _processed;                               /*!< Observer of processed elements */
+  observer_t _dropped;                                 /*!< Observer of dropped elements */
+  std::optional<T> _last;                              /*!< Last element removed by remove_first() */
+};
+
+} // end of namespace waiting
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_WAITING_OBSERVABLE_HH
@@ -0,0 +1,152 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#ifndef TCHECKER_WAITING_REPORTING_HH
+#define TCHECKER_WAITING_REPORTING_HH
+
+#include <functional>
+#include <memory>
+
+#include "tchecker/waiting/waiting.hh"
+
+/*!
+ \file reporting.hh
+ \brief Waiting container that publishes the progress of an algorithm
+ */
+
+namespace tchecker {
+
+namespace waiting {
+
+/*!
+ \class reporting_t
+ \brief Waiting container that calls a snapshot function at regular intervals,
+ e.g. to publish progress counters (see tchecker::progress_t)
+ \tparam T : type of waiting elements
+ \note The snapshot function is called from empty(), i.e. between two
+ iterations of the algorithms that loop until their waiting container is empty,
+ on the thread that runs the algorithm. It can thus read the statistics and
+ the graph of the algorithm safely
+ */
+template <class T> class reporting_t : public tchecker::waiting::waiting_t<T> {
+public:
+  /*!
+   \brief Type of snapshot functions, called with the number of waiting elements
+   \note the number of waiting elements is the number of insertions minus the
+   number of removals of the first element. It accounts for the elements that
+   have been removed by remove() but that are still stored in the container
+   (see tchecker::waiting::fast_remove_waiting_t)
+   */
+  using snapshot_t = std::function<void(unsigned long)>;
+
+  /*!
+   \brief Constructor
+   \param w : a waiting container
+   \param snapshot : snapshot function
+   \param period : number of iterations between two snapshots
+   \pre w is not nullptr
+   \post this container owns w, and it calls snapshot every period calls to
+   empty(), and when it is found empty
+   */
+  reporting_t(tchecker::waiting::waiting_t<T> * w, snapshot_t snapshot, unsigned long period)
+      : _w(w), _snapshot(snapshot), _period(period), _count(0), _size(0)
+  {
+  }
+
+  /*!
+   \brief Copy constructor (deleted)
+   */
+  reporting_t(tchecker::waiting::reporting_t<T> const &) = delete;
+
+  /*!
+   \brief Destructor
+   */
+  virtual ~reporting_t() = default;
+
+  /*!
+   \brief Assignment operator (deleted)
+   */
+  tchecker::waiting::reporting_t<T> & operator=(tchecker::waiting::reporting_t<T> const &) = delete;
+
+  /*!
+   \brief Accessor
+   \return true if the container is empty, false otherwise
+   \post snapshot has been called if the container is empty, or if period calls
+   have been made since last snapshot
+   */
+  virtual bool empty()
+  {
+    if (_w->empty()) {
+      _snapshot(0);
+      return true;
+    }
+    if (++_count >= _period) {
+      _snapshot(_size);
+      _count = 0;
+    }
+    return false;
+  }
+
+  /*!
+   \brief Clear the container
+   \post this container is empty
+   */
+  virtual void clear()
+  {
+    _w->clear();
+    _size = 0;
+  }
+
+  /*!
+   \brief Insert
+   \param t : element
+   \post t has been inserted in this container
+   */
+  virtual void insert(T const & t)
+  {
+    _w->insert(t);
+    ++_size;
+  }
+
+  /*!
+   \brief Remove first element
+   \pre not empty()
+   \post the first element has been removed from this container
+   */
+  virtual void remove_first()
+  {
+    _w->remove_first();
+    --_size;
+  }
+
+  /*!
+   \brief Accessor
+   \pre not empty()
+   \return first element of this container
+   */
+  virtual T const & first() { return _w->first(); }
+
+  /*!
+   \brief Remove an element
+   \param t : element
+   \post t is not waiting anymore
+   */
+  virtual void remove(T const & t) { _w->remove(t); }
+
+private:
+  std::unique_ptr<tchecker::waiting::waiting_t<T>> _w; /*!< Waiting container */
+  snapshot_t _snapshot;                                /*!< Snapshot function */
+  unsigned long _period;                               /*!< Number of iterations between two snapshots */
+  unsigned long _count;                                /*!< Number of iterations since last snapshot */
+  unsigned long _size;                                 /*!< Number of waiting elements */
+};
+
+} // end of namespace waiting
+
+} // end of namespace tchecker
+
+#endif // TCHECKER_WAITING_REPORTING_HH
@@ -9,6 +9,10 @@
 #define TCHECKER_ZG_HH
 
 #include <cstdlib>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
 
 #include "tchecker/basictypes.hh"
 #include "tchecker/clockbounds/clockbounds.hh"
@@ -153,6 +157,23 @@ inline tchecker::zg::final_range_t final_edges(tchecker::ta::system_t const & sy
   return tchecker::ta::final_edges(system, labels);
 }
 
+/*!
+ \brief Accessor to final edges restricted to some locations
+ \param system : a system
+ \param labels : a set of labels
+ \param locations : range of locations of each process
+ \return range of final edges, i.e. edges to tuple of locations that match labels,
+ where the location of each process pid is in locations[pid]
+ \throw std::invalid_argument : if locations does not have one range per process
+ in system
+ */
+inline tchecker::zg::final_range_t
+final_edges(tchecker::ta::system_t const & system, boost::dynamic_bitset<> const & labels,
+            std::vector<tchecker::range_t<tchecker::system::locs_t::const_iterator_t>> const & locations)
+{
+  return tchecker::ta::final_edges(system, labels, locations);
+}
+
 /*!
  \brief Dereference type for iterator over final edges
  */
@@ -748,10 +769,22 @@ public:
   status of s' matches mask (i.e. status & mask != 0) have been pushed to v
   \note states and transitions that are added to v are deallocated automatically
   \note states and transitions share their internal components if sharing_type is tchecker::ts::SHARING
+  \note tuples are pushed in the order of outgoing edges, or in a random order
+  if edge order randomization has been enabled (see randomize_edge_order)
   */
   virtual void next(tchecker::zg::const_state_sptr_t const & s, std::vector<sst_t> & v,
                     tchecker::state_status_t mask = tchecker::STATE_OK);
 
+  /*!
+   \brief Enable randomization of the order of outgoing edges
+   \param seed : seed of the random number generator
+   \post successors computed by next(s, v, mask) are pushed to v in a random
+   order determined by seed. Two zone graphs with the same seed produce the same
+   sequence of orders
+   \note this is used to diversify parallel searches over independent zone graphs
+   */
+  void randomize_edge_order(unsigned int seed);
+
   // Backward
 
   /*!
@@ -974,6 +1007,69 @@ public:
    */
   inline std::shared_ptr<tchecker::zg::semantics_t> const & semantics() const { return _semantics; }
 
+  /*!
+   \brief Spill states to disk
+   \param directory : directory of segment files
+   \pre no state has been computed yet
+   \post the zones and the valuations of bounded integer variables in the states
+   of this zone graph are allocated in memory-mapped segment files in
+   directory, and the operating system evicts them from memory when memory
+   runs low (see tchecker::mmap_segments_t)
+   \throw std::logic_error : if the precondition is not satisfied
+   \throw std::invalid_argument : if directory is not a directory
+   \note this allows to explore state-spaces that do not fit in memory, at the
+   price of I/O. Hash values and tuples of locations stay in memory
+   */
+  inline void spill(std::string const & directory) { _state_allocator.spill(directory); }
+
+  /*!
+   \brief Back states by huge pages
+   \param huge_pages : huge pages mode
+   \pre no state has been computed yet
+   \post the states of this zone graph, with their zones, tuples of locations
+   and valuations of bounded integer variables, are allocated from memory backed
+   by huge pages according to huge_pages (see tchecker::anonymous_segments_t),
+   and so are the buckets of the caches that share them
+   \throw std::logic_error : if the precondition is not satisfied
+   \note this reduces TLB misses on large state-spaces
+   */
+  inline void huge_pages(enum tchecker::huge_pages_t huge_pages) { _state_allocator.huge_pages(huge_pages); }
+
+  /*!
+   \brief Enroll in an incremental garbage collector
+   \param collector : an incremental garbage collector
+   \post the states and transitions of this zone graph that are not referenced
+   anymore, as well as their components that are only referenced by the
+   sharing caches, are collected by collector
+   \note this keeps memory proportional to the referenced states when
+   collector is run regularly (see tchecker::waiting::collecting_t)
+   */
+  inline void enroll(tchecker::incremental_collector_t & collector)
+  {
+    _state_allocator.enroll(collector);
+    _transition_allocator.enroll(collector);
+  }
+
+  /*!
+   \brief Accessor
+   \return Memory used by the states and transitions of this zone graph,
+   including their components and the caches that share them
+   */
+  inline std::size_t memsize() const { return _state_allocator.memsize() + _transition_allocator.memsize(); }
+
+  /*!
+   \brief Accumulate memory statistics
+   \param stats : memory statistics
+   \post the memory of the states and transitions of this zone graph, of their
+   components, and of the caches that share them, has been added to stats
+   \note linear in the number of allocated objects
+   */
+  void memory_stats(tchecker::memory_stats_t & stats) const
+  {
+    _state_allocator.memory_stats(stats);
+    _transition_allocator.memory_stats(stats);
+  }
+
   /*!
    \brief Accessor
    \return number of clocks
@@ -1022,6 +1118,7 @@ protected:
   std::shared_ptr<tchecker::zg::extrapolation_t> _non_enabled_extrapolation;    /*!< if enabled_extrapolation, its the same as _extrapolation. Otherwise it is the actual used extrapolation*/
   tchecker::zg::state_pool_allocator_t _state_allocator;                        /*!< Pool allocator of states */
   tchecker::zg::transition_pool_allocator_t _transition_allocator;              /*! Pool allocator of transitions */
+  std::unique_ptr<std::minstd_rand> _edge_order_gen;                            /*!< Random generator for edge order (nullptr: no randomization) */
 };
 
 /*!
@@ -0,0 +1,46 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <sstream>
+
+#include "tchecker/algorithms/bwd_reach/stats.hh"
+
+namespace tchecker {
+
+namespace algorithms {
+
+namespace bwd_reach {
+
+stats_t::stats_t() : _forward_visited_states(0), _forward_visited_transitions(0) {}
+
+unsigned long & stats_t::forward_visited_states() { return _forward_visited_states; }
+
+unsigned long stats_t::forward_visited_states() const { return _forward_visited_states; }
+
+unsigned long & stats_t::forward_visited_transitions() { return _forward_visited_transitions; }
+
+unsigned long stats_t::forward_visited_transitions() const { return _forward_visited_transitions; }
+
+void stats_t::attributes(std::map<std::string, std::string> & m) const
+{
+  tchecker::algorithms::reach::stats_t::attributes(m);
+
+  std::stringstream sstream;
+
+  sstream << _forward_visited_states;
+  m["FORWARD_VISITED_STATES"] = sstream.str();
+
+  sstream.str("");
+  sstream << _forward_visited_transitions;
+  m["FORWARD_VISITED_TRANSITIONS"] = sstream.str();
+}
+
+} // end of namespace bwd_reach
+
+} // end of namespace algorithms
+
+} // end of namespace tchecker
@@ -0,0 +1,193 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <cassert>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/container_hash/hash.hpp>
+
+#include "tchecker/algorithms/bwd_reach/target.hh"
+#include "tchecker/ta/slicing.hh"
+
+namespace tchecker {
+
+namespace algorithms {
+
+namespace bwd_reach {
+
+std::string const WILDCARD_LOCATION_NAME = "*";
+
+/*!
+ \brief Compute wildcard processes
+ \param system : a system of timed processes
+ \param labels : set of labels
+ \return set of processes in system that are not constraining, that have no
+ location with a label in labels, and that are not involved in a weak
+ synchronization
+ */
+static boost::dynamic_bitset<> wildcard_processes(tchecker::ta::system_t const & system,
+                                                  boost::dynamic_bitset<> const & labels)
+{
+  boost::dynamic_bitset<> wildcards(system.processes_count());
+
+  for (tchecker::process_id_t pid : system.processes_identifiers())
+    if (!tchecker::ta::is_constraining_process(system, pid))
+      wildcards[pid] = 1;
+
+  for (tchecker::system::loc_const_shared_ptr_t const & loc : system.locations())
+    if (system.labels(loc->id()).intersects(labels))
+      wildcards[loc->pid()] = 0;
+
+  for (tchecker::sync_id_t sync_id : system.synchronizations_identifiers())
+    for (tchecker::system::sync_constraint_t const & c : system.synchronization(sync_id).synchronization_constraints())
+      if (c.strength() == tchecker::SYNC_WEAK)
+        wildcards[c.pid()] = 0;
+
+  return wildcards;
+}
+
+/*!
+ \brief Add wildcard locations to a system declaration
+ \param sysdecl : a system declaration
+ \param system : system of timed processes built from sysdecl
+ \param wildcards : set of wildcard processes
+ \return a declaration of the system obtained from sysdecl by adding, to each
+ process in wildcards, an initial location named WILDCARD_LOCATION_NAME, and
+ for each edge of the process, a copy of the edge to this location
+ \note the declarations of sysdecl come first in the returned system, in the
+ same order, hence locations and edges keep their identifiers
+ \throw std::runtime_error : if a declaration cannot be inserted
+ */
+static std::shared_ptr<tchecker::parsing::system_declaration_t>
+add_wildcard_locations(tchecker::parsing::system_declaration_t const & sysdecl, tchecker::ta::system_t const & system,
+                       boost::dynamic_bitset<> const & wildcards)
+{
+  std::shared_ptr<tchecker::parsing::system_declaration_t> target =
+      std::make_shared<tchecker::parsing::system_declaration_t>(sysdecl.name(), sysdecl.attributes(), sysdecl.context());
+
+  auto is_wildcard = [&](std::string const & name) { return wildcards[system.process_id(name)] == 1; };
+
+  bool inserted = true;
+  for (std::shared_ptr<tchecker::parsing::inner_declaration_t> const & d : sysdecl.declarations()) {
+    if (auto clock_decl = std::dynamic_pointer_cast<tchecker::parsing::clock_declaration_t>(d))
+      inserted = target->insert_clock_declaration(clock_decl);
+    else if (auto int_decl = std::dynamic_pointer_cast<tchecker::parsing::int_declaration_t>(d))
+      inserted = target->insert_int_declaration(int_decl);
+    else if (auto proc_decl = std::dynamic_pointer_cast<tchecker::parsing::process_declaration_t>(d))
+      inserted = target->insert_process_declaration(proc_decl);
+    else if (auto event_decl = std::dynamic_pointer_cast<tchecker::parsing::event_declaration_t>(d))
+      inserted = target->insert_event_declaration(event_decl);
+    else if (auto loc_decl = std::dynamic_pointer_cast<tchecker::parsing::location_declaration_t>(d))
+      inserted = target->insert_location_declaration(loc_decl);
+    else if (auto edge_decl = std::dynamic_pointer_cast<tchecker::parsing::edge_declaration_t>(d))
+      inserted = target->insert_edge_declaration(edge_decl);
+    else if (auto sync_decl = std::dynamic_pointer_cast<tchecker::parsing::sync_declaration_t>(d))
+      inserted = target->insert_sync_declaration(sync_decl);
+    else
+      throw std::runtime_error("tchecker::algorithms::bwd_reach::target_t: unknown declaration");
+
+    if (!inserted)
+      throw std::runtime_error("tchecker::algorithms::bwd_reach::target_t: cannot insert declaration");
+  }
+
+  // Wildcard locations
+  for (std::size_t pid = wildcards.find_first(); pid != boost::dynamic_bitset<>::npos; pid = wildcards.find_next(pid)) {
+    std::shared_ptr<tchecker::parsing::process_declaration_t const> proc_decl =
+        sysdecl.get_process_declaration(system.process_name(static_cast<tchecker::process_id_t>(pid)));
+    tchecker::parsing::attributes_t attributes;
+    attributes.insert(
+        std::make_shared<tchecker::parsing::attr_t>("initial", "", tchecker::parsing::attr_parsing_position_t{}));
+    if (!target->insert_location_declaration(std::make_shared<tchecker::parsing::location_declaration_t>(
+            WILDCARD_LOCATION_NAME, proc_decl, attributes, proc_decl->context())))
+      throw std::runtime_error("tchecker::algorithms::bwd_reach::target_t: cannot insert wildcard location");
+  }
+
+  // Copies of the edges of wildcard processes to wildcard locations
+  for (std::shared_ptr<tchecker::parsing::inner_declaration_t> const & d : sysdecl.declarations()) {
+    auto edge_decl = std::dynamic_pointer_cast<tchecker::parsing::edge_declaration_t>(d);
+    if (edge_decl == nullptr || !is_wildcard(edge_decl->process().name()))
+      continue;
+    std::string const & process_name = edge_decl->process().name();
+    if (!target->insert_edge_declaration(std::make_shared<tchecker::parsing::edge_declaration_t>(
+            sysdecl.get_process_declaration(process_name),
+            target->get_location_declaration(process_name, edge_decl->src().name()),
+            target->get_location_declaration(process_name, WILDCARD_LOCATION_NAME),
+            sysdecl.get_event_declaration(edge_decl->event().name()), edge_decl->attributes(), edge_decl->context())))
+      throw std::runtime_error("tchecker::algorithms::bwd_reach::target_t: cannot insert edge to wildcard location");
+  }
+
+  return target;
+}
+
+/* target_t */
+
+target_t::target_t(tchecker::parsing::system_declaration_t const & sysdecl, std::string const & labels)
+{
+  tchecker::ta::system_t system{sysdecl};
+  boost::dynamic_bitset<> system_labels = system.as_syncprod_system().labels(labels);
+
+  _wildcard_processes = tchecker::algorithms::bwd_reach::wildcard_processes(system, system_labels);
+  _system = std::make_shared<tchecker::ta::system_t const>(
+      *tchecker::algorithms::bwd_reach::add_wildcard_locations(sysdecl, system, _wildcard_processes));
+  _labels = _system->as_syncprod_system().labels(labels);
+
+  _wildcard_locations.resize(_system->locations_count());
+  for (std::size_t pid = _wildcard_processes.find_first(); pid != boost::dynamic_bitset<>::npos;
+       pid = _wildcard_processes.find_next(pid))
+    _wildcard_locations[_system->location(static_cast<tchecker::process_id_t>(pid), WILDCARD_LOCATION_NAME)->id()] = 1;
+}
+
+tchecker::ta::final_range_t target_t::final_edges() const
+{
+  std::vector<tchecker::range_t<tchecker::system::locs_t::const_iterator_t>> locations;
+  for (tchecker::process_id_t pid : _system->processes_identifiers()) {
+    auto r = _system->locations(pid);
+    if (_labels.none())
+      locations.push_back(tchecker::make_range(r.end(), r.end()));
+    else if (_wildcard_processes[pid]) {
+      // the wildcard location is the last location of the process
+      assert(_wildcard_locations[(*std::prev(r.end()))->id()]);
+      locations.push_back(tchecker::make_range(std::prev(r.end()), r.end()));
+    }
+    else
+      locations.push_back(r);
+  }
+  return tchecker::ta::final_edges(*_system, _labels, locations);
+}
+
+bool target_t::match(tchecker::ta::state_t const & s, tchecker::ta::state_t const & t) const
+{
+  if (!(s.intval() == t.intval()))
+    return false;
+  tchecker::vloc_t const & svloc = s.vloc();
+  tchecker::vloc_t const & tvloc = t.vloc();
+  if (svloc.size() != tvloc.size())
+    return false;
+  for (tchecker::process_id_t pid = 0; pid < svloc.size(); ++pid)
+    if (svloc[pid] != tvloc[pid] && !_wildcard_locations[tvloc[pid]])
+      return false;
+  return true;
+}
+
+std::size_t target_t::hash_value(tchecker::ta::state_t const & s) const
+{
+  std::size_t h = 0;
+  boost::hash_combine(h, s.intval());
+  tchecker::vloc_t const & vloc = s.vloc();
+  for (tchecker::process_id_t pid = 0; pid < vloc.size(); ++pid)
+    if (!_wildcard_processes[pid])
+      boost::hash_combine(h, vloc[pid]);
+  return h;
+}
+
+} // end of namespace bwd_reach
+
+} // end of namespace algorithms
+
+} // end of namespace tchecker
@@ -0,0 +1,265 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <unordered_map>
+#include <vector>
+
+#include <boost/dynamic_bitset.hpp>
+
+#include "tchecker/algorithms/search_order.hh"
+#include "tchecker/dbm/dbm.hh"
+#include "tchecker/system/static_analysis.hh"
+#include "tchecker/ta/state.hh"
+#include "tchecker/ta/system.hh"
+#include "tchecker/utils/log.hh"
+#include "tchecker/algorithms/bwd_reach/zg-bwd-reach.hh"
+
+namespace tchecker {
+
+namespace algorithms {
+
+namespace zg_bwd_reach {
+
+/* meet */
+
+bool meet(tchecker::zg::state_t const & fwd, tchecker::zg::state_t const & bwd,
+          tchecker::algorithms::bwd_reach::target_t const & target)
+{
+  if (!target.match(fwd, bwd))
+    return false;
+  tchecker::clock_id_t const dim = fwd.zone().dim();
+  std::vector<tchecker::dbm::db_t> dbm(dim * dim);
+  return tchecker::dbm::intersection(dbm.data(), fwd.zone().dbm(), bwd.zone().dbm(), dim) != tchecker::dbm::EMPTY;
+}
+
+/* run */
+
+/*!
+ \brief Zone graph for backward exploration of a system
+ \param system : a system
+ \param block_size : number of elements allocated in one block
+ \param table_size : size of hash tables
+ \return a zone graph of system without zone extrapolation
+ */
+static std::shared_ptr<tchecker::zg::zg_t> bwd_zg(std::shared_ptr<tchecker::ta::system_t const> const & system,
+                                                  std::size_t block_size, std::size_t table_size)
+{
+  return std::shared_ptr<tchecker::zg::zg_t>{tchecker::zg::factory(system, tchecker::ts::SHARING,
+                                                                   tchecker::zg::ELAPSED_SEMANTICS,
+                                                                   tchecker::zg::NO_EXTRAPOLATION, block_size, table_size)};
+}
+
+std::tuple<tchecker::algorithms::bwd_reach::stats_t, std::shared_ptr<tchecker::algorithms::zg_reach::state_space_t>>
+run(tchecker::parsing::system_declaration_t const & sysdecl, std::string const & labels, std::string const & search_order,
+    std::size_t block_size, std::size_t table_size)
+{
+  tchecker::algorithms::bwd_reach::target_t target{sysdecl, labels};
+  if (!tchecker::system::every_process_has_initial_location(target.system()->as_system_system()))
+    std::cerr << tchecker::log_warning << "system has no initial state" << std::endl;
+
+  std::shared_ptr<tchecker::algorithms::zg_reach::state_space_t> state_space =
+      std::make_shared<tchecker::algorithms::zg_reach::state_space_t>(bwd_zg(target.system(), block_size, table_size),
+                                                                      block_size, table_size);
+
+  enum tchecker::waiting::policy_t policy = tchecker::algorithms::waiting_policy(search_order);
+
+  tchecker::algorithms::zg_bwd_reach::algorithm_t algorithm;
+
+  tchecker::algorithms::bwd_reach::stats_t stats =
+      algorithm.run(state_space->zg(), state_space->graph(), target.final_edges(), policy);
+
+  return std::make_tuple(stats, state_space);
+}
+
+/*!
+ \class meeting_index_t
+ \brief Index of forward and backward nodes by valuation of bounded integer
+ variables and locations of the processes that are not wildcard processes
+ */
+class meeting_index_t {
+public:
+  using node_sptr_t = tchecker::algorithms::zg_reach::graph_t::node_sptr_t;
+
+  /*!
+   \brief Constructor
+   \param target : target of the backward exploration
+   \note this keeps a reference on target
+   */
+  meeting_index_t(tchecker::algorithms::bwd_reach::target_t const & target) : _target(target) {}
+
+  /*!
+   \brief Add a forward node
+   \param n : a forward node
+   \return true if n meets a backward node in this index, false otherwise
+   \post n has been added to this index
+   */
+  bool add_forward(node_sptr_t const & n)
+  {
+    entry_t & entry = _index[_target.hash_value(n->state())];
+    entry.forward.push_back(n);
+    for (node_sptr_t const & m : entry.backward)
+      if (tchecker::algorithms::zg_bwd_reach::meet(n->state(), m->state(), _target))
+        return true;
+    return false;
+  }
+
+  /*!
+   \brief Add a backward node
+   \param n : a backward node
+   \return true if n meets a forward node in this index, false otherwise
+   \post n has been added to this index
+   */
+  bool add_backward(node_sptr_t const & n)
+  {
+    entry_t & entry = _index[_target.hash_value(n->state())];
+    entry.backward.push_back(n);
+    for (node_sptr_t const & m : entry.forward)
+      if (tchecker::algorithms::zg_bwd_reach::meet(m->state(), n->state(), _target))
+        return true;
+    return false;
+  }
+
+private:
+  /*!
+   \brief Nodes with same hash value
+   */
+  struct entry_t {
+    std::vector<node_sptr_t> forward;  /*!< Forward nodes */
+    std::vector<node_sptr_t> backward; /*!< Backward nodes */
+  };
+
+  tchecker::algorithms::bwd_reach::target_t const & _target; /*!< Target of the backward exploration */
+  std::unordered_map<std::size_t, entry_t> _index;            /*!< Index */
+};
+
+std::tuple<tchecker::algorithms::bwd_reach::stats_t, std::shared_ptr<tchecker::algorithms::zg_reach::state_space_t>,
+           std::shared_ptr<tchecker::algorithms::zg_reach::state_space_t>>
+run_bidirectional(tchecker::parsing::system_declaration_t const & sysdecl, std::string const & labels,
+                  std::string const & search_order, std::size_t block_size, std::size_t table_size)
+{
+  using node_sptr_t = tchecker::algorithms::zg_reach::graph_t::node_sptr_t;
+
+  std::shared_ptr<tchecker::ta::system_t const> system{new tchecker::ta::system_t{sysdecl}};
+  if (!tchecker::system::every_process_has_initial_location(system->as_system_system()))
+    std::cerr << tchecker::log_warning << "system has no initial state" << std::endl;
+
+  tchecker::algorithms::bwd_reach::target_t target{sysdecl, labels};
+
+  std::shared_ptr<tchecker::zg::zg_t> fwd_zg{tchecker::zg::factory(system, tchecker::ts::SHARING,
+                                                                   tchecker::zg::ELAPSED_SEMANTICS,
+                                                                   tchecker::zg::EXTRA_M_GLOBAL, block_size, table_size)};
+  std::shared_ptr<tchecker::algorithms::zg_reach::state_space_t> fwd_state_space =
+      std::make_shared<tchecker::algorithms::zg_reach::state_space_t>(fwd_zg, block_size, table_size);
+  std::shared_ptr<tchecker::algorithms::zg_reach::state_space_t> bwd_state_space =
+      std::make_shared<tchecker::algorithms::zg_reach::state_space_t>(bwd_zg(target.system(), block_size, table_size),
+                                                                      block_size, table_size);
+  tchecker::zg::zg_t & fzg = fwd_state_space->zg();
+  tchecker::zg::zg_t & bzg = bwd_state_space->zg();
+  tchecker::algorithms::zg_reach::graph_t & fgraph = fwd_state_space->graph();
+  tchecker::algorithms::zg_reach::graph_t & bgraph = bwd_state_space->graph();
+
+  boost::dynamic_bitset<> accepting_labels = system->as_syncprod_system().labels(labels);
+
+  enum tchecker::waiting::policy_t policy = tchecker::algorithms::waiting_policy(search_order);
+  std::unique_ptr<tchecker::waiting::waiting_t<node_sptr_t>> fwd_waiting{tchecker::waiting::factory<node_sptr_t>(policy)};
+  std::unique_ptr<tchecker::waiting::waiting_t<node_sptr_t>> bwd_waiting{tchecker::waiting::factory<node_sptr_t>(policy)};
+
+  tchecker::algorithms::zg_reach::algorithm_t fwd_algorithm;
+  tchecker::algorithms::zg_bwd_reach::algorithm_t bwd_algorithm;
+  tchecker::algorithms::bwd_reach::stats_t stats;
+  meeting_index_t index{target};
+  std::vector<tchecker::zg::zg_t::sst_t> sst;
+
+  stats.set_start_time();
+
+  if (!accepting_labels.none()) {
+    tchecker::zg::zg_t::final_range_t final_edges = target.final_edges();
+    auto final_it = final_edges.begin();
+    auto final_end = final_edges.end();
+
+    fwd_algorithm.insert_initial_nodes(fzg, fgraph, *fwd_waiting);
+
+    while (true) {
+      // forward step, stop if the forward exploration is complete
+      if (fwd_waiting->empty())
+        break;
+
+      node_sptr_t fnode = fwd_waiting->first();
+      fwd_waiting->remove_first();
+
+      ++stats.forward_visited_states();
+
+      if (accepting_labels.is_subset_of(fzg.labels(fnode->state_ptr())) && fzg.is_valid_final(fnode->state_ptr())) {
+        fnode->final(true);
+        stats.reachable() = true;
+        break;
+      }
+
+      if (index.add_forward(fnode)) {
+        stats.reachable() = true;
+        break;
+      }
+
+      fzg.next(fnode->state_ptr(), sst);
+      for (auto && [status, s, t] : sst) {
+        auto && [is_new_node, next_node] = fgraph.add_node(s);
+        if (is_new_node)
+          fwd_waiting->insert(next_node);
+        fgraph.add_edge(fnode, next_node, *t);
+        ++stats.forward_visited_transitions();
+      }
+      sst.clear();
+
+      // backward step, stop if the backward exploration is complete
+      while (bwd_waiting->empty() && (final_it != final_end)) {
+        bwd_algorithm.insert_final_nodes(bzg, bgraph, *final_it, *bwd_waiting);
+        ++final_it;
+      }
+      if (bwd_waiting->empty())
+        break;
+
+      node_sptr_t bnode = bwd_waiting->first();
+      bwd_waiting->remove_first();
+
+      ++stats.visited_states();
+
+      if (bzg.is_initial(bnode->state_ptr())) {
+        bnode->initial(true);
+        stats.reachable() = true;
+        break;
+      }
+
+      if (index.add_backward(bnode)) {
+        stats.reachable() = true;
+        break;
+      }
+
+      bzg.prev(bnode->state_ptr(), sst, tchecker::STATE_OK);
+      for (auto && [status, s, t] : sst) {
+        auto && [is_new_node, prev_node] = bgraph.add_node(s);
+        if (is_new_node)
+          bwd_waiting->insert(prev_node);
+        bgraph.add_edge(prev_node, bnode, *t);
+        ++stats.visited_transitions();
+      }
+      sst.clear();
+    }
+  }
+
+  fwd_waiting->clear();
+  bwd_waiting->clear();
+
+  stats.set_end_time();
+
+  return std::make_tuple(stats, fwd_state_space, bwd_state_space);
+}
+
+} // end of namespace zg_bwd_reach
+
+} // end of namespace algorithms
+
+} // end of namespace tchecker
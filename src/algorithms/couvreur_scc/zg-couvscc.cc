@@ -8,6 +8,7 @@
 #include <boost/dynamic_bitset.hpp>
 
 #include "tchecker/counter-example/counter_example_liveness.hh"
+#include "tchecker/graph/binary.hh"
 #include "tchecker/system/static_analysis.hh"
 #include "tchecker/ta/system.hh"
 #include "tchecker/utils/log.hh"
@@ -126,6 +127,13 @@ std::ostream & dot_output(std::ostream & os, tchecker::algorithms::zg_couvscc::g
                                                    tchecker::algorithms::zg_couvscc::edge_lexical_less_t>(os, g, name);
 }
 
+std::ostream & binary_output(std::ostream & os, tchecker::algorithms::zg_couvscc::graph_t const & g, std::string const & name)
+{
+  return tchecker::graph::binary::output<tchecker::algorithms::zg_couvscc::graph_t,
+                                         tchecker::algorithms::zg_couvscc::node_lexical_less_t,
+                                         tchecker::algorithms::zg_couvscc::edge_lexical_less_t>(os, g, g.zg().system(), name);
+}
+
 /* state_space_t */
 
 state_space_t::state_space_t(std::shared_ptr<tchecker::zg::zg_t> const & zg, std::size_t block_size, std::size_t table_size)
@@ -158,7 +166,7 @@ std::ostream & dot_output(std::ostream & os, tchecker::algorithms::zg_couvscc::c
 
 std::tuple<tchecker::algorithms::couvscc::stats_t, std::shared_ptr<tchecker::algorithms::zg_couvscc::state_space_t>>
 run(tchecker::parsing::system_declaration_t const & sysdecl, std::string const & labels, std::size_t block_size,
-    std::size_t table_size)
+    std::size_t table_size, tchecker::progress_t * progress)
 {
   std::shared_ptr<tchecker::ta::system_t const> system{new tchecker::ta::system_t{sysdecl}};
   if (!tchecker::system::every_process_has_initial_location(system->as_system_system()))
@@ -176,11 +184,11 @@ run(tchecker::parsing::system_declaration_t const & sysdecl, std::string const &
 
   if (accepting_labels.count() > 1) {
     tchecker::algorithms::zg_couvscc::generalized_algorithm_t algorithm;
-    stats = algorithm.run(state_space->zg(), state_space->graph(), accepting_labels);
+    stats = algorithm.run(state_space->zg(), state_space->graph(), accepting_labels, progress);
   }
   else {
     tchecker::algorithms::zg_couvscc::single_algorithm_t algorithm;
-    stats = algorithm.run(state_space->zg(), state_space->graph(), accepting_labels);
+    stats = algorithm.run(state_space->zg(), state_space->graph(), accepting_labels, progress);
   }
 
   return std::make_tuple(stats, state_space);
@@ -14,7 +14,11 @@ namespace tchecker {
 namespace algorithms {
 namespace covreach {
 
-stats_t::stats_t() : _visited_states(0), _visited_transitions(0), _covered_states(0), _stored_states(0), _reachable(false) {}
+stats_t::stats_t()
+    : _visited_states(0), _visited_transitions(0), _covered_states(0), _covered_expanded_states(0), _stored_states(0),
+      _reachable(false)
+{
+}
 
 unsigned long & stats_t::visited_states() { return _visited_states; }
 
@@ -28,6 +32,10 @@ unsigned long & stats_t::covered_states() { return _covered_states; }
 
 unsigned long stats_t::covered_states() const { return _covered_states; }
 
+unsigned long & stats_t::covered_expanded_states() { return _covered_expanded_states; }
+
+unsigned long stats_t::covered_expanded_states() const { return _covered_expanded_states; }
+
 unsigned long & stats_t::stored_states() { return _stored_states; }
 
 unsigned long stats_t::stored_states() const { return _stored_states; }
@@ -53,6 +61,10 @@ void stats_t::attributes(std::map<std::string, std::string> & m) const
   sstream << _covered_states;
   m["COVERED_STATES"] = sstream.str();
 
+  sstream.str("");
+  sstream << _covered_expanded_states;
+  m["COVERED_EXPANDED_STATES"] = sstream.str();
+
   sstream.str("");
   sstream << _stored_states;
   m["STORED_STATES"] = sstream.str();
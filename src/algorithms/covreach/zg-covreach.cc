@@ -5,13 +5,21 @@
  *
  */
 
+#include <chrono>
+#include <memory>
+
 #include <boost/dynamic_bitset.hpp>
 
 #include "tchecker/counter-example/counter_example_reach.hh"
 #include "tchecker/algorithms/search_order.hh"
+#include "tchecker/graph/binary.hh"
 #include "tchecker/system/static_analysis.hh"
 #include "tchecker/ta/state.hh"
+#include "tchecker/utils/incremental_collector.hh"
 #include "tchecker/utils/log.hh"
+#include "tchecker/waiting/budgeted.hh"
+#include "tchecker/waiting/collecting.hh"
+#include "tchecker/waiting/reporting.hh"
 #include "tchecker/algorithms/covreach/zg-covreach.hh"
 
 namespace tchecker {
@@ -130,6 +138,13 @@ std::ostream & dot_output(std::ostream & os, tchecker::algorithms::zg_covreach::
                                                   tchecker::algorithms::zg_covreach::edge_lexical_less_t>(os, g, name);
 }
 
+std::ostream & binary_output(std::ostream & os, tchecker::algorithms::zg_covreach::graph_t const & g, std::string const & name)
+{
+  return tchecker::graph::binary::output<tchecker::algorithms::zg_covreach::graph_t,
+                                         tchecker::algorithms::zg_covreach::node_lexical_less_t,
+                                         tchecker::algorithms::zg_covreach::edge_lexical_less_t>(os, g, g.zg().system(), name);
+}
+
 /* state_space_t */
 
 state_space_t::state_space_t(std::shared_ptr<tchecker::zg::zg_t> const & zg, std::size_t block_size, std::size_t table_size)
@@ -172,9 +187,37 @@ std::ostream & dot_output(std::ostream & os, tchecker::algorithms::zg_covreach::
 
 /* run */
 
+/*!
+ \brief Time budget of a slice of incremental garbage collection
+ */
+static constexpr std::chrono::microseconds INCREMENTAL_GC_BUDGET{100};
+
+/*!
+ \brief Number of iterations between two slices of incremental garbage
+ collection
+ */
+static constexpr unsigned long INCREMENTAL_GC_PERIOD = 256;
+
+/*!
+ \brief Number of iterations between two checks of the memory budget
+ */
+static constexpr unsigned long MEMORY_BUDGET_PERIOD = 256;
+
 std::tuple<tchecker::algorithms::covreach::stats_t, std::shared_ptr<tchecker::algorithms::zg_covreach::state_space_t>>
 run(tchecker::parsing::system_declaration_t const & sysdecl, std::string const & labels, std::string const & search_order,
     tchecker::algorithms::covreach::covering_t covering, std::size_t block_size, std::size_t table_size)
+{
+  auto && [stats, properties, state_space] = tchecker::algorithms::zg_covreach::run(
+      sysdecl, std::vector<std::string>{labels}, search_order, covering, block_size, table_size);
+  return std::make_tuple(stats, state_space);
+}
+
+std::tuple<tchecker::algorithms::covreach::stats_t, tchecker::algorithms::properties_t,
+           std::shared_ptr<tchecker::algorithms::zg_covreach::state_space_t>>
+run(tchecker::parsing::system_declaration_t const & sysdecl, std::vector<std::string> const & labels,
+    std::string const & search_order, tchecker::algorithms::covreach::covering_t covering, std::size_t block_size,
+    std::size_t table_size, std::string const & spill_directory, enum tchecker::huge_pages_t huge_pages,
+    bool incremental_gc, tchecker::memory_budget_t * budget, tchecker::progress_t * progress)
 {
   std::shared_ptr<tchecker::ta::system_t const> system{new tchecker::ta::system_t{sysdecl}};
   if (!tchecker::system::every_process_has_initial_location(system->as_system_system()))
@@ -182,27 +225,66 @@ run(tchecker::parsing::system_declaration_t const & sysdecl, std::string const &
 
   std::shared_ptr<tchecker::zg::zg_t> zg{tchecker::zg::factory(system, tchecker::ts::SHARING, tchecker::zg::ELAPSED_SEMANTICS,
                                                                tchecker::zg::EXTRA_LU_PLUS_LOCAL, block_size, table_size)};
+  if (!spill_directory.empty())
+    zg->spill(spill_directory);
+  if (huge_pages != tchecker::HUGE_PAGES_NONE)
+    zg->huge_pages(huge_pages);
 
   std::shared_ptr<tchecker::algorithms::zg_covreach::state_space_t> state_space =
       std::make_shared<tchecker::algorithms::zg_covreach::state_space_t>(zg, block_size, table_size);
+  if (huge_pages != tchecker::HUGE_PAGES_NONE)
+    state_space->graph().huge_pages(huge_pages);
+
+  tchecker::algorithms::properties_t properties;
+  for (std::string const & l : labels)
+    properties.add(l, system->as_syncprod_system().labels(l));
+
+  // the collector outlives the waiting container that runs it
+  tchecker::incremental_collector_t collector;
+  std::unique_ptr<tchecker::waiting::waiting_t<graph_t::node_sptr_t>> waiting;
+  if (search_order == "ranking")
+    waiting.reset(tchecker::waiting::factory<graph_t::node_sptr_t, tchecker::graph::node_rank_greater_t>(
+        tchecker::waiting::FAST_REMOVE_PQUEUE));
+  else
+    waiting.reset(
+        tchecker::waiting::factory<graph_t::node_sptr_t>(tchecker::algorithms::fast_remove_waiting_policy(search_order)));
+
+  if (incremental_gc) {
+    // nodes and edges own states and tuples of edges, that own shared components
+    state_space->graph().enroll(collector);
+    zg->enroll(collector);
+    waiting.reset(new tchecker::waiting::collecting_t<graph_t::node_sptr_t>{waiting.release(), collector,
+                                                                            INCREMENTAL_GC_BUDGET, INCREMENTAL_GC_PERIOD});
+  }
 
-  boost::dynamic_bitset<> accepting_labels = system->as_syncprod_system().labels(labels);
+  tchecker::algorithms::covreach::stats_t stats;
 
-  enum tchecker::waiting::policy_t policy = tchecker::algorithms::fast_remove_waiting_policy(search_order);
+  if (progress != nullptr) {
+    auto snapshot = [&](unsigned long waiting_size) {
+      progress->publish(stats.visited_states(), state_space->graph().nodes_count(), waiting_size, stats.covered_states());
+    };
+    waiting.reset(
+        new tchecker::waiting::reporting_t<graph_t::node_sptr_t>{waiting.release(), snapshot, tchecker::PROGRESS_PERIOD});
+  }
+
+  if (budget != nullptr) {
+    budget->memsize([zg, state_space]() { return zg->memsize() + state_space->graph().memsize(); });
+    budget->degrade([state_space]() { state_space->graph().drop_edges(); });
+    waiting.reset(new tchecker::waiting::budgeted_t<graph_t::node_sptr_t>{waiting.release(), *budget, MEMORY_BUDGET_PERIOD});
+  }
 
-  tchecker::algorithms::covreach::stats_t stats;
   tchecker::algorithms::zg_covreach::algorithm_t algorithm;
 
   if (covering == tchecker::algorithms::covreach::COVERING_FULL)
-    stats = algorithm.run<tchecker::algorithms::covreach::COVERING_FULL>(state_space->zg(), state_space->graph(),
-                                                                         accepting_labels, policy);
+    algorithm.run<tchecker::algorithms::covreach::COVERING_FULL>(state_space->zg(), state_space->graph(), properties, *waiting,
+                                                                 stats);
   else if (covering == tchecker::algorithms::covreach::COVERING_LEAF_NODES)
-    stats = algorithm.run<tchecker::algorithms::covreach::COVERING_LEAF_NODES>(state_space->zg(), state_space->graph(),
-                                                                               accepting_labels, policy);
+    algorithm.run<tchecker::algorithms::covreach::COVERING_LEAF_NODES>(state_space->zg(), state_space->graph(), properties,
+                                                                       *waiting, stats);
   else
     throw std::invalid_argument("Unknown covering policy for covreach algorithm");
 
-  return std::make_tuple(stats, state_space);
+  return std::make_tuple(stats, properties, state_space);
 }
 
 } // namespace zg_covreach
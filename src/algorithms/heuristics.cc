@@ -0,0 +1,93 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <algorithm>
+#include <deque>
+
+#include "tchecker/algorithms/heuristics.hh"
+
+namespace tchecker {
+
+namespace algorithms {
+
+location_distance_t::location_distance_t(tchecker::syncprod::system_t const & system,
+                                         tchecker::algorithms::properties_t const & properties)
+    : _properties(properties), _labels_count(system.labels_count()), _label_index(system.labels_count(), _labels_count),
+      _indexed_labels(0)
+{
+  for (std::size_t i = 0; i < _properties.size(); ++i) {
+    boost::dynamic_bitset<> const & labels = _properties.labels(i);
+    for (std::size_t l = labels.find_first(); l != boost::dynamic_bitset<>::npos; l = labels.find_next(l))
+      if (_label_index[l] == _labels_count)
+        _label_index[l] = _indexed_labels++;
+  }
+
+  std::size_t const locations_count = system.locations_count();
+  _distances.resize(locations_count * _indexed_labels, tchecker::waiting::INFINITE_HEURISTIC);
+
+  // multi-source backward breadth-first search from the locations with each label
+  std::deque<tchecker::loc_id_t> waiting;
+  for (tchecker::label_id_t label = 0; label < _labels_count; ++label) {
+    std::size_t const index = _label_index[label];
+    if (index == _labels_count)
+      continue;
+
+    for (tchecker::loc_id_t loc = 0; loc < locations_count; ++loc)
+      if (system.labels(loc)[label]) {
+        _distances[loc * _indexed_labels + index] = 0;
+        waiting.push_back(loc);
+      }
+
+    while (!waiting.empty()) {
+      tchecker::loc_id_t const loc = waiting.front();
+      waiting.pop_front();
+      std::uint32_t const d = _distances[loc * _indexed_labels + index] + 1;
+      for (tchecker::system::edge_const_shared_ptr_t const & edge : system.incoming_edges(loc)) {
+        std::uint32_t & src_distance = _distances[edge->src() * _indexed_labels + index];
+        if (src_distance <= d)
+          continue;
+        src_distance = d;
+        waiting.push_back(edge->src());
+      }
+    }
+  }
+}
+
+std::uint32_t location_distance_t::operator()(tchecker::vloc_t const & vloc) const
+{
+  if (!_properties.pending())
+    return 0;
+
+  std::uint32_t h = tchecker::waiting::INFINITE_HEURISTIC;
+  for (std::size_t i = 0; i < _properties.size(); ++i) {
+    boost::dynamic_bitset<> const & labels = _properties.labels(i);
+    if (_properties.reachable(i) || labels.none())
+      continue;
+
+    std::uint32_t property_h = 0;
+    for (std::size_t l = labels.find_first(); l != boost::dynamic_bitset<>::npos; l = labels.find_next(l)) {
+      std::uint32_t label_h = tchecker::waiting::INFINITE_HEURISTIC;
+      for (tchecker::loc_id_t loc : vloc)
+        label_h = std::min(label_h, distance(loc, l));
+      property_h = std::max(property_h, label_h);
+    }
+    h = std::min(h, property_h);
+  }
+  return h;
+}
+
+std::uint32_t location_distance_t::distance(tchecker::loc_id_t loc, tchecker::label_id_t label) const
+{
+  std::size_t const index = _label_index[label];
+  if (index == _labels_count)
+    return tchecker::waiting::INFINITE_HEURISTIC;
+  return _distances[loc * _indexed_labels + index];
+}
+
+} // end of namespace algorithms
+
+} // end of namespace tchecker
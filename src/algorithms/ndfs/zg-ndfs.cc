@@ -9,6 +9,7 @@
 
 #include "tchecker/algorithms/ndfs/zg-ndfs.hh"
 #include "tchecker/counter-example/counter_example_liveness.hh"
+#include "tchecker/graph/binary.hh"
 #include "tchecker/system/static_analysis.hh"
 #include "tchecker/ta/system.hh"
 #include "tchecker/utils/log.hh"
@@ -127,6 +128,13 @@ std::ostream & dot_output(std::ostream & os, tchecker::algorithms::zg_ndfs::grap
                                                    tchecker::algorithms::zg_ndfs::edge_lexical_less_t>(os, g, name);
 }
 
+std::ostream & binary_output(std::ostream & os, tchecker::algorithms::zg_ndfs::graph_t const & g, std::string const & name)
+{
+  return tchecker::graph::binary::output<tchecker::algorithms::zg_ndfs::graph_t,
+                                         tchecker::algorithms::zg_ndfs::node_lexical_less_t,
+                                         tchecker::algorithms::zg_ndfs::edge_lexical_less_t>(os, g, g.zg().system(), name);
+}
+
 /* state_space_t */
 
 state_space_t::state_space_t(std::shared_ptr<tchecker::zg::zg_t> const & zg, std::size_t block_size, std::size_t table_size)
@@ -159,7 +167,7 @@ std::ostream & dot_output(std::ostream & os, tchecker::algorithms::zg_ndfs::cex:
 
 std::tuple<tchecker::algorithms::ndfs::stats_t, std::shared_ptr<tchecker::algorithms::zg_ndfs::state_space_t>>
 run(tchecker::parsing::system_declaration_t const & sysdecl, std::string const & labels, std::size_t block_size,
-    std::size_t table_size)
+    std::size_t table_size, tchecker::progress_t * progress)
 {
   std::shared_ptr<tchecker::ta::system_t const> system{new tchecker::ta::system_t{sysdecl}};
   if (!tchecker::system::every_process_has_initial_location(system->as_system_system()))
@@ -175,7 +183,8 @@ run(tchecker::parsing::system_declaration_t const & sysdecl, std::string const &
 
   tchecker::algorithms::zg_ndfs::algorithm_t algorithm;
 
-  tchecker::algorithms::ndfs::stats_t stats = algorithm.run(state_space->zg(), state_space->graph(), accepting_labels);
+  tchecker::algorithms::ndfs::stats_t stats =
+      algorithm.run(state_space->zg(), state_space->graph(), accepting_labels, progress);
 
   return std::make_tuple(stats, state_space);
 }
@@ -0,0 +1,72 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <sstream>
+
+#include "tchecker/algorithms/properties.hh"
+
+namespace tchecker {
+
+namespace algorithms {
+
+properties_t::properties_t(boost::dynamic_bitset<> const & labels) { add("", labels); }
+
+void properties_t::add(std::string const & name, boost::dynamic_bitset<> const & labels)
+{
+  _names.push_back(name);
+  _labels.push_back(labels);
+  _reachable.push_back(false);
+  if (!labels.none())
+    ++_pending_count;
+}
+
+bool properties_t::match(boost::dynamic_bitset<> const & labels) const
+{
+  if (_pending_count == 0)
+    return false;
+  for (std::size_t i = 0; i < _labels.size(); ++i)
+    if (!_reachable[i] && !_labels[i].none() && _labels[i].is_subset_of(labels))
+      return true;
+  return false;
+}
+
+void properties_t::mark(boost::dynamic_bitset<> const & labels)
+{
+  for (std::size_t i = 0; i < _labels.size(); ++i)
+    if (!_reachable[i] && !_labels[i].none() && _labels[i].is_subset_of(labels)) {
+      _reachable[i] = true;
+      ++_reachable_count;
+      --_pending_count;
+    }
+}
+
+void properties_t::reset()
+{
+  _reachable.assign(_labels.size(), false);
+  _reachable_count = 0;
+  _pending_count = 0;
+  for (boost::dynamic_bitset<> const & labels : _labels)
+    if (!labels.none())
+      ++_pending_count;
+}
+
+void properties_t::attributes(std::map<std::string, std::string> & m) const
+{
+  for (std::size_t i = 0; i < _labels.size(); ++i) {
+    std::stringstream key;
+    key << "PROPERTY_" << i;
+    m[key.str() + "_LABELS"] = _names[i];
+
+    std::stringstream sstream;
+    sstream << std::boolalpha << _reachable[i];
+    m[key.str() + "_REACHABLE"] = sstream.str();
+  }
+}
+
+} // end of namespace algorithms
+
+} // end of namespace tchecker
@@ -0,0 +1,379 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "tchecker/algorithms/reach/checkpoint.hh"
+#include "tchecker/dbm/db.hh"
+#include "tchecker/syncprod/packed_vloc.hh"
+#include "tchecker/syncprod/vloc.hh"
+#include "tchecker/system/output.hh"
+#include "tchecker/utils/tree_table.hh"
+#include "tchecker/variables/intvars.hh"
+#include "tchecker/variables/packed_intvals.hh"
+#include "tchecker/zg/zone.hh"
+
+namespace tchecker {
+
+namespace algorithms {
+
+namespace zg_reach {
+
+/* binary format */
+
+static char const CHECKPOINT_MAGIC[8] = {'T', 'C', 'K', 'C', 'K', 'P', 'T', '\0'}; /*!< Checkpoint file signature */
+
+static std::uint32_t const CHECKPOINT_VERSION = 1; /*!< Checkpoint format version */
+
+static std::uint8_t const CHECKPOINT_INITIAL = 1; /*!< Initial node flag */
+
+static std::uint8_t const CHECKPOINT_FINAL = 2; /*!< Final node flag */
+
+/*!
+ \brief Write a value
+ \param os : output stream
+ \param v : value
+ \post the bytes of v have been written to os
+ */
+template <class T> static void write(std::ostream & os, T const & v)
+{
+  os.write(reinterpret_cast<char const *>(&v), sizeof(T));
+}
+
+/*!
+ \brief Write a string
+ \param os : output stream
+ \param s : string
+ \post the size of s followed by its characters have been written to os
+ */
+static void write(std::ostream & os, std::string const & s)
+{
+  write<std::uint64_t>(os, s.size());
+  os.write(s.data(), s.size());
+}
+
+/*!
+ \brief Read a value
+ \param is : input stream
+ \return value read from is
+ \throw std::runtime_error : if the value cannot be read
+ */
+template <class T> static T read(std::istream & is)
+{
+  T v;
+  if (!is.read(reinterpret_cast<char *>(&v), sizeof(T)))
+    throw std::runtime_error("Truncated checkpoint");
+  return v;
+}
+
+/*!
+ \brief Read a string
+ \param is : input stream
+ \return string read from is
+ \throw std::runtime_error : if the string cannot be read
+ */
+static std::string read_string(std::istream & is)
+{
+  std::string s(read<std::uint64_t>(is), '\0');
+  if (!is.read(s.data(), s.size()))
+    throw std::runtime_error("Truncated checkpoint");
+  return s;
+}
+
+/*!
+ \brief Check a value read from a checkpoint
+ \param is : input stream
+ \param expected : expected value
+ \param what : description of the value
+ \throw std::runtime_error : if the value read from is differs from expected
+ */
+template <class T> static void check(std::istream & is, T const & expected, std::string const & what)
+{
+  if (read<T>(is) != expected)
+    throw std::runtime_error("Checkpoint does not match " + what);
+}
+
+/*!
+ \brief Check a string read from a checkpoint
+ \param is : input stream
+ \param expected : expected string
+ \param what : description of the string
+ \throw std::runtime_error : if the string read from is differs from expected
+ */
+static void check(std::istream & is, std::string const & expected, std::string const & what)
+{
+  if (read_string(is) != expected)
+    throw std::runtime_error("Checkpoint does not match " + what);
+}
+
+/*!
+ \brief Hash a system
+ \param system : system
+ \return FNV-1a hash of the declaration of system in the TChecker syntax
+ \note the hash is independent of the build and of the platform, and it
+ distinguishes systems that have the same name, processes and variables, but
+ distinct guards, invariants or updates
+ */
+static std::uint64_t system_hash(tchecker::ta::system_t const & system)
+{
+  std::ostringstream oss;
+  tchecker::system::output_tck(oss, system.as_system_system());
+
+  std::uint64_t h = 14695981039346656037ULL;
+  for (char c : oss.str()) {
+    h ^= static_cast<unsigned char>(c);
+    h *= 1099511628211ULL;
+  }
+  return h;
+}
+
+/*!
+ \brief Write checkpoint header
+ \param os : output stream
+ \param system_name : name of the system
+ \param search_order : search order
+ \param zg : zone graph
+ \param vloc_packing : layout of packed tuples of locations
+ \param intval_packing : layout of packed valuations of bounded integer variables
+ \param properties : properties
+ \post the signature of the checkpoint and of the run have been written to os
+ */
+static void write_header(std::ostream & os, std::string const & system_name, std::string const & search_order,
+                         tchecker::zg::zg_t const & zg, tchecker::vloc_packing_t const & vloc_packing,
+                         tchecker::intval_packing_t const & intval_packing,
+                         tchecker::algorithms::properties_t const & properties)
+{
+  os.write(CHECKPOINT_MAGIC, sizeof(CHECKPOINT_MAGIC));
+  write<std::uint32_t>(os, CHECKPOINT_VERSION);
+  write<std::uint32_t>(os, sizeof(tchecker::integer_t));
+  write<std::uint32_t>(os, sizeof(tchecker::dbm::db_t));
+  write(os, system_name);
+  write<std::uint64_t>(os, system_hash(zg.system()));
+  write(os, search_order);
+  write<std::uint64_t>(os, zg.system().processes_count());
+  write<std::uint64_t>(os, vloc_packing.words_count());
+  write<std::uint64_t>(os, zg.system().intvars_count(tchecker::VK_FLATTENED));
+  write<std::uint64_t>(os, intval_packing.words_count());
+  write<std::uint64_t>(os, zg.clocks_count() + 1);
+  write<std::uint64_t>(os, properties.size());
+  for (std::size_t i = 0; i < properties.size(); ++i)
+    write(os, properties.name(i));
+}
+
+/*!
+ \brief Check checkpoint header
+ \param is : input stream
+ \param system_name : name of the system
+ \param search_order : search order
+ \param zg : zone graph
+ \param vloc_packing : layout of packed tuples of locations
+ \param intval_packing : layout of packed valuations of bounded integer variables
+ \param properties : properties
+ \throw std::runtime_error : if the header read from is does not match the
+ parameters
+ */
+static void check_header(std::istream & is, std::string const & system_name, std::string const & search_order,
+                         tchecker::zg::zg_t const & zg, tchecker::vloc_packing_t const & vloc_packing,
+                         tchecker::intval_packing_t const & intval_packing,
+                         tchecker::algorithms::properties_t const & properties)
+{
+  char magic[sizeof(CHECKPOINT_MAGIC)];
+  if (!is.read(magic, sizeof(magic)) || std::memcmp(magic, CHECKPOINT_MAGIC, sizeof(magic)) != 0)
+    throw std::runtime_error("Not a checkpoint file");
+  check<std::uint32_t>(is, CHECKPOINT_VERSION, "format version");
+  check<std::uint32_t>(is, sizeof(tchecker::integer_t), "build of TChecker");
+  check<std::uint32_t>(is, sizeof(tchecker::dbm::db_t), "build of TChecker");
+  check(is, system_name, "system " + system_name);
+  check<std::uint64_t>(is, system_hash(zg.system()), "declaration of system " + system_name);
+  check(is, search_order, "search order " + search_order);
+  check<std::uint64_t>(is, zg.system().processes_count(), "number of processes");
+  check<std::uint64_t>(is, vloc_packing.words_count(), "locations of processes");
+  check<std::uint64_t>(is, zg.system().intvars_count(tchecker::VK_FLATTENED), "number of bounded integer variables");
+  check<std::uint64_t>(is, intval_packing.words_count(), "domains of bounded integer variables");
+  check<std::uint64_t>(is, zg.clocks_count() + 1, "number of clocks");
+  check<std::uint64_t>(is, properties.size(), "number of properties");
+  for (std::size_t i = 0; i < properties.size(); ++i)
+    check(is, properties.name(i), "property " + properties.name(i));
+}
+
+/* save_checkpoint */
+
+void save_checkpoint(std::string const & filename, std::string const & system_name, std::string const & search_order,
+                     tchecker::zg::zg_t const & zg, tchecker::algorithms::zg_reach::graph_t const & graph,
+                     std::vector<tchecker::algorithms::zg_reach::graph_t::node_sptr_t> const & waiting,
+                     tchecker::algorithms::reach::stats_t const & stats,
+                     tchecker::algorithms::properties_t const & properties)
+{
+  std::string const tmp_filename = filename + ".tmp";
+  std::ofstream os(tmp_filename, std::ios::out | std::ios::binary | std::ios::trunc);
+  if (!os)
+    throw std::runtime_error("Cannot write checkpoint " + tmp_filename);
+
+  tchecker::vloc_packing_t const vloc_packing{zg.system()};
+  tchecker::intval_packing_t const intval_packing{zg.system().integer_variables().flattened()};
+  std::vector<tchecker::packed_word_t> words(vloc_packing.words_count() + intval_packing.words_count());
+  tchecker::packed_word_t * const vloc_words = words.data();
+  tchecker::packed_word_t * const intval_words = words.data() + vloc_packing.words_count();
+
+  write_header(os, system_name, search_order, zg, vloc_packing, intval_packing, properties);
+
+  // stats and properties
+  write<std::uint64_t>(os, stats.visited_states());
+  write<std::uint64_t>(os, stats.visited_transitions());
+  write<std::uint8_t>(os, stats.reachable());
+  for (std::size_t i = 0; i < properties.size(); ++i)
+    write<std::uint8_t>(os, properties.reachable(i));
+
+  // discrete parts of nodes, tree-compressed
+  tchecker::tree_table_t tree{words.size(), graph.nodes_count()};
+  std::vector<tchecker::tree_table_t::index_t> roots;
+  roots.reserve(graph.nodes_count());
+  for (tchecker::algorithms::zg_reach::graph_t::node_sptr_t const & n : graph.nodes()) {
+    vloc_packing.pack(n->state().vloc(), vloc_words);
+    intval_packing.pack(n->state().intval(), intval_words);
+    roots.push_back(tree.insert(words.data()));
+  }
+
+  write<std::uint64_t>(os, tree.pairs_count());
+  for (tchecker::tree_table_t::index_t id = 0; id < tree.pairs_count(); ++id) {
+    auto && [left, right] = tree.pair(id);
+    write<std::uint64_t>(os, left);
+    write<std::uint64_t>(os, right);
+  }
+
+  // nodes
+  std::unordered_map<tchecker::algorithms::zg_reach::node_t const *, std::uint64_t> index;
+  index.reserve(graph.nodes_count());
+  write<std::uint64_t>(os, graph.nodes_count());
+  for (tchecker::algorithms::zg_reach::graph_t::node_sptr_t const & n : graph.nodes()) {
+    std::uint64_t const id = index.size();
+    index.emplace(n.ptr(), id);
+
+    std::uint8_t flags = (n->initial() ? CHECKPOINT_INITIAL : 0) | (n->final() ? CHECKPOINT_FINAL : 0);
+    write<std::uint8_t>(os, flags);
+    write<std::uint64_t>(os, roots[id]);
+
+    tchecker::zg::zone_t const & z = n->state().zone();
+    os.write(reinterpret_cast<char const *>(z.dbm()), z.dim() * z.dim() * sizeof(tchecker::dbm::db_t));
+  }
+
+  // waiting nodes
+  write<std::uint64_t>(os, waiting.size());
+  for (tchecker::algorithms::zg_reach::graph_t::node_sptr_t const & n : waiting)
+    write<std::uint64_t>(os, index.at(n.ptr()));
+
+  os.close();
+  if (!os)
+    throw std::runtime_error("Cannot write checkpoint " + tmp_filename);
+
+  if (std::rename(tmp_filename.c_str(), filename.c_str()) != 0)
+    throw std::runtime_error("Cannot write checkpoint " + filename);
+}
+
+/* load_checkpoint */
+
+void load_checkpoint(std::string const & filename, std::string const & system_name, std::string const & search_order,
+                     tchecker::zg::zg_t & zg, tchecker::algorithms::zg_reach::graph_t & graph,
+                     std::vector<tchecker::algorithms::zg_reach::graph_t::node_sptr_t> & waiting,
+                     tchecker::algorithms::reach::stats_t & stats, tchecker::algorithms::properties_t & properties)
+{
+  std::ifstream is(filename, std::ios::in | std::ios::binary);
+  if (!is)
+    throw std::runtime_error("Cannot read checkpoint " + filename);
+
+  tchecker::vloc_packing_t const vloc_packing{zg.system()};
+  tchecker::intval_packing_t const intval_packing{zg.system().integer_variables().flattened()};
+  std::vector<tchecker::packed_word_t> words(vloc_packing.words_count() + intval_packing.words_count());
+  tchecker::packed_word_t * const vloc_words = words.data();
+  tchecker::packed_word_t * const intval_words = words.data() + vloc_packing.words_count();
+
+  check_header(is, system_name, search_order, zg, vloc_packing, intval_packing, properties);
+
+  // stats and properties
+  stats.visited_states() = read<std::uint64_t>(is);
+  stats.visited_transitions() = read<std::uint64_t>(is);
+  stats.reachable() = (read<std::uint8_t>(is) != 0);
+  for (std::size_t i = 0; i < properties.size(); ++i)
+    if (read<std::uint8_t>(is) != 0)
+      properties.mark(properties.labels(i));
+
+  // nodes
+  std::size_t const processes_count = zg.system().processes_count();
+  std::size_t const intvars_count = zg.system().intvars_count(tchecker::VK_FLATTENED);
+  tchecker::clock_id_t const dim = zg.clocks_count() + 1;
+
+  tchecker::vloc_t * vloc = tchecker::vloc_allocate_and_construct(processes_count, processes_count);
+  tchecker::intval_t * intval = tchecker::intval_allocate_and_construct(intvars_count, intvars_count);
+  tchecker::zg::zone_t * zone = tchecker::zg::zone_allocate_and_construct(dim, dim);
+
+  std::vector<tchecker::algorithms::zg_reach::graph_t::node_sptr_t> nodes;
+
+  try {
+    // discrete parts of nodes, tree-compressed
+    std::uint64_t const pairs_count = read<std::uint64_t>(is);
+    tchecker::tree_table_t tree{words.size(), pairs_count};
+    for (std::uint64_t id = 0; id < pairs_count; ++id) {
+      std::uint64_t const left = read<std::uint64_t>(is);
+      std::uint64_t const right = read<std::uint64_t>(is);
+      if (tree.find_or_add(left, right) != id)
+        throw std::runtime_error("Corrupted checkpoint: duplicate tree node");
+    }
+
+    // nodes
+    std::uint64_t const nodes_count = read<std::uint64_t>(is);
+    nodes.reserve(nodes_count);
+    for (std::uint64_t i = 0; i < nodes_count; ++i) {
+      std::uint8_t const flags = read<std::uint8_t>(is);
+      tree.get(read<std::uint64_t>(is), words.data());
+      vloc_packing.unpack(vloc_words, *vloc);
+      intval_packing.unpack(intval_words, *intval);
+      if (!is.read(reinterpret_cast<char *>(zone->dbm()), dim * dim * sizeof(tchecker::dbm::db_t)))
+        throw std::runtime_error("Truncated checkpoint");
+
+      tchecker::zg::state_sptr_t s = zg.create_state(*vloc, *intval, *zone);
+      zg.share(s);
+      auto && [is_new_node, node] = graph.add_node(s);
+      if (!is_new_node)
+        throw std::runtime_error("Corrupted checkpoint: duplicate node");
+      node->initial(flags & CHECKPOINT_INITIAL);
+      node->final(flags & CHECKPOINT_FINAL);
+      nodes.push_back(node);
+    }
+  }
+  catch (...) {
+    tchecker::vloc_destruct_and_deallocate(vloc);
+    tchecker::intval_destruct_and_deallocate(intval);
+    tchecker::zg::zone_destruct_and_deallocate(zone);
+    throw;
+  }
+
+  tchecker::vloc_destruct_and_deallocate(vloc);
+  tchecker::intval_destruct_and_deallocate(intval);
+  tchecker::zg::zone_destruct_and_deallocate(zone);
+
+  // waiting nodes
+  std::uint64_t const waiting_count = read<std::uint64_t>(is);
+  waiting.reserve(waiting.size() + waiting_count);
+  for (std::uint64_t i = 0; i < waiting_count; ++i) {
+    std::uint64_t const id = read<std::uint64_t>(is);
+    if (id >= nodes.size())
+      throw std::runtime_error("Corrupted checkpoint: unknown waiting node");
+    waiting.push_back(nodes[id]);
+  }
+}
+
+} // end of namespace zg_reach
+
+} // end of namespace algorithms
+
+} // end of namespace tchecker
@@ -5,15 +5,26 @@
  *
  */
 
+#include <cstdint>
 #include <ranges>
 
 #include <boost/dynamic_bitset.hpp>
 
 #include "tchecker/counter-example/counter_example_reach.hh"
+#include "tchecker/algorithms/heuristics.hh"
+#include "tchecker/algorithms/reach/checkpoint.hh"
 #include "tchecker/algorithms/search_order.hh"
+#include "tchecker/graph/binary.hh"
+#include "tchecker/graph/output.hh"
+#include "tchecker/syncprod/syncprod.hh"
 #include "tchecker/system/static_analysis.hh"
 #include "tchecker/ta/system.hh"
 #include "tchecker/utils/log.hh"
+#include "tchecker/waiting/budgeted.hh"
+#include "tchecker/waiting/checkpointing.hh"
+#include "tchecker/waiting/guided.hh"
+#include "tchecker/waiting/observable.hh"
+#include "tchecker/waiting/reporting.hh"
 #include "tchecker/algorithms/reach/zg-reach.hh"
 
 namespace tchecker {
@@ -128,6 +139,78 @@ std::ostream & dot_output(std::ostream & os, tchecker::algorithms::zg_reach::gra
                                                    tchecker::algorithms::zg_reach::edge_lexical_less_t>(os, g, name);
 }
 
+std::ostream & binary_output(std::ostream & os, tchecker::algorithms::zg_reach::graph_t const & g, std::string const & name)
+{
+  return tchecker::graph::binary::output<tchecker::algorithms::zg_reach::graph_t,
+                                         tchecker::algorithms::zg_reach::node_lexical_less_t,
+                                         tchecker::algorithms::zg_reach::edge_lexical_less_t>(os, g, g.zg().system(), name);
+}
+
+/* dot_stream_t */
+
+dot_stream_t::dot_stream_t(std::ostream & os, tchecker::algorithms::zg_reach::graph_t const & g, std::string const & name)
+    : _os(os), _g(g), _closed(false)
+{
+  tchecker::graph::dot_output_header(_os, name);
+}
+
+dot_stream_t::~dot_stream_t() { close(); }
+
+/*!
+ \brief Node name
+ \param n : a node
+ \return name of n in streaming output
+ */
+static std::uintptr_t stream_name(tchecker::algorithms::zg_reach::node_t const * n)
+{
+  return reinterpret_cast<std::uintptr_t>(n);
+}
+
+void dot_stream_t::output_node(tchecker::algorithms::zg_reach::graph_t::node_sptr_t const & n)
+{
+  assert(!_closed);
+  tchecker::ta::system_t const & system = _g.zg().system();
+  tchecker::zg::state_t const & s = n->state();
+
+  _os << "  n" << stream_name(n.ptr()) << " ";
+  {
+    tchecker::graph::dot_attributes_writer_t attr{_os};
+    if (n->final())
+      attr.attribute("final", "true");
+    if (n->initial())
+      attr.attribute("initial", "true");
+    attr.attribute_output(
+        "intval", [&](std::ostream & os) { tchecker::output(os, s.intval(), system.integer_variables().flattened().index()); });
+    attr.attribute("labels", tchecker::syncprod::labels_str(system.as_syncprod_system(), s));
+    attr.attribute_output("vloc", [&](std::ostream & os) { tchecker::output(os, s.vloc(), system.as_system_system()); });
+    attr.attribute_output("zone", [&](std::ostream & os) { s.zone().output(os, system.clock_variables().flattened().index()); });
+  }
+  _os << "\n";
+}
+
+void dot_stream_t::output_outgoing_edges(tchecker::algorithms::zg_reach::graph_t::node_sptr_t const & n)
+{
+  assert(!_closed);
+  tchecker::system::system_t const & system = _g.zg().system().as_system_system();
+
+  for (tchecker::algorithms::zg_reach::graph_t::edge_sptr_t const & e : _g.outgoing_edges(n)) {
+    _os << "  n" << stream_name(_g.edge_src(e).ptr()) << " -> n" << stream_name(_g.edge_tgt(e).ptr()) << " ";
+    {
+      tchecker::graph::dot_attributes_writer_t attr{_os};
+      attr.attribute_output("vedge", [&](std::ostream & os) { tchecker::output(os, e->vedge(), system); });
+    }
+    _os << "\n";
+  }
+}
+
+void dot_stream_t::close()
+{
+  if (_closed)
+    return;
+  tchecker::graph::dot_output_footer(_os);
+  _closed = true;
+}
+
 /* state_space_t */
 
 state_space_t::state_space_t(std::shared_ptr<tchecker::zg::zg_t> const & zg, std::size_t block_size, std::size_t table_size)
@@ -168,9 +251,36 @@ std::ostream & dot_output(std::ostream & os, tchecker::algorithms::zg_reach::cex
 
 /* run */
 
+/*!
+ \brief Number of iterations between two checks of the memory budget
+ */
+static constexpr unsigned long MEMORY_BUDGET_PERIOD = 256;
+
 std::tuple<tchecker::algorithms::reach::stats_t, std::shared_ptr<tchecker::algorithms::zg_reach::state_space_t>>
 run(tchecker::parsing::system_declaration_t const & sysdecl, std::string const & labels, std::string const & search_order,
     std::size_t block_size, std::size_t table_size)
+{
+  auto && [stats, properties, state_space] =
+      tchecker::algorithms::zg_reach::run(sysdecl, std::vector<std::string>{labels}, search_order, block_size, table_size);
+  return std::make_tuple(stats, state_space);
+}
+
+std::tuple<tchecker::algorithms::reach::stats_t, tchecker::algorithms::properties_t,
+           std::shared_ptr<tchecker::algorithms::zg_reach::state_space_t>>
+run(tchecker::parsing::system_declaration_t const & sysdecl, std::vector<std::string> const & labels,
+    std::string const & search_order, std::size_t block_size, std::size_t table_size)
+{
+  return tchecker::algorithms::zg_reach::run(sysdecl, labels, search_order, "", std::chrono::seconds{0}, "", block_size,
+                                             table_size);
+}
+
+std::tuple<tchecker::algorithms::reach::stats_t, tchecker::algorithms::properties_t,
+           std::shared_ptr<tchecker::algorithms::zg_reach::state_space_t>>
+run(tchecker::parsing::system_declaration_t const & sysdecl, std::vector<std::string> const & labels,
+    std::string const & search_order, std::string const & checkpoint_file, std::chrono::seconds checkpoint_interval,
+    std::string const & resume_file, std::size_t block_size, std::size_t table_size, std::string const & spill_directory,
+    std::ostream * graph_stream, enum tchecker::huge_pages_t huge_pages, tchecker::memory_budget_t * budget,
+    tchecker::progress_t * progress)
 {
   std::shared_ptr<tchecker::ta::system_t const> system{new tchecker::ta::system_t{sysdecl}};
   if (!tchecker::system::every_process_has_initial_location(system->as_system_system()))
@@ -195,19 +305,100 @@ run(tchecker::parsing::system_declaration_t const & sysdecl, std::string const &
                                                                 tchecker::zg::EXTRA_LU_PLUS_LOCAL,
 #endif
                                                                 block_size, table_size)};
+  if (!spill_directory.empty())
+    zg->spill(spill_directory);
+  if (huge_pages != tchecker::HUGE_PAGES_NONE)
+    zg->huge_pages(huge_pages);
 
   std::shared_ptr<tchecker::algorithms::zg_reach::state_space_t> state_space =
       std::make_shared<tchecker::algorithms::zg_reach::state_space_t>(zg, block_size, table_size);
+  if (huge_pages != tchecker::HUGE_PAGES_NONE)
+    state_space->graph().huge_pages(huge_pages);
 
-  boost::dynamic_bitset<> accepting_labels = system->as_syncprod_system().labels(labels);
+  tchecker::algorithms::properties_t properties;
+  for (std::string const & l : labels)
+    properties.add(l, system->as_syncprod_system().labels(l));
 
   tchecker::algorithms::zg_reach::algorithm_t algorithm;
 
-  enum tchecker::waiting::policy_t policy = tchecker::algorithms::waiting_policy(search_order);
+  bool const guided = tchecker::algorithms::is_guided_search_order(search_order);
+  if (guided && (!checkpoint_file.empty() || !resume_file.empty()))
+    throw std::invalid_argument("Checkpoints are not supported with search order " + search_order);
 
-  tchecker::algorithms::reach::stats_t stats = algorithm.run(state_space->zg(), state_space->graph(), accepting_labels, policy);
+  enum tchecker::waiting::policy_t policy =
+      (guided ? tchecker::waiting::PQUEUE : tchecker::algorithms::waiting_policy(search_order));
 
-  return std::make_tuple(stats, state_space);
+  if (!guided && checkpoint_file.empty() && resume_file.empty() && (graph_stream == nullptr) && (budget == nullptr) &&
+      (progress == nullptr)) {
+    tchecker::algorithms::reach::stats_t stats = algorithm.run(state_space->zg(), state_space->graph(), properties, policy);
+    return std::make_tuple(stats, properties, state_space);
+  }
+
+  tchecker::algorithms::reach::stats_t stats;
+  std::unique_ptr<tchecker::waiting::waiting_t<graph_t::node_sptr_t>> waiting;
+  if (guided) {
+    auto distance = std::make_shared<tchecker::algorithms::location_distance_t>(system->as_syncprod_system(), properties);
+    waiting.reset(new tchecker::waiting::guided_t<graph_t::node_sptr_t>{
+        tchecker::algorithms::guidance(search_order),
+        [distance](graph_t::node_sptr_t const & n) { return (*distance)(n->state().vloc()); }});
+  }
+  else
+    waiting.reset(tchecker::waiting::factory<graph_t::node_sptr_t>(policy));
+
+  // count waiting nodes from the initial or resumed ones, checkpoints drain and refill the container
+  if (progress != nullptr) {
+    auto snapshot = [&](unsigned long waiting_size) {
+      progress->publish(stats.visited_states(), state_space->graph().nodes_count(), waiting_size, 0);
+    };
+    waiting.reset(
+        new tchecker::waiting::reporting_t<graph_t::node_sptr_t>{waiting.release(), snapshot, tchecker::PROGRESS_PERIOD});
+  }
+
+  if (resume_file.empty())
+    algorithm.insert_initial_nodes(state_space->zg(), state_space->graph(), *waiting);
+  else {
+    std::vector<graph_t::node_sptr_t> nodes;
+    tchecker::algorithms::zg_reach::load_checkpoint(resume_file, sysdecl.name(), search_order, state_space->zg(),
+                                                    state_space->graph(), nodes, stats, properties);
+    tchecker::waiting::fill(*waiting, nodes, policy);
+  }
+
+  if (!checkpoint_file.empty()) {
+    auto checkpoint = [&](tchecker::waiting::waiting_t<graph_t::node_sptr_t> & w) {
+      std::vector<graph_t::node_sptr_t> nodes;
+      tchecker::waiting::drain(w, nodes);
+      tchecker::waiting::fill(w, nodes, policy);
+      tchecker::algorithms::zg_reach::save_checkpoint(checkpoint_file, sysdecl.name(), search_order, state_space->zg(),
+                                                      state_space->graph(), nodes, stats, properties);
+    };
+    waiting.reset(
+        new tchecker::waiting::checkpointing_t<graph_t::node_sptr_t>{waiting.release(), checkpoint_interval, checkpoint});
+  }
+
+  if (budget != nullptr) {
+    budget->memsize([zg, state_space]() { return zg->memsize() + state_space->graph().memsize(); });
+    budget->degrade([state_space]() { state_space->graph().drop_edges(); });
+    waiting.reset(new tchecker::waiting::budgeted_t<graph_t::node_sptr_t>{waiting.release(), *budget, MEMORY_BUDGET_PERIOD});
+  }
+
+  // observe the outermost container: checkpoints drain inner containers, that must not notify the stream
+  std::unique_ptr<tchecker::algorithms::zg_reach::dot_stream_t> stream;
+  if (graph_stream != nullptr) {
+    stream = std::make_unique<tchecker::algorithms::zg_reach::dot_stream_t>(*graph_stream, state_space->graph(), sysdecl.name());
+    auto processed = [&](graph_t::node_sptr_t const & n) {
+      stream->output_node(n);
+      stream->output_outgoing_edges(n);
+    };
+    auto dropped = [&](graph_t::node_sptr_t const & n) { stream->output_node(n); };
+    waiting.reset(new tchecker::waiting::observable_t<graph_t::node_sptr_t>{waiting.release(), processed, dropped});
+  }
+
+  algorithm.run(state_space->zg(), state_space->graph(), properties, *waiting, stats);
+
+  if (stream != nullptr)
+    stream->close();
+
+  return std::make_tuple(stats, properties, state_space);
 }
 
 } // namespace zg_reach
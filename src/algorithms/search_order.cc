@@ -29,6 +29,20 @@ enum tchecker::waiting::policy_t fast_remove_waiting_policy(std::string const &
   throw std::invalid_argument("Unknown search order: " + search_order);
 }
 
+bool is_guided_search_order(std::string const & search_order)
+{
+  return (search_order == "best-first") || (search_order == "astar");
+}
+
+enum tchecker::waiting::guidance_t guidance(std::string const & search_order)
+{
+  if (search_order == "best-first")
+    return tchecker::waiting::GUIDANCE_BEST_FIRST;
+  else if (search_order == "astar")
+    return tchecker::waiting::GUIDANCE_ASTAR;
+  throw std::invalid_argument("Unknown guided search order: " + search_order);
+}
+
 } // end of namespace algorithms
 
 } // end of namespace tchecker
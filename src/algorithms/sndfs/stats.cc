@@ -0,0 +1,37 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <sstream>
+
+#include "tchecker/algorithms/sndfs/stats.hh"
+
+namespace tchecker {
+
+namespace algorithms {
+
+namespace sndfs {
+
+stats_t::stats_t() : _subsumed_states(0) {}
+
+unsigned long & stats_t::subsumed_states() { return _subsumed_states; }
+
+unsigned long stats_t::subsumed_states() const { return _subsumed_states; }
+
+void stats_t::attributes(std::map<std::string, std::string> & m) const
+{
+  tchecker::algorithms::ndfs::stats_t::attributes(m);
+
+  std::stringstream sstream;
+  sstream << _subsumed_states;
+  m["SUBSUMED_STATES"] = sstream.str();
+}
+
+} // namespace sndfs
+
+} // end of namespace algorithms
+
+} // end of namespace tchecker
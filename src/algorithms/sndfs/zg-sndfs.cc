@@ -0,0 +1,174 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <boost/dynamic_bitset.hpp>
+
+#include "tchecker/algorithms/sndfs/zg-sndfs.hh"
+#include "tchecker/graph/binary.hh"
+#include "tchecker/system/static_analysis.hh"
+#include "tchecker/ta/state.hh"
+#include "tchecker/ta/system.hh"
+#include "tchecker/utils/log.hh"
+
+namespace tchecker {
+
+namespace algorithms {
+
+namespace zg_sndfs {
+
+/* node_t */
+
+node_t::node_t(tchecker::zg::state_sptr_t const & s) : tchecker::graph::node_zg_state_t(s) {}
+
+node_t::node_t(tchecker::zg::const_state_sptr_t const & s) : tchecker::graph::node_zg_state_t(s) {}
+
+/* node_hash_t */
+
+std::size_t node_hash_t::operator()(tchecker::algorithms::zg_sndfs::node_t const & n) const
+{
+  // NB: we hash on the discrete (i.e. ta) part of the state in n to check all nodes
+  // with same discrete part for covering
+  return tchecker::ta::shared_hash_value(n.state());
+}
+
+/* node_le_t */
+
+bool node_le_t::operator()(tchecker::algorithms::zg_sndfs::node_t const & n1,
+                           tchecker::algorithms::zg_sndfs::node_t const & n2) const
+{
+  return tchecker::zg::shared_is_le(n1.state(), n2.state());
+}
+
+/* edge_t */
+
+edge_t::edge_t(tchecker::zg::transition_t const & t) : tchecker::graph::edge_vedge_t(t.vedge_ptr()) {}
+
+/* graph_t */
+
+graph_t::graph_t(std::shared_ptr<tchecker::zg::zg_t> const & zg, std::size_t block_size, std::size_t table_size)
+    : tchecker::graph::subsumption::graph_t<tchecker::algorithms::zg_sndfs::node_t, tchecker::algorithms::zg_sndfs::edge_t,
+                                            tchecker::algorithms::zg_sndfs::node_hash_t,
+                                            tchecker::algorithms::zg_sndfs::node_le_t>(
+          block_size, table_size, tchecker::algorithms::zg_sndfs::node_hash_t(), tchecker::algorithms::zg_sndfs::node_le_t()),
+      _zg(zg)
+{
+}
+
+bool graph_t::is_actual_edge(edge_sptr_t const & e) const { return edge_type(e) == tchecker::graph::subsumption::EDGE_ACTUAL; }
+
+void graph_t::attributes(tchecker::algorithms::zg_sndfs::node_t const & n, std::map<std::string, std::string> & m) const
+{
+  _zg->attributes(n.state_ptr(), m);
+  tchecker::graph::attributes(static_cast<tchecker::graph::node_flags_t const &>(n), m);
+}
+
+void graph_t::attributes(tchecker::algorithms::zg_sndfs::edge_t const & e, std::map<std::string, std::string> & m) const
+{
+  m["vedge"] = tchecker::to_string(e.vedge(), _zg->system().as_system_system());
+}
+
+/* dot_output */
+
+/*!
+ \class node_lexical_less_t
+ \brief Less-than order on nodes based on lexical ordering
+*/
+class node_lexical_less_t {
+public:
+  /*!
+   \brief Less-than order on nodes based on lexical ordering
+   \param n1 : a node
+   \param n2 : a node
+   \return true if n1 is less-than n2 w.r.t. lexical ordering over the states in
+   the nodes
+  */
+  bool operator()(tchecker::algorithms::zg_sndfs::graph_t::node_sptr_t const & n1,
+                  tchecker::algorithms::zg_sndfs::graph_t::node_sptr_t const & n2) const
+  {
+    int state_cmp = tchecker::zg::lexical_cmp(n1->state(), n2->state());
+    if (state_cmp != 0)
+      return (state_cmp < 0);
+    return (tchecker::graph::lexical_cmp(static_cast<tchecker::graph::node_flags_t const &>(*n1),
+                                         static_cast<tchecker::graph::node_flags_t const &>(*n2)) < 0);
+  }
+};
+
+/*!
+ \class edge_lexical_less_t
+ \brief Less-than ordering on edges based on lexical ordering
+ */
+class edge_lexical_less_t {
+public:
+  /*!
+   \brief Less-than ordering on edges based on lexical ordering
+   \param e1 : an edge
+   \param e2 : an edge
+   \return true if e1 is less-than e2 w.r.t. the tuple of edges in e1 and e2
+  */
+  bool operator()(tchecker::algorithms::zg_sndfs::graph_t::edge_sptr_t const & e1,
+                  tchecker::algorithms::zg_sndfs::graph_t::edge_sptr_t const & e2) const
+  {
+    return tchecker::lexical_cmp(e1->vedge(), e2->vedge()) < 0;
+  }
+};
+
+std::ostream & dot_output(std::ostream & os, tchecker::algorithms::zg_sndfs::graph_t const & g, std::string const & name)
+{
+  return tchecker::graph::subsumption::dot_output<tchecker::algorithms::zg_sndfs::graph_t,
+                                                  tchecker::algorithms::zg_sndfs::node_lexical_less_t,
+                                                  tchecker::algorithms::zg_sndfs::edge_lexical_less_t>(os, g, name);
+}
+
+std::ostream & binary_output(std::ostream & os, tchecker::algorithms::zg_sndfs::graph_t const & g, std::string const & name)
+{
+  return tchecker::graph::binary::output<tchecker::algorithms::zg_sndfs::graph_t,
+                                         tchecker::algorithms::zg_sndfs::node_lexical_less_t,
+                                         tchecker::algorithms::zg_sndfs::edge_lexical_less_t>(os, g, g.zg().system(), name);
+}
+
+/* state_space_t */
+
+state_space_t::state_space_t(std::shared_ptr<tchecker::zg::zg_t> const & zg, std::size_t block_size, std::size_t table_size)
+    : _ss(zg, zg, block_size, table_size)
+{
+}
+
+tchecker::zg::zg_t & state_space_t::zg() { return _ss.ts(); }
+
+tchecker::algorithms::zg_sndfs::graph_t & state_space_t::graph() { return _ss.state_space(); }
+
+/* run */
+
+std::tuple<tchecker::algorithms::sndfs::stats_t, std::shared_ptr<tchecker::algorithms::zg_sndfs::state_space_t>>
+run(tchecker::parsing::system_declaration_t const & sysdecl, std::string const & labels, std::size_t block_size,
+    std::size_t table_size, tchecker::progress_t * progress)
+{
+  std::shared_ptr<tchecker::ta::system_t const> system{new tchecker::ta::system_t{sysdecl}};
+  if (!tchecker::system::every_process_has_initial_location(system->as_system_system()))
+    std::cerr << tchecker::log_warning << "system has no initial state" << std::endl;
+
+  std::shared_ptr<tchecker::zg::zg_t> zg{tchecker::zg::factory(system, tchecker::ts::SHARING, tchecker::zg::ELAPSED_SEMANTICS,
+                                                               tchecker::zg::EXTRA_LU_PLUS_LOCAL, block_size, table_size)};
+
+  std::shared_ptr<tchecker::algorithms::zg_sndfs::state_space_t> state_space =
+      std::make_shared<tchecker::algorithms::zg_sndfs::state_space_t>(zg, block_size, table_size);
+
+  boost::dynamic_bitset<> accepting_labels = system->as_syncprod_system().labels(labels);
+
+  tchecker::algorithms::zg_sndfs::algorithm_t algorithm;
+
+  tchecker::algorithms::sndfs::stats_t stats =
+      algorithm.run(state_space->zg(), state_space->graph(), accepting_labels, progress);
+
+  return std::make_tuple(stats, state_space);
+}
+
+} // namespace zg_sndfs
+
+} // namespace algorithms
+
+} // end of namespace tchecker
@@ -0,0 +1,62 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <sstream>
+
+#include "tchecker/algorithms/swarm/stats.hh"
+
+namespace tchecker {
+
+namespace algorithms {
+
+namespace swarm {
+
+stats_t::stats_t() : _prefix("SWARM"), _instances(0), _reachable(false), _winner("") {}
+
+unsigned long & stats_t::instances() { return _instances; }
+
+unsigned long stats_t::instances() const { return _instances; }
+
+bool & stats_t::reachable() { return _reachable; }
+
+bool stats_t::reachable() const { return _reachable; }
+
+std::string & stats_t::winner() { return _winner; }
+
+std::string const & stats_t::winner() const { return _winner; }
+
+std::map<std::string, std::string> & stats_t::winner_attributes() { return _winner_attributes; }
+
+std::map<std::string, std::string> const & stats_t::winner_attributes() const { return _winner_attributes; }
+
+std::string & stats_t::prefix() { return _prefix; }
+
+std::string const & stats_t::prefix() const { return _prefix; }
+
+void stats_t::attributes(std::map<std::string, std::string> & m) const
+{
+  for (auto && [key, value] : _winner_attributes)
+    m[key] = value;
+
+  tchecker::algorithms::stats_t::attributes(m);
+
+  std::stringstream sstream;
+  sstream << _instances;
+  m[_prefix + "_INSTANCES"] = sstream.str();
+
+  m[_prefix + "_WINNER"] = _winner;
+
+  sstream.str("");
+  sstream << std::boolalpha << _reachable;
+  m["REACHABLE"] = sstream.str();
+}
+
+} // namespace swarm
+
+} // end of namespace algorithms
+
+} // end of namespace tchecker
@@ -0,0 +1,491 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <exception>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+#include <boost/dynamic_bitset.hpp>
+
+#include "tchecker/algorithms/alu_covreach/zg-aLU-covreach.hh"
+#include "tchecker/algorithms/concur19/concur19.hh"
+#include "tchecker/algorithms/covreach/zg-covreach.hh"
+#include "tchecker/algorithms/reach/zg-reach.hh"
+#include "tchecker/algorithms/search_order.hh"
+#include "tchecker/algorithms/swarm/zg-swarm.hh"
+#include "tchecker/clockbounds/solver.hh"
+#include "tchecker/system/static_analysis.hh"
+#include "tchecker/ta/system.hh"
+#include "tchecker/utils/log.hh"
+#include "tchecker/waiting/cancellable.hh"
+
+namespace tchecker {
+
+namespace algorithms {
+
+namespace zg_swarm {
+
+std::string to_string(enum tchecker::algorithms::zg_swarm::engine_t engine)
+{
+  switch (engine) {
+  case tchecker::algorithms::zg_swarm::ENGINE_REACH:
+    return "reach";
+  case tchecker::algorithms::zg_swarm::ENGINE_COVREACH:
+    return "covreach";
+  case tchecker::algorithms::zg_swarm::ENGINE_ALU_COVREACH:
+    return "aLU-covreach";
+  case tchecker::algorithms::zg_swarm::ENGINE_CONCUR19:
+    return "concur19";
+  default:
+    throw std::invalid_argument("Unknown swarm engine");
+  }
+}
+
+/* instance_t */
+
+instance_t::instance_t(enum tchecker::algorithms::zg_swarm::engine_t engine, std::string const & search_order,
+                       unsigned int seed)
+    : _engine(engine), _search_order(search_order), _seed(seed)
+{
+}
+
+std::string instance_t::description() const
+{
+  std::stringstream sstream;
+  sstream << tchecker::algorithms::zg_swarm::to_string(_engine) << "/" << _search_order << "/seed=" << _seed;
+  return sstream.str();
+}
+
+/*!
+ \class search_instance_t
+ \brief Instance that owns a state-space, accepting labels and statistics
+ \tparam STATE_SPACE : type of state-space
+ \tparam STATS : type of statistics
+ */
+template <class STATE_SPACE, class STATS> class search_instance_t : public tchecker::algorithms::zg_swarm::instance_t {
+public:
+  /*!
+   \brief Constructor
+   \param engine : reachability engine
+   \param search_order : search order
+   \param seed : seed of edge order randomization
+   \param state_space : state-space
+   \param labels : accepting labels
+   */
+  search_instance_t(enum tchecker::algorithms::zg_swarm::engine_t engine, std::string const & search_order, unsigned int seed,
+                    std::shared_ptr<STATE_SPACE> const & state_space, boost::dynamic_bitset<> const & labels)
+      : tchecker::algorithms::zg_swarm::instance_t(engine, search_order, seed), _state_space(state_space), _labels(labels)
+  {
+  }
+
+  virtual bool reachable() const { return _stats.reachable(); }
+
+  virtual void attributes(std::map<std::string, std::string> & m) const { _stats.attributes(m); }
+
+protected:
+  std::shared_ptr<STATE_SPACE> _state_space; /*!< State-space */
+  boost::dynamic_bitset<> _labels;           /*!< Accepting labels */
+  STATS _stats;                              /*!< Statistics of last run */
+};
+
+/*!
+ \brief Check that a counter-example has been computed
+ \tparam CEX : type of counter-example
+ \param cex : counter-example
+ \param kind : kind of counter-example (for error reporting)
+ \throw std::runtime_error : if cex is empty
+ */
+template <class CEX> static void check_counter_example(std::unique_ptr<CEX> const & cex, std::string const & kind)
+{
+  if (cex->empty())
+    throw std::runtime_error("Unable to compute a " + kind + " counter example");
+}
+
+/*!
+ \class reach_instance_t
+ \brief Instance of the reachability algorithm
+ */
+class reach_instance_t final
+    : public search_instance_t<tchecker::algorithms::zg_reach::state_space_t, tchecker::algorithms::reach::stats_t> {
+public:
+  using search_instance_t<tchecker::algorithms::zg_reach::state_space_t, tchecker::algorithms::reach::stats_t>::search_instance_t;
+
+  virtual bool run(std::atomic<bool> const & cancel)
+  {
+    using node_sptr_t = tchecker::algorithms::zg_reach::graph_t::node_sptr_t;
+    tchecker::waiting::cancellable_t<node_sptr_t> waiting{
+        tchecker::waiting::factory<node_sptr_t>(tchecker::algorithms::waiting_policy(search_order())), cancel};
+
+    tchecker::algorithms::zg_reach::algorithm_t algorithm;
+    algorithm.insert_initial_nodes(_state_space->zg(), _state_space->graph(), waiting);
+    _stats = algorithm.run(_state_space->zg(), _state_space->graph(), _labels, waiting);
+    return !waiting.cancelled();
+  }
+
+  virtual void dot_graph(std::ostream & os, std::string const & name)
+  {
+    tchecker::algorithms::zg_reach::dot_output(os, _state_space->graph(), name);
+  }
+
+  virtual void dot_symbolic_counter_example(std::ostream & os, std::string const & name)
+  {
+    std::unique_ptr<tchecker::algorithms::zg_reach::cex::symbolic_cex_t> cex{
+        tchecker::algorithms::zg_reach::cex::symbolic_counter_example(_state_space->graph())};
+    check_counter_example(cex, "symbolic");
+    tchecker::algorithms::zg_reach::cex::dot_output(os, *cex, name);
+  }
+
+  virtual void dot_concrete_counter_example(std::ostream & os, std::string const & name)
+  {
+    std::unique_ptr<tchecker::algorithms::zg_reach::cex::concrete_cex_t> cex{
+        tchecker::algorithms::zg_reach::cex::concrete_counter_example(_state_space->graph())};
+    check_counter_example(cex, "concrete");
+    tchecker::algorithms::zg_reach::cex::dot_output(os, *cex, name);
+  }
+};
+
+/*!
+ \brief Accessors to the transition system of a state-space
+ \param state_space : state-space
+ \return the transition system in state_space
+ */
+static tchecker::zg::zg_t & transition_system(tchecker::algorithms::zg_covreach::state_space_t & state_space)
+{
+  return state_space.zg();
+}
+
+static tchecker::zg::zg_t & transition_system(tchecker::tck_reach::zg_alu_covreach::state_space_t & state_space)
+{
+  return state_space.zg();
+}
+
+static tchecker::refzg::refzg_t & transition_system(tchecker::algorithms::concur19::state_space_t & state_space)
+{
+  return state_space.refzg();
+}
+
+/*!
+ \class covreach_instance_t
+ \brief Instance of a covering reachability algorithm
+ \tparam STATE_SPACE : type of state-space
+ \tparam ALGORITHM : type of covering reachability algorithm
+ */
+template <class STATE_SPACE, class ALGORITHM>
+class covreach_instance_t : public search_instance_t<STATE_SPACE, tchecker::algorithms::covreach::stats_t> {
+public:
+  /*!
+   \brief Constructor
+   \param engine : reachability engine
+   \param search_order : search order
+   \param seed : seed of edge order randomization
+   \param state_space : state-space
+   \param labels : accepting labels
+   \param covering : covering policy
+   */
+  covreach_instance_t(enum tchecker::algorithms::zg_swarm::engine_t engine, std::string const & search_order, unsigned int seed,
+                      std::shared_ptr<STATE_SPACE> const & state_space, boost::dynamic_bitset<> const & labels,
+                      tchecker::algorithms::covreach::covering_t covering)
+      : search_instance_t<STATE_SPACE, tchecker::algorithms::covreach::stats_t>(engine, search_order, seed, state_space, labels),
+        _covering(covering)
+  {
+  }
+
+  virtual bool run(std::atomic<bool> const & cancel)
+  {
+    using node_sptr_t = typename ALGORITHM::node_sptr_t;
+    tchecker::waiting::cancellable_t<node_sptr_t> waiting{
+        tchecker::waiting::factory<node_sptr_t>(tchecker::algorithms::fast_remove_waiting_policy(this->search_order())),
+        cancel};
+
+    ALGORITHM algorithm;
+    if (_covering == tchecker::algorithms::covreach::COVERING_FULL)
+      this->_stats = algorithm.template run<tchecker::algorithms::covreach::COVERING_FULL>(
+          transition_system(*this->_state_space), this->_state_space->graph(), this->_labels, waiting);
+    else if (_covering == tchecker::algorithms::covreach::COVERING_LEAF_NODES)
+      this->_stats = algorithm.template run<tchecker::algorithms::covreach::COVERING_LEAF_NODES>(
+          transition_system(*this->_state_space), this->_state_space->graph(), this->_labels, waiting);
+    else
+      throw std::invalid_argument("Unknown covering policy for covreach algorithm");
+    return !waiting.cancelled();
+  }
+
+private:
+  tchecker::algorithms::covreach::covering_t _covering; /*!< Covering policy */
+};
+
+/*!
+ \class zg_covreach_instance_t
+ \brief Instance of the covering reachability algorithm
+ */
+class zg_covreach_instance_t final
+    : public covreach_instance_t<tchecker::algorithms::zg_covreach::state_space_t, tchecker::algorithms::zg_covreach::algorithm_t> {
+public:
+  using covreach_instance_t<tchecker::algorithms::zg_covreach::state_space_t,
+                            tchecker::algorithms::zg_covreach::algorithm_t>::covreach_instance_t;
+
+  virtual void dot_graph(std::ostream & os, std::string const & name)
+  {
+    tchecker::algorithms::zg_covreach::dot_output(os, _state_space->graph(), name);
+  }
+
+  virtual void dot_symbolic_counter_example(std::ostream & os, std::string const & name)
+  {
+    std::unique_ptr<tchecker::algorithms::zg_covreach::cex::symbolic_cex_t> cex{
+        tchecker::algorithms::zg_covreach::cex::symbolic_counter_example(_state_space->graph())};
+    check_counter_example(cex, "symbolic");
+    tchecker::algorithms::zg_covreach::cex::dot_output(os, *cex, name);
+  }
+
+  virtual void dot_concrete_counter_example(std::ostream & os, std::string const & name)
+  {
+    std::unique_ptr<tchecker::algorithms::zg_covreach::cex::concrete_cex_t> cex{
+        tchecker::algorithms::zg_covreach::cex::concrete_counter_example(_state_space->graph())};
+    check_counter_example(cex, "concrete");
+    tchecker::algorithms::zg_covreach::cex::dot_output(os, *cex, name);
+  }
+};
+
+/*!
+ \class zg_alu_covreach_instance_t
+ \brief Instance of the covering reachability algorithm with aLU subsumption
+ */
+class zg_alu_covreach_instance_t final
+    : public covreach_instance_t<tchecker::tck_reach::zg_alu_covreach::state_space_t,
+                                 tchecker::tck_reach::zg_alu_covreach::algorithm_t> {
+public:
+  using covreach_instance_t<tchecker::tck_reach::zg_alu_covreach::state_space_t,
+                            tchecker::tck_reach::zg_alu_covreach::algorithm_t>::covreach_instance_t;
+
+  virtual void dot_graph(std::ostream & os, std::string const & name)
+  {
+    tchecker::tck_reach::zg_alu_covreach::dot_output(os, _state_space->graph(), name);
+  }
+
+  virtual void dot_symbolic_counter_example(std::ostream & os, std::string const & name)
+  {
+    std::unique_ptr<tchecker::tck_reach::zg_alu_covreach::cex::symbolic_cex_t> cex{
+        tchecker::tck_reach::zg_alu_covreach::cex::symbolic_counter_example(_state_space->graph())};
+    check_counter_example(cex, "symbolic");
+    tchecker::tck_reach::zg_alu_covreach::cex::dot_output(os, *cex, name);
+  }
+
+  virtual void dot_concrete_counter_example(std::ostream & os, std::string const & name)
+  {
+    std::unique_ptr<tchecker::tck_reach::zg_alu_covreach::cex::concrete_cex_t> cex{
+        tchecker::tck_reach::zg_alu_covreach::cex::concrete_counter_example(_state_space->graph())};
+    check_counter_example(cex, "concrete");
+    tchecker::tck_reach::zg_alu_covreach::cex::dot_output(os, *cex, name);
+  }
+};
+
+/*!
+ \class concur19_instance_t
+ \brief Instance of the covering reachability algorithm over the local-time zone graph
+ */
+class concur19_instance_t final
+    : public covreach_instance_t<tchecker::algorithms::concur19::state_space_t, tchecker::algorithms::concur19::algorithm_t> {
+public:
+  using covreach_instance_t<tchecker::algorithms::concur19::state_space_t,
+                            tchecker::algorithms::concur19::algorithm_t>::covreach_instance_t;
+
+  virtual void dot_graph(std::ostream & os, std::string const & name)
+  {
+    tchecker::algorithms::concur19::dot_output(os, _state_space->graph(), name);
+  }
+
+  virtual void dot_symbolic_counter_example(std::ostream & os, std::string const & name)
+  {
+    std::unique_ptr<tchecker::algorithms::concur19::cex::symbolic::cex_t> cex{
+        tchecker::algorithms::concur19::cex::symbolic::counter_example(_state_space->graph())};
+    check_counter_example(cex, "symbolic");
+    tchecker::algorithms::concur19::cex::symbolic::dot_output(os, *cex, name);
+  }
+
+  virtual void dot_concrete_counter_example(std::ostream & os, std::string const & name)
+  {
+    throw std::runtime_error("Concrete counter-example is not available for concur19 algorithm");
+  }
+};
+
+/* make_instance */
+
+std::shared_ptr<tchecker::algorithms::zg_swarm::instance_t>
+make_instance(enum tchecker::algorithms::zg_swarm::engine_t engine,
+              std::shared_ptr<tchecker::parsing::system_declaration_t> const & sysdecl, std::string const & labels,
+              std::string const & search_order, unsigned int seed, tchecker::algorithms::covreach::covering_t covering,
+              std::size_t block_size, std::size_t table_size)
+{
+  if (search_order != "bfs" && search_order != "dfs")
+    throw std::invalid_argument("Unknown search order: " + search_order);
+
+  std::shared_ptr<tchecker::ta::system_t const> system{new tchecker::ta::system_t{*sysdecl}};
+  boost::dynamic_bitset<> accepting_labels = system->as_syncprod_system().labels(labels);
+
+  if (engine == tchecker::algorithms::zg_swarm::ENGINE_CONCUR19) {
+    if (seed != 0)
+      throw std::invalid_argument("Edge order randomization is not available for concur19 algorithm");
+    std::unique_ptr<tchecker::clockbounds::clockbounds_t> clock_bounds{tchecker::clockbounds::compute_clockbounds(*system)};
+    std::shared_ptr<tchecker::refzg::refzg_t> refzg{tchecker::refzg::factory(
+        system, tchecker::ts::SHARING, tchecker::refzg::PROCESS_REFERENCE_CLOCKS, tchecker::refzg::SYNC_ELAPSED_SEMANTICS,
+        tchecker::refdbm::UNBOUNDED_SPREAD, block_size, table_size)};
+    auto state_space = std::make_shared<tchecker::algorithms::concur19::state_space_t>(refzg, clock_bounds->local_lu_map(),
+                                                                                      block_size, table_size);
+    return std::make_shared<tchecker::algorithms::zg_swarm::concur19_instance_t>(engine, search_order, seed, state_space,
+                                                                                 accepting_labels, covering);
+  }
+
+  if (engine == tchecker::algorithms::zg_swarm::ENGINE_ALU_COVREACH) {
+    std::unique_ptr<tchecker::clockbounds::clockbounds_t> clock_bounds{tchecker::clockbounds::compute_clockbounds(*system)};
+    std::shared_ptr<tchecker::zg::zg_t> zg{tchecker::zg::factory(system, tchecker::ts::SHARING,
+                                                                 tchecker::zg::ELAPSED_SEMANTICS,
+                                                                 tchecker::zg::EXTRA_LU_PLUS_LOCAL, *clock_bounds,
+                                                                 block_size, table_size)};
+    if (seed != 0)
+      zg->randomize_edge_order(seed);
+    auto state_space = std::make_shared<tchecker::tck_reach::zg_alu_covreach::state_space_t>(
+        zg, clock_bounds->local_lu_map(), block_size, table_size);
+    return std::make_shared<tchecker::algorithms::zg_swarm::zg_alu_covreach_instance_t>(engine, search_order, seed, state_space,
+                                                                                        accepting_labels, covering);
+  }
+
+  std::shared_ptr<tchecker::zg::zg_t> zg{tchecker::zg::factory(system, tchecker::ts::SHARING, tchecker::zg::ELAPSED_SEMANTICS,
+                                                               tchecker::zg::EXTRA_LU_PLUS_LOCAL, block_size, table_size)};
+  if (seed != 0)
+    zg->randomize_edge_order(seed);
+
+  if (engine == tchecker::algorithms::zg_swarm::ENGINE_REACH) {
+    auto state_space = std::make_shared<tchecker::algorithms::zg_reach::state_space_t>(zg, block_size, table_size);
+    return std::make_shared<tchecker::algorithms::zg_swarm::reach_instance_t>(engine, search_order, seed, state_space,
+                                                                              accepting_labels);
+  }
+
+  if (engine == tchecker::algorithms::zg_swarm::ENGINE_COVREACH) {
+    auto state_space = std::make_shared<tchecker::algorithms::zg_covreach::state_space_t>(zg, block_size, table_size);
+    return std::make_shared<tchecker::algorithms::zg_swarm::zg_covreach_instance_t>(engine, search_order, seed, state_space,
+                                                                                    accepting_labels, covering);
+  }
+
+  throw std::invalid_argument("Unknown swarm engine");
+}
+
+/* race */
+
+std::tuple<tchecker::algorithms::swarm::stats_t, std::shared_ptr<tchecker::algorithms::zg_swarm::instance_t>>
+race(std::vector<std::shared_ptr<tchecker::algorithms::zg_swarm::instance_t>> const & instances)
+{
+  if (instances.empty())
+    throw std::invalid_argument("No instance to run");
+
+  tchecker::algorithms::swarm::stats_t stats;
+  stats.set_start_time();
+
+  std::atomic<bool> stop{false};
+  std::atomic<long> winner{-1};
+  std::vector<std::exception_ptr> errors(instances.size(), nullptr);
+
+  std::vector<std::thread> threads;
+  threads.reserve(instances.size());
+  for (std::size_t i = 0; i < instances.size(); ++i)
+    threads.emplace_back([&, i]() {
+      try {
+        if (instances[i]->run(stop)) {
+          long expected = -1;
+          if (winner.compare_exchange_strong(expected, static_cast<long>(i)))
+            stop.store(true);
+        }
+      }
+      catch (...) {
+        errors[i] = std::current_exception();
+        stop.store(true);
+      }
+    });
+
+  for (std::thread & t : threads)
+    t.join();
+
+  stats.set_end_time();
+
+  if (winner.load() == -1) {
+    for (std::exception_ptr const & e : errors)
+      if (e != nullptr)
+        std::rethrow_exception(e);
+    throw std::runtime_error("No swarm instance has terminated");
+  }
+
+  std::shared_ptr<tchecker::algorithms::zg_swarm::instance_t> const & w = instances[winner.load()];
+  stats.instances() = instances.size();
+  stats.reachable() = w->reachable();
+  stats.winner() = w->description();
+  w->attributes(stats.winner_attributes());
+
+  return std::make_tuple(stats, w);
+}
+
+/* run */
+
+std::tuple<tchecker::algorithms::swarm::stats_t, std::shared_ptr<tchecker::algorithms::zg_swarm::instance_t>>
+run(std::shared_ptr<tchecker::parsing::system_declaration_t> const & sysdecl, std::string const & labels,
+    std::size_t instances, std::vector<enum tchecker::algorithms::zg_swarm::engine_t> const & engines,
+    tchecker::algorithms::covreach::covering_t covering, std::size_t block_size, std::size_t table_size)
+{
+  if (instances == 0)
+    throw std::invalid_argument("Swarm needs at least one instance");
+
+  if (engines.empty())
+    throw std::invalid_argument("Swarm needs at least one engine");
+
+  {
+    tchecker::ta::system_t system{*sysdecl};
+    if (!tchecker::system::every_process_has_initial_location(system.as_system_system()))
+      std::cerr << tchecker::log_warning << "system has no initial state" << std::endl;
+  }
+
+  // Instances are built in this thread since building a system is not thread-safe
+  std::size_t const n = engines.size();
+  std::vector<std::shared_ptr<tchecker::algorithms::zg_swarm::instance_t>> swarm;
+  for (std::size_t i = 0; i < instances; ++i)
+    swarm.push_back(tchecker::algorithms::zg_swarm::make_instance(engines[i % n], sysdecl, labels,
+                                                                  ((i / n) % 2 == 0 ? "bfs" : "dfs"),
+                                                                  static_cast<unsigned int>(i), covering, block_size,
+                                                                  table_size));
+
+  return tchecker::algorithms::zg_swarm::race(swarm);
+}
+
+/* portfolio */
+
+std::tuple<tchecker::algorithms::swarm::stats_t, std::shared_ptr<tchecker::algorithms::zg_swarm::instance_t>>
+portfolio(std::shared_ptr<tchecker::parsing::system_declaration_t> const & sysdecl, std::string const & labels,
+          std::vector<enum tchecker::algorithms::zg_swarm::engine_t> const & engines, std::string const & search_order,
+          tchecker::algorithms::covreach::covering_t covering, std::size_t block_size, std::size_t table_size)
+{
+  if (engines.empty())
+    throw std::invalid_argument("Portfolio needs at least one engine");
+
+  {
+    tchecker::ta::system_t system{*sysdecl};
+    if (!tchecker::system::every_process_has_initial_location(system.as_system_system()))
+      std::cerr << tchecker::log_warning << "system has no initial state" << std::endl;
+  }
+
+  // Instances are built in this thread since building a system is not thread-safe
+  std::vector<std::shared_ptr<tchecker::algorithms::zg_swarm::instance_t>> instances;
+  for (enum tchecker::algorithms::zg_swarm::engine_t engine : engines)
+    instances.push_back(tchecker::algorithms::zg_swarm::make_instance(engine, sysdecl, labels, search_order, 0, covering,
+                                                                      block_size, table_size));
+
+  auto result = tchecker::algorithms::zg_swarm::race(instances);
+  std::get<0>(result).prefix() = "PORTFOLIO";
+  return result;
+}
+
+} // namespace zg_swarm
+
+} // namespace algorithms
+
+} // end of namespace tchecker
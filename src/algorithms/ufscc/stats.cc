@@ -0,0 +1,37 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <sstream>
+
+#include "tchecker/algorithms/ufscc/stats.hh"
+
+namespace tchecker {
+
+namespace algorithms {
+
+namespace ufscc {
+
+stats_t::stats_t() : _threads(0) {}
+
+unsigned int & stats_t::threads() { return _threads; }
+
+unsigned int stats_t::threads() const { return _threads; }
+
+void stats_t::attributes(std::map<std::string, std::string> & m) const
+{
+  tchecker::algorithms::couvscc::stats_t::attributes(m);
+
+  std::stringstream sstream;
+  sstream << _threads;
+  m["THREADS"] = sstream.str();
+}
+
+} // namespace ufscc
+
+} // end of namespace algorithms
+
+} // end of namespace tchecker
@@ -0,0 +1,77 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <thread>
+#include <vector>
+
+#include <boost/dynamic_bitset.hpp>
+
+#include "tchecker/system/static_analysis.hh"
+#include "tchecker/ta/system.hh"
+#include "tchecker/utils/log.hh"
+#include "tchecker/algorithms/ufscc/zg-ufscc.hh"
+
+namespace tchecker {
+
+namespace algorithms {
+
+namespace zg_ufscc {
+
+/* state_hash_t */
+
+std::size_t state_hash_t::operator()(tchecker::zg::state_sptr_t const & s) const { return tchecker::zg::hash_value(*s); }
+
+/* state_equal_to_t */
+
+bool state_equal_to_t::operator()(tchecker::zg::state_sptr_t const & s1, tchecker::zg::state_sptr_t const & s2) const
+{
+  return *s1 == *s2;
+}
+
+/* state_copy_t */
+
+tchecker::zg::state_sptr_t state_copy_t::operator()(tchecker::zg::zg_t & zg, tchecker::zg::state_sptr_t const & s) const
+{
+  return zg.create_state(s->vloc(), s->intval(), s->zone());
+}
+
+/* run */
+
+tchecker::algorithms::ufscc::stats_t run(tchecker::parsing::system_declaration_t const & sysdecl, std::string const & labels,
+                                         std::size_t threads, std::size_t block_size, std::size_t table_size,
+                                         tchecker::progress_t * progress)
+{
+  if (threads == 0)
+    threads = std::max(1U, std::thread::hardware_concurrency());
+  if (threads > tchecker::algorithms::ufscc::MAX_WORKERS)
+    throw std::invalid_argument("Too many threads for ufscc algorithm");
+
+  std::shared_ptr<tchecker::ta::system_t const> system{new tchecker::ta::system_t{sysdecl}};
+  if (!tchecker::system::every_process_has_initial_location(system->as_system_system()))
+    std::cerr << tchecker::log_warning << "system has no initial state" << std::endl;
+
+  // Systems embed a bytecode interpreter, hence each worker has its own system
+  std::vector<std::shared_ptr<tchecker::zg::zg_t>> zgs;
+  for (std::size_t i = 0; i < threads; ++i) {
+    std::shared_ptr<tchecker::ta::system_t const> worker_system{(i == 0 ? system
+                                                                        : std::make_shared<tchecker::ta::system_t>(sysdecl))};
+    zgs.emplace_back(tchecker::zg::factory(worker_system, tchecker::ts::SHARING, tchecker::zg::ELAPSED_SEMANTICS,
+                                           tchecker::zg::EXTRA_LU_PLUS_LOCAL, block_size, table_size));
+  }
+
+  boost::dynamic_bitset<> accepting_labels = system->as_syncprod_system().labels(labels);
+
+  tchecker::algorithms::zg_ufscc::algorithm_t algorithm;
+
+  return algorithm.run(zgs, accepting_labels, table_size, progress);
+}
+
+} // namespace zg_ufscc
+
+} // namespace algorithms
+
+} // end of namespace tchecker
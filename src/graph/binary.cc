@@ -0,0 +1,431 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <cerrno>
+#include <cstring>
+#include <limits>
+#include <sstream>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "tchecker/dbm/dbm.hh"
+#include "tchecker/graph/binary.hh"
+#include "tchecker/graph/output.hh"
+
+namespace tchecker {
+
+namespace graph {
+
+namespace binary {
+
+static char const MAGIC[8] = {'T', 'C', 'K', 'G', 'R', 'A', 'P', 'H'}; /*!< File signature */
+
+/*!
+ \brief Round a size
+ \param size : a size
+ \param unit : a unit
+ \return the smallest multiple of unit that is greater than or equal to size
+ */
+static std::uint64_t round_up(std::uint64_t size, std::uint64_t unit) { return ((size + unit - 1) / unit) * unit; }
+
+/*!
+ \brief Output padding
+ \param os : output stream
+ \param size : number of bytes output so far
+ \post zero bytes have been output to os up to the next multiple of 8
+ */
+static void output_padding(std::ostream & os, std::uint64_t size)
+{
+  static char const zeros[8] = {0};
+  os.write(zeros, round_up(size, 8) - size);
+}
+
+/*!
+ \brief Output a section
+ \param os : output stream
+ \param v : vector of values
+ \post the values in v have been output to os, followed by padding
+ */
+template <class T> static void output_section(std::ostream & os, std::vector<T> const & v)
+{
+  os.write(reinterpret_cast<char const *>(v.data()), v.size() * sizeof(T));
+  output_padding(os, v.size() * sizeof(T));
+}
+
+/* writer_t */
+
+writer_t::writer_t(tchecker::ta::system_t const & system, std::string const & name, std::size_t nodes_count)
+    : _nodes_output(0)
+{
+  std::memset(&_header, 0, sizeof(_header));
+  std::memcpy(_header.magic, MAGIC, sizeof(MAGIC));
+  _header.version = tchecker::graph::binary::VERSION;
+  _header.byte_order = tchecker::graph::binary::BYTE_ORDER_MARK;
+  _header.loc_id_size = sizeof(tchecker::loc_id_t);
+  _header.integer_size = sizeof(tchecker::integer_t);
+  _header.db_size = sizeof(tchecker::dbm::db_t);
+  _header.name = intern(name);
+  _header.processes_count = system.processes_count();
+  _header.intvars_count = system.intvars_count(tchecker::VK_FLATTENED);
+  _header.dim = system.clocks_count(tchecker::VK_FLATTENED) + 1;
+  _header.locations_count = system.locations_count();
+  _header.nodes_count = nodes_count;
+
+  // node records layout
+  _header.node_vloc = sizeof(tchecker::graph::binary::node_record_t);
+  _header.node_intval =
+      round_up(_header.node_vloc + _header.processes_count * sizeof(tchecker::loc_id_t), alignof(tchecker::integer_t));
+  _header.node_dbm =
+      round_up(_header.node_intval + _header.intvars_count * sizeof(tchecker::integer_t), alignof(tchecker::dbm::db_t));
+  _header.node_size = round_up(_header.node_dbm + _header.dim * _header.dim * sizeof(tchecker::dbm::db_t), 8);
+  _record.resize(_header.node_size);
+
+  // names
+  for (tchecker::loc_id_t id = 0; id < _header.locations_count; ++id)
+    _locations.push_back(intern(system.location(id)->name()));
+
+  auto const & intvars_index = system.integer_variables().flattened().index();
+  for (tchecker::intvar_id_t id = 0; id < _header.intvars_count; ++id)
+    _intvars.push_back(intern(intvars_index.value(id)));
+
+  auto const & clocks_index = system.clock_variables().flattened().index();
+  for (tchecker::clock_id_t id = 0; id < _header.dim - 1; ++id)
+    _clocks.push_back(intern(clocks_index.value(id)));
+
+  _edges_index.reserve(nodes_count + 1);
+  _edges_index.push_back(0);
+}
+
+std::uint32_t writer_t::intern(std::string const & s)
+{
+  auto && [it, inserted] = _strings_map.emplace(s, _strings.size());
+  if (inserted) {
+    if (_strings.size() == std::numeric_limits<std::uint32_t>::max())
+      throw std::runtime_error("tchecker::graph::binary::writer_t: too many strings");
+    _strings.push_back(&it->first);
+  }
+  return it->second;
+}
+
+void writer_t::add_edge(std::uint64_t src, std::uint64_t tgt, std::map<std::string, std::string> const & attr)
+{
+  if (src >= _header.nodes_count || tgt >= _header.nodes_count)
+    throw std::invalid_argument("tchecker::graph::binary::writer_t: unknown node");
+  if (src + 2 < _edges_index.size())
+    throw std::invalid_argument("tchecker::graph::binary::writer_t: edges are not sorted w.r.t. source node");
+
+  while (_edges_index.size() <= src + 1)
+    _edges_index.push_back(_edges.size());
+
+  _edges.push_back(tchecker::graph::binary::edge_record_t{src, tgt, _attributes.size(), attr.size()});
+  for (auto && [key, value] : attr)
+    _attributes.push_back(tchecker::graph::binary::attribute_record_t{intern(key), intern(value)});
+  _edges_index.back() = _edges.size();
+}
+
+void writer_t::output_header(std::ostream & os)
+{
+  while (_edges_index.size() <= _header.nodes_count)
+    _edges_index.push_back(_edges.size());
+
+  _header.edges_count = _edges.size();
+  _header.attributes_count = _attributes.size();
+  _header.strings_count = _strings.size();
+
+  std::uint64_t strings_size = 0;
+  for (std::string const * s : _strings)
+    strings_size += s->size() + 1;
+
+  _header.nodes_offset = round_up(sizeof(_header), 8);
+  _header.edges_index_offset = _header.nodes_offset + _header.nodes_count * _header.node_size;
+  _header.edges_offset = _header.edges_index_offset + round_up(_edges_index.size() * sizeof(std::uint64_t), 8);
+  _header.attributes_offset =
+      _header.edges_offset + round_up(_edges.size() * sizeof(tchecker::graph::binary::edge_record_t), 8);
+  _header.locations_offset =
+      _header.attributes_offset + round_up(_attributes.size() * sizeof(tchecker::graph::binary::attribute_record_t), 8);
+  _header.intvars_offset = _header.locations_offset + round_up(_locations.size() * sizeof(std::uint32_t), 8);
+  _header.clocks_offset = _header.intvars_offset + round_up(_intvars.size() * sizeof(std::uint32_t), 8);
+  _header.strings_index_offset = _header.clocks_offset + round_up(_clocks.size() * sizeof(std::uint32_t), 8);
+  _header.strings_offset = _header.strings_index_offset + round_up((_strings.size() + 1) * sizeof(std::uint64_t), 8);
+  _header.file_size = _header.strings_offset + round_up(strings_size, 8);
+
+  os.write(reinterpret_cast<char const *>(&_header), sizeof(_header));
+  output_padding(os, sizeof(_header));
+}
+
+void writer_t::output_node(std::ostream & os, std::uint32_t flags, std::uint32_t labels, tchecker::zg::state_t const & s)
+{
+  std::fill(_record.begin(), _record.end(), 0);
+
+  auto * record = reinterpret_cast<tchecker::graph::binary::node_record_t *>(_record.data());
+  record->flags = flags;
+  record->labels = labels;
+
+  auto * vloc = reinterpret_cast<tchecker::loc_id_t *>(_record.data() + _header.node_vloc);
+  for (tchecker::loc_id_t id : s.vloc())
+    *vloc++ = id;
+
+  auto * intval = reinterpret_cast<tchecker::integer_t *>(_record.data() + _header.node_intval);
+  for (tchecker::integer_t v : s.intval())
+    *intval++ = v;
+
+  tchecker::zg::zone_t const & z = s.zone();
+  std::memcpy(_record.data() + _header.node_dbm, z.dbm(), z.dim() * z.dim() * sizeof(tchecker::dbm::db_t));
+
+  os.write(_record.data(), _record.size());
+  ++_nodes_output;
+}
+
+void writer_t::output_footer(std::ostream & os)
+{
+  if (_nodes_output != _header.nodes_count)
+    throw std::runtime_error("tchecker::graph::binary::writer_t: wrong number of nodes");
+
+  output_section(os, _edges_index);
+  output_section(os, _edges);
+  output_section(os, _attributes);
+  output_section(os, _locations);
+  output_section(os, _intvars);
+  output_section(os, _clocks);
+
+  std::vector<std::uint64_t> strings_index;
+  strings_index.reserve(_strings.size() + 1);
+  strings_index.push_back(0);
+  for (std::string const * s : _strings)
+    strings_index.push_back(strings_index.back() + s->size() + 1);
+  output_section(os, strings_index);
+
+  for (std::string const * s : _strings)
+    os.write(s->c_str(), s->size() + 1);
+  output_padding(os, strings_index.back());
+}
+
+/* mapped_graph_t */
+
+mapped_graph_t::mapped_graph_t(std::string const & filename) : _data(nullptr), _size(0), _header(nullptr)
+{
+  int fd = ::open(filename.c_str(), O_RDONLY);
+  if (fd == -1)
+    throw std::runtime_error("Cannot open " + filename + ": " + std::strerror(errno));
+
+  struct stat st;
+  if (::fstat(fd, &st) != 0) {
+    int err = errno;
+    ::close(fd);
+    throw std::runtime_error("Cannot read " + filename + ": " + std::strerror(err));
+  }
+  if (static_cast<std::size_t>(st.st_size) < sizeof(tchecker::graph::binary::header_t)) {
+    ::close(fd);
+    throw std::runtime_error("Not a binary graph file: " + filename);
+  }
+
+  void * address = ::mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  int err = errno;
+  ::close(fd); // the mapping keeps the file open
+  if (address == MAP_FAILED)
+    throw std::runtime_error("Cannot map " + filename + ": " + std::strerror(err));
+
+  _data = static_cast<char const *>(address);
+  _size = st.st_size;
+  _header = reinterpret_cast<tchecker::graph::binary::header_t const *>(_data);
+
+  try {
+    check();
+  }
+  catch (std::runtime_error const & e) {
+    ::munmap(const_cast<char *>(_data), _size);
+    throw std::runtime_error(std::string{e.what()} + ": " + filename);
+  }
+}
+
+mapped_graph_t::~mapped_graph_t() { ::munmap(const_cast<char *>(_data), _size); }
+
+tchecker::graph::binary::node_t mapped_graph_t::node(std::uint64_t id) const
+{
+  char const * record = _data + _header->nodes_offset + id * _header->node_size;
+  std::uint32_t labels = reinterpret_cast<tchecker::graph::binary::node_record_t const *>(record)->labels;
+  return tchecker::graph::binary::node_t{record, *_header, string(labels)};
+}
+
+/*!
+ \brief Size of an array
+ \param count : number of elements
+ \param unit : size of elements
+ \param max : maximal size
+ \return count * unit
+ \throw std::runtime_error : if count * unit is greater than max
+ */
+static std::uint64_t array_size(std::uint64_t count, std::uint64_t unit, std::uint64_t max)
+{
+  if (unit != 0 && count > max / unit)
+    throw std::runtime_error("Corrupted binary graph file");
+  return count * unit;
+}
+
+void mapped_graph_t::check() const
+{
+  if (std::memcmp(_header->magic, MAGIC, sizeof(MAGIC)) != 0)
+    throw std::runtime_error("Not a binary graph file");
+  if (_header->version != tchecker::graph::binary::VERSION)
+    throw std::runtime_error("Unsupported binary graph format version");
+  if (_header->byte_order != tchecker::graph::binary::BYTE_ORDER_MARK || _header->loc_id_size != sizeof(tchecker::loc_id_t) ||
+      _header->integer_size != sizeof(tchecker::integer_t) || _header->db_size != sizeof(tchecker::dbm::db_t))
+    throw std::runtime_error("Binary graph file written by another build of TChecker");
+  if (_header->file_size != _size)
+    throw std::runtime_error("Truncated binary graph file");
+
+  // node records layout
+  std::uint64_t const dbm_size = array_size(array_size(_header->dim, _header->dim, _size), sizeof(tchecker::dbm::db_t), _size);
+  if (_header->dim < 1 || _header->node_vloc < sizeof(tchecker::graph::binary::node_record_t) ||
+      _header->node_vloc % alignof(tchecker::loc_id_t) != 0 || _header->node_intval % alignof(tchecker::integer_t) != 0 ||
+      _header->node_dbm % alignof(tchecker::dbm::db_t) != 0 || _header->node_size % 8 != 0 || _header->node_vloc > _size ||
+      _header->node_intval > _size || _header->node_dbm > _size ||
+      _header->node_intval < _header->node_vloc + array_size(_header->processes_count, sizeof(tchecker::loc_id_t), _size) ||
+      _header->node_dbm < _header->node_intval + array_size(_header->intvars_count, sizeof(tchecker::integer_t), _size) ||
+      _header->node_size < _header->node_dbm + dbm_size)
+    throw std::runtime_error("Corrupted binary graph file");
+
+  // sections are within the file, in order
+  if (_header->strings_count >= _size)
+    throw std::runtime_error("Corrupted binary graph file");
+  std::uint64_t const sections[][2] = {
+      {_header->nodes_offset, array_size(_header->nodes_count, _header->node_size, _size)},
+      {_header->edges_index_offset, array_size(_header->nodes_count + 1, sizeof(std::uint64_t), _size)},
+      {_header->edges_offset, array_size(_header->edges_count, sizeof(tchecker::graph::binary::edge_record_t), _size)},
+      {_header->attributes_offset,
+       array_size(_header->attributes_count, sizeof(tchecker::graph::binary::attribute_record_t), _size)},
+      {_header->locations_offset, array_size(_header->locations_count, sizeof(std::uint32_t), _size)},
+      {_header->intvars_offset, array_size(_header->intvars_count, sizeof(std::uint32_t), _size)},
+      {_header->clocks_offset, array_size(_header->dim - 1, sizeof(std::uint32_t), _size)},
+      {_header->strings_index_offset, array_size(_header->strings_count + 1, sizeof(std::uint64_t), _size)},
+      {_header->strings_offset, 0}};
+  std::uint64_t end = sizeof(tchecker::graph::binary::header_t);
+  for (auto && [offset, size] : sections) {
+    if (offset < end || offset % 8 != 0 || offset > _size || size > _size - offset)
+      throw std::runtime_error("Corrupted binary graph file");
+    end = offset + size;
+  }
+
+  // strings are null-terminated and within the file
+  std::uint64_t const strings_size = _size - _header->strings_offset;
+  std::uint64_t const * strings_index = section<std::uint64_t>(_header->strings_index_offset);
+  char const * strings = section<char>(_header->strings_offset);
+  if (strings_index[0] != 0 || _header->name >= _header->strings_count)
+    throw std::runtime_error("Corrupted binary graph file");
+  for (std::uint64_t i = 0; i < _header->strings_count; ++i)
+    if (strings_index[i + 1] <= strings_index[i] || strings_index[i + 1] > strings_size ||
+        strings[strings_index[i + 1] - 1] != '\0')
+      throw std::runtime_error("Corrupted binary graph file");
+
+  // names refer to strings
+  auto check_names = [&](std::uint64_t offset, std::uint64_t count) {
+    std::uint32_t const * names = section<std::uint32_t>(offset);
+    for (std::uint64_t i = 0; i < count; ++i)
+      if (names[i] >= _header->strings_count)
+        throw std::runtime_error("Corrupted binary graph file");
+  };
+  check_names(_header->locations_offset, _header->locations_count);
+  check_names(_header->intvars_offset, _header->intvars_count);
+  check_names(_header->clocks_offset, _header->dim - 1);
+
+  // node records refer to strings and locations
+  for (std::uint64_t id = 0; id < _header->nodes_count; ++id) {
+    char const * record = _data + _header->nodes_offset + id * _header->node_size;
+    if (reinterpret_cast<tchecker::graph::binary::node_record_t const *>(record)->labels >= _header->strings_count)
+      throw std::runtime_error("Corrupted binary graph file");
+    tchecker::loc_id_t const * vloc = reinterpret_cast<tchecker::loc_id_t const *>(record + _header->node_vloc);
+    for (std::uint64_t p = 0; p < _header->processes_count; ++p)
+      if (vloc[p] >= _header->locations_count)
+        throw std::runtime_error("Corrupted binary graph file");
+  }
+
+  // index of outgoing edges and edge records are consistent
+  std::uint64_t const * edges_index = section<std::uint64_t>(_header->edges_index_offset);
+  if (edges_index[0] != 0 || edges_index[_header->nodes_count] != _header->edges_count)
+    throw std::runtime_error("Corrupted binary graph file");
+  for (std::uint64_t id = 0; id < _header->nodes_count; ++id)
+    if (edges_index[id + 1] < edges_index[id] || edges_index[id + 1] > _header->edges_count)
+      throw std::runtime_error("Corrupted binary graph file");
+
+  tchecker::graph::binary::edge_record_t const * edges = section<tchecker::graph::binary::edge_record_t>(_header->edges_offset);
+  for (std::uint64_t i = 0; i < _header->edges_count; ++i) {
+    tchecker::graph::binary::edge_record_t const & e = edges[i];
+    if (e.src >= _header->nodes_count || e.tgt >= _header->nodes_count || i < edges_index[e.src] ||
+        i >= edges_index[e.src + 1] || e.attributes_first > _header->attributes_count ||
+        e.attributes_count > _header->attributes_count - e.attributes_first)
+      throw std::runtime_error("Corrupted binary graph file");
+  }
+
+  // attributes refer to strings
+  tchecker::graph::binary::attribute_record_t const * attributes =
+      section<tchecker::graph::binary::attribute_record_t>(_header->attributes_offset);
+  for (std::uint64_t i = 0; i < _header->attributes_count; ++i)
+    if (attributes[i].key >= _header->strings_count || attributes[i].value >= _header->strings_count)
+      throw std::runtime_error("Corrupted binary graph file");
+}
+
+/* dot_output */
+
+std::ostream & dot_output(std::ostream & os, tchecker::graph::binary::mapped_graph_t const & g)
+{
+  tchecker::graph::binary::header_t const & header = g.header();
+  auto clock_name = [&](tchecker::clock_id_t id) { return (id == 0 ? std::string{"0"} : std::string{g.clock_name(id - 1)}); };
+
+  std::map<std::string, std::string> attr;
+  std::stringstream ss;
+
+  tchecker::graph::dot_output_header(os, std::string{g.name()});
+
+  for (std::uint64_t id = 0; id < g.nodes_count(); ++id) {
+    tchecker::graph::binary::node_t const n = g.node(id);
+    attr.clear();
+
+    ss.str("");
+    ss << "<";
+    for (std::uint64_t p = 0; p < header.processes_count; ++p)
+      ss << (p > 0 ? "," : "") << g.location_name(n.vloc()[p]);
+    ss << ">";
+    attr["vloc"] = ss.str();
+
+    ss.str("");
+    for (tchecker::intvar_id_t v = 0; v < header.intvars_count; ++v)
+      ss << (v > 0 ? "," : "") << g.intvar_name(v) << "=" << n.intval()[v];
+    attr["intval"] = ss.str();
+
+    ss.str("");
+    tchecker::dbm::output(ss, n.dbm(), header.dim, clock_name);
+    attr["zone"] = ss.str();
+
+    attr["labels"] = n.labels();
+    if (n.initial())
+      attr["initial"] = "true";
+    if (n.final())
+      attr["final"] = "true";
+
+    tchecker::graph::dot_output_node(os, std::to_string(id), attr);
+  }
+
+  for (tchecker::graph::binary::edge_record_t const & e : g.edges()) {
+    attr.clear();
+    for (tchecker::graph::binary::attribute_record_t const & a : g.attributes(e))
+      attr[std::string{g.string(a.key)}] = g.string(a.value);
+    tchecker::graph::dot_output_edge(os, std::to_string(e.src), std::to_string(e.tgt), attr);
+  }
+
+  tchecker::graph::dot_output_footer(os);
+
+  return os;
+}
+
+} // end of namespace binary
+
+} // end of namespace graph
+
+} // end of namespace tchecker
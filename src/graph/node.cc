@@ -72,6 +72,10 @@ void attributes(tchecker::graph::node_flags_t const & n, std::map<std::string, s
     m["final"] = "true";
 }
 
+/* node_rank_t */
+
+node_rank_t::node_rank_t() : _rank(0), _expanded(false) {}
+
 /* node_zg_state_t */
 
 node_zg_state_t::node_zg_state_t(tchecker::zg::state_sptr_t const & s) : _state(s) {}
@@ -5,6 +5,9 @@
  *
  */
 
+#include <algorithm>
+#include <vector>
+
 #include "tchecker/graph/output.hh"
 
 namespace tchecker {
@@ -48,6 +51,113 @@ std::ostream & dot_output_edge(std::ostream & os, std::string const & src, std::
   return os;
 }
 
+/* dot_attributes_writer_t */
+
+dot_attributes_writer_t::dot_attributes_writer_t(std::ostream & os) : _os(os), _first(true) { _os << "["; }
+
+dot_attributes_writer_t::~dot_attributes_writer_t() { _os << "]"; }
+
+void dot_attributes_writer_t::attribute(std::string const & key, std::string const & value)
+{
+  begin_attribute(key);
+  _os << value;
+  end_attribute();
+}
+
+void dot_attributes_writer_t::begin_attribute(std::string const & key)
+{
+  if (!_first)
+    _os << ", ";
+  _first = false;
+  _os << key << "=\"";
+}
+
+void dot_attributes_writer_t::end_attribute() { _os << "\""; }
+
+/* dot_canonical_output */
+
+std::ostream & dot_canonical_output(std::istream & is, std::ostream & os)
+{
+  std::string name;
+  std::map<std::string, std::string> nodes;                            // node name -> attributes
+  std::vector<std::tuple<std::string, std::string, std::string>> edges; // (src, tgt, attributes)
+
+  std::string line;
+  bool header = false, footer = false;
+  while (std::getline(is, line)) {
+    std::string::size_type const begin = line.find_first_not_of(" \t");
+    if (begin == std::string::npos)
+      continue;
+    line = line.substr(begin);
+
+    if (!header) {
+      std::string::size_type const end = line.rfind(" {");
+      if (line.compare(0, 8, "digraph ") != 0 || end == std::string::npos)
+        throw std::runtime_error("tchecker::graph::dot_canonical_output: missing graph header");
+      name = line.substr(8, end - 8);
+      header = true;
+      continue;
+    }
+
+    if (line == "}") {
+      footer = true;
+      break;
+    }
+
+    std::string::size_type const src_end = line.find(' ');
+    if (src_end == std::string::npos)
+      throw std::runtime_error("tchecker::graph::dot_canonical_output: unexpected line: " + line);
+    std::string const src = line.substr(0, src_end);
+
+    if (line.compare(src_end, 4, " -> ") == 0) {
+      std::string::size_type const tgt_end = line.find(' ', src_end + 4);
+      if (tgt_end == std::string::npos)
+        throw std::runtime_error("tchecker::graph::dot_canonical_output: unexpected line: " + line);
+      edges.emplace_back(src, line.substr(src_end + 4, tgt_end - src_end - 4), line.substr(tgt_end + 1));
+    }
+    else
+      nodes[src] = line.substr(src_end + 1);
+  }
+
+  if (!footer)
+    throw std::runtime_error("tchecker::graph::dot_canonical_output: missing graph footer");
+
+  // sort nodes by attributes, then name them
+  std::vector<std::pair<std::string, std::string>> sorted_nodes; // (attributes, name)
+  sorted_nodes.reserve(nodes.size());
+  for (auto && [node, attr] : nodes)
+    sorted_nodes.emplace_back(attr, node);
+  std::sort(sorted_nodes.begin(), sorted_nodes.end());
+
+  std::map<std::string, std::size_t> ids;
+  for (std::size_t id = 0; id < sorted_nodes.size(); ++id)
+    ids[sorted_nodes[id].second] = id;
+
+  // sort edges by source, target and attributes
+  auto id = [&](std::string const & node) {
+    auto it = ids.find(node);
+    if (it == ids.end())
+      throw std::runtime_error("tchecker::graph::dot_canonical_output: unknown node " + node);
+    return it->second;
+  };
+
+  std::vector<std::tuple<std::size_t, std::size_t, std::string>> sorted_edges;
+  sorted_edges.reserve(edges.size());
+  for (auto && [src, tgt, attr] : edges)
+    sorted_edges.emplace_back(id(src), id(tgt), attr);
+  std::sort(sorted_edges.begin(), sorted_edges.end());
+
+  // output
+  tchecker::graph::dot_output_header(os, name);
+  for (std::size_t i = 0; i < sorted_nodes.size(); ++i)
+    os << "  " << i << " " << sorted_nodes[i].first << std::endl;
+  for (auto && [src, tgt, attr] : sorted_edges)
+    os << "  " << src << " -> " << tgt << " " << attr << std::endl;
+  tchecker::graph::dot_output_footer(os);
+
+  return os;
+}
+
 } // end of namespace graph
 
 } // end of namespace tchecker
\ No newline at end of file
@@ -7,8 +7,10 @@
 
 #include "tchecker/publicapi/compare_api.hh"
 
+#include <chrono>
 #include <fstream>
 #include <filesystem>
+#include <memory>
 #include <sstream>
 #include <iostream>
 #include <string>
@@ -28,6 +30,7 @@
 #include "tchecker/strong-timed-bisim/strategy.hh"
 #include "tchecker/ta/system.hh"
 #include "tchecker/algorithms/search_order.hh"
+#include "tchecker/utils/progress.hh"
 #include "tchecker/utils/tmp_file.hh"
 
 void tck_compare(const char * output_filename, 
@@ -70,12 +73,16 @@ void strong_timed_bisim(std::ostream & os, std::shared_ptr<tchecker::parsing::sy
                         std::size_t table_size, std::map<std::string, std::string> & first_starting_state, 
                         std::map<std::string, std::string> & second_starting_state, 
                         std::string & inter_constraint, bool generate_witness, 
-                        std::vector<std::shared_ptr<tchecker::strong_timed_bisim::strategy::state_to_check_t>> & symbolic_states_to_check)
+                        std::vector<std::shared_ptr<tchecker::strong_timed_bisim::strategy::state_to_check_t>> & symbolic_states_to_check,
+                        tchecker::progress_reporter_t * reporter)
 {
 
   auto stats = tchecker::strong_timed_bisim::run(sysdecl_first, sysdecl_second, &os, block_size, table_size, 
                                                  first_starting_state, second_starting_state, inter_constraint, 
-                                                 generate_witness, symbolic_states_to_check);
+                                                 generate_witness, symbolic_states_to_check,
+                                                 (reporter != nullptr ? &reporter->progress() : nullptr));
+  if (reporter != nullptr)
+    reporter->stop();
 
 
   if(!symbolic_states_to_check.empty()) {
@@ -101,7 +108,8 @@ void strong_timed_bisim(std::ostream & os, std::shared_ptr<tchecker::parsing::sy
 void tck_compare(std::string output_filename, std::string first_sysdecl_filename, std::string second_sysdecl_filename,
                  tck_compare_relationship_t relationship, std::size_t block_size, std::size_t table_size,
                  std::string & first_starting_state_json, std::string & second_starting_state_json, 
-                 std::string & inter_constraint, bool generate_witness, bool all_reachable_states)
+                 std::string & inter_constraint, bool generate_witness, bool all_reachable_states,
+                 std::size_t progress_interval, std::string progress_file)
 {
   try {
 
@@ -210,10 +218,30 @@ void tck_compare(std::string output_filename, std::string first_sysdecl_filename
     }
     std::shared_ptr<tchecker::system::system_t> second_system = std::make_shared<tchecker::system::system_t>(*second_sysdecl);
 
+    if (!progress_file.empty() && (progress_interval == 0))
+      throw std::runtime_error("Progress file requires a progress interval");
+
+    // progress reporter, stopped by strong_timed_bisim once the comparison is over
+
+    std::ofstream progress_ofs;
+    std::unique_ptr<tchecker::progress_reporter_t> reporter{nullptr};
+    if ((progress_interval > 0) && (relationship == STRONG_TIMED_BISIM)) {
+      std::ostream * progress_os = &std::cerr;
+      if (!progress_file.empty()) {
+        progress_ofs.open(progress_file);
+        if (!progress_ofs)
+          throw std::runtime_error("Failed to open file: " + progress_file);
+        progress_os = &progress_ofs;
+      }
+      reporter = std::make_unique<tchecker::progress_reporter_t>(
+          *progress_os, (progress_file.empty() ? tchecker::PROGRESS_TEXT : tchecker::PROGRESS_JSON_LINES),
+          std::chrono::seconds{progress_interval});
+    }
+
     if (relationship == STRONG_TIMED_BISIM) {
       strong_timed_bisim(*os, first_sysdecl, second_sysdecl, block_size, table_size, 
                          first_starting_state_attributes, second_starting_state_attributes,
-                         inter_constraint, generate_witness, reachable_states);
+                         inter_constraint, generate_witness, reachable_states, reporter.get());
     }
     else {
       std::cerr << tchecker::log_error << "Unknown relationship" << std::endl;
@@ -7,14 +7,19 @@
 
 #include "tchecker/publicapi/liveness_api.hh"
 
+#include <chrono>
 #include <fstream>
 #include <iostream>
+#include <memory>
 
 #include "tchecker/algorithms/couvreur_scc/zg-couvscc.hh"
 #include "tchecker/algorithms/ndfs/zg-ndfs.hh"
+#include "tchecker/algorithms/sndfs/zg-sndfs.hh"
+#include "tchecker/algorithms/ufscc/zg-ufscc.hh"
 
 #include "tchecker/parsing/parsing.hh"
 #include "tchecker/system/system.hh"
+#include "tchecker/utils/progress.hh"
 
 void tck_liveness(const char * output_filename, const char * sysdecl_filename, const char * labels,
                   tck_liveness_algorithm_t algorithm, tck_liveness_certificate_t certificate, int * block_size,
@@ -47,14 +52,19 @@ static bool is_certificate_path(enum tck_liveness_certificate_t ctype) { return
 /*!
  \brief Run nested DFS algorithm
  \param sysdecl : system declaration
+ \param reporter : progress reporter (nullptr if none)
  \post statistics on accepting run w.r.t. command-line specified labels in
  the system declared by sysdecl have been output to standard output.
  A certificate has been output if required.
 */
 const void tck_liveness_zg_ndfs(std::ostream & os, const tchecker::parsing::system_declaration_t & sysdecl, std::string labels,
-                                std::size_t block_size, std::size_t table_size, tck_liveness_certificate_t certificate)
+                                std::size_t block_size, std::size_t table_size, tck_liveness_certificate_t certificate,
+                                tchecker::progress_reporter_t * reporter)
 {
-  auto && [stats, state_space] = tchecker::algorithms::zg_ndfs::run(sysdecl, labels, block_size, table_size);
+  auto && [stats, state_space] = tchecker::algorithms::zg_ndfs::run(sysdecl, labels, block_size, table_size,
+                                                                    (reporter != nullptr ? &reporter->progress() : nullptr));
+  if (reporter != nullptr)
+    reporter->stop();
 
   // stats
   std::map<std::string, std::string> m;
@@ -65,6 +75,8 @@ const void tck_liveness_zg_ndfs(std::ostream & os, const tchecker::parsing::syst
   // certificate
   if (certificate == CERTIFICATE_GRAPH)
     tchecker::algorithms::zg_ndfs::dot_output(os, state_space->graph(), sysdecl.name());
+  else if (certificate == CERTIFICATE_BINARY)
+    tchecker::algorithms::zg_ndfs::binary_output(os, state_space->graph(), sysdecl.name());
   else if ((certificate == CERTIFICATE_SYMBOLIC) && stats.cycle()) {
     std::unique_ptr<tchecker::algorithms::zg_ndfs::cex::symbolic_cex_t> cex{
         tchecker::algorithms::zg_ndfs::cex::symbolic_counter_example(state_space->graph())};
@@ -77,12 +89,14 @@ const void tck_liveness_zg_ndfs(std::ostream & os, const tchecker::parsing::syst
 /*!
  \brief Run Couvreur's algorithm
  \param sysdecl : system declaration
+ \param reporter : progress reporter (nullptr if none)
  \post statistics on accepting run w.r.t. command-line specified labels in
  the system declared by sysdecl have been output to standard output.
  A certificate has been output if required.
 */
 const void tck_liveness_zg_couvscc(std::ostream & os, const tchecker::parsing::system_declaration_t & sysdecl,
-                                   std::string labels, int block_size, int table_size, tck_liveness_certificate_t certificate)
+                                   std::string labels, int block_size, int table_size, tck_liveness_certificate_t certificate,
+                                   tchecker::progress_reporter_t * reporter)
 {
   std::string labels_str(labels);
   std::string::difference_type labels_count = std::count(labels_str.begin(), labels_str.end(), ',') + 1;
@@ -91,7 +105,10 @@ const void tck_liveness_zg_couvscc(std::ostream & os, const tchecker::parsing::s
     throw std::runtime_error(
         "*** tck_liveness: cannot compute symbolic counter example with more than 1 label (use graph instead)");
 
-  auto && [stats, state_space] = tchecker::algorithms::zg_couvscc::run(sysdecl, labels, block_size, table_size);
+  auto && [stats, state_space] = tchecker::algorithms::zg_couvscc::run(sysdecl, labels, block_size, table_size,
+                                                                       (reporter != nullptr ? &reporter->progress() : nullptr));
+  if (reporter != nullptr)
+    reporter->stop();
 
   // stats
   std::map<std::string, std::string> m;
@@ -102,6 +119,8 @@ const void tck_liveness_zg_couvscc(std::ostream & os, const tchecker::parsing::s
   // certificate
   if (certificate == CERTIFICATE_GRAPH)
     tchecker::algorithms::zg_couvscc::dot_output(os, state_space->graph(), sysdecl.name());
+  else if (certificate == CERTIFICATE_BINARY)
+    tchecker::algorithms::zg_couvscc::binary_output(os, state_space->graph(), sysdecl.name());
   else if ((certificate == CERTIFICATE_SYMBOLIC) && stats.cycle()) {
     std::unique_ptr<tchecker::algorithms::zg_couvscc::cex::symbolic_cex_t> cex{
         tchecker::algorithms::zg_couvscc::cex::symbolic_counter_example(state_space->graph())};
@@ -111,9 +130,76 @@ const void tck_liveness_zg_couvscc(std::ostream & os, const tchecker::parsing::s
   }
 }
 
+/*!
+ \brief Run nested DFS algorithm with subsumption
+ \param sysdecl : system declaration
+ \param reporter : progress reporter (nullptr if none)
+ \post statistics on accepting run w.r.t. command-line specified labels in
+ the system declared by sysdecl have been output to standard output.
+ A certificate has been output if required.
+ \throw std::runtime_error : if a symbolic counter-example is required (the
+ cycle may be closed by a subsumption edge)
+*/
+const void tck_liveness_zg_sndfs(std::ostream & os, const tchecker::parsing::system_declaration_t & sysdecl,
+                                 std::string labels, std::size_t block_size, std::size_t table_size,
+                                 tck_liveness_certificate_t certificate, tchecker::progress_reporter_t * reporter)
+{
+  if (is_certificate_path(certificate))
+    throw std::runtime_error("*** tck_liveness: symbolic counter examples are not available for sndfs algorithm (use graph "
+                             "instead)");
+
+  auto && [stats, state_space] = tchecker::algorithms::zg_sndfs::run(sysdecl, labels, block_size, table_size,
+                                                                     (reporter != nullptr ? &reporter->progress() : nullptr));
+  if (reporter != nullptr)
+    reporter->stop();
+
+  // stats
+  std::map<std::string, std::string> m;
+  stats.attributes(m);
+  for (auto && [key, value] : m)
+    std::cout << key << " " << value << std::endl;
+
+  // certificate
+  if (certificate == CERTIFICATE_GRAPH)
+    tchecker::algorithms::zg_sndfs::dot_output(os, state_space->graph(), sysdecl.name());
+  else if (certificate == CERTIFICATE_BINARY)
+    tchecker::algorithms::zg_sndfs::binary_output(os, state_space->graph(), sysdecl.name());
+}
+
+/*!
+ \brief Run parallel union-find SCC algorithm
+ \param sysdecl : system declaration
+ \param threads : number of worker threads (0 means hardware concurrency)
+ \param reporter : progress reporter (nullptr if none)
+ \post statistics on accepting run w.r.t. command-line specified labels in
+ the system declared by sysdecl have been output to standard output.
+ \throw std::runtime_error : if a certificate is required (workers do not
+ build a graph of the state-space)
+*/
+const void tck_liveness_zg_ufscc(const tchecker::parsing::system_declaration_t & sysdecl, std::string labels,
+                                 std::size_t threads, std::size_t block_size, std::size_t table_size,
+                                 tck_liveness_certificate_t certificate, tchecker::progress_reporter_t * reporter)
+{
+  if (certificate != CERTIFICATE_NONE)
+    throw std::runtime_error("*** tck_liveness: certificates are not available for ufscc algorithm");
+
+  tchecker::algorithms::ufscc::stats_t stats =
+      tchecker::algorithms::zg_ufscc::run(sysdecl, labels, threads, block_size, table_size,
+                                          (reporter != nullptr ? &reporter->progress() : nullptr));
+  if (reporter != nullptr)
+    reporter->stop();
+
+  // stats
+  std::map<std::string, std::string> m;
+  stats.attributes(m);
+  for (auto && [key, value] : m)
+    std::cout << key << " " << value << std::endl;
+}
+
 void tck_liveness(std::string output_filename, std::string sysdecl_filename, std::string labels,
                         tck_liveness_algorithm_t algorithm, tck_liveness_certificate_t certificate, std::size_t block_size,
-                        std::size_t table_size)
+                        std::size_t table_size, std::size_t threads, std::size_t progress_interval,
+                        std::string progress_file)
 {
   try {
     std::shared_ptr<tchecker::parsing::system_declaration_t> sysdecl{nullptr};
@@ -129,7 +215,8 @@ void tck_liveness(std::string output_filename, std::string sysdecl_filename, std
     std::ofstream ofs;
 
     if (output_filename != "") {
-      ofs.open(output_filename, std::ios::out);
+      ofs.open(output_filename,
+               (certificate == CERTIFICATE_BINARY ? std::ios::out | std::ios::binary : std::ios::out));
       if (!ofs) {
         throw std::runtime_error("Failed to open file: " + output_filename);
       }
@@ -139,11 +226,37 @@ void tck_liveness(std::string output_filename, std::string sysdecl_filename, std
       os = &std::cout;
     }
 
+    if (!progress_file.empty() && (progress_interval == 0))
+      throw std::runtime_error("Progress file requires a progress interval");
+
+    // progress reporter, stopped by the algorithm functions once the exploration is over
+
+    std::ofstream progress_ofs;
+    std::unique_ptr<tchecker::progress_reporter_t> reporter{nullptr};
+    if ((progress_interval > 0) && (algorithm != ALGO_NONE)) {
+      std::ostream * progress_os = &std::cerr;
+      if (!progress_file.empty()) {
+        progress_ofs.open(progress_file);
+        if (!progress_ofs)
+          throw std::runtime_error("Failed to open file: " + progress_file);
+        progress_os = &progress_ofs;
+      }
+      reporter = std::make_unique<tchecker::progress_reporter_t>(
+          *progress_os, (progress_file.empty() ? tchecker::PROGRESS_TEXT : tchecker::PROGRESS_JSON_LINES),
+          std::chrono::seconds{progress_interval});
+    }
+
     if (algorithm == ALGO_COUVSCC) {
-      tck_liveness_zg_couvscc(*os, *sysdecl, labels, block_size, table_size, certificate);
+      tck_liveness_zg_couvscc(*os, *sysdecl, labels, block_size, table_size, certificate, reporter.get());
     }
     else if (algorithm == ALGO_NDFS) {
-      tck_liveness_zg_ndfs(*os, *sysdecl, labels, block_size, table_size, certificate);
+      tck_liveness_zg_ndfs(*os, *sysdecl, labels, block_size, table_size, certificate, reporter.get());
+    }
+    else if (algorithm == ALGO_SNDFS) {
+      tck_liveness_zg_sndfs(*os, *sysdecl, labels, block_size, table_size, certificate, reporter.get());
+    }
+    else if (algorithm == ALGO_UFSCC) {
+      tck_liveness_zg_ufscc(*sysdecl, labels, threads, block_size, table_size, certificate, reporter.get());
     }
     else {
       throw std::runtime_error("Unknown algorithm");
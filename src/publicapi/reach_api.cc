@@ -7,16 +7,29 @@
 
 #include "tchecker/publicapi/reach_api.hh"
 
+#include <chrono>
 #include <fstream>
 #include <iostream>
+#include <memory>
+#include <vector>
 
 #include "tchecker/algorithms/concur19/concur19.hh"
 #include "tchecker/algorithms/covreach/zg-covreach.hh"
 #include "tchecker/algorithms/alu_covreach/zg-aLU-covreach.hh"
+#include "tchecker/algorithms/bwd_reach/zg-bwd-reach.hh"
 
 #include "tchecker/algorithms/reach/zg-reach.hh"
+#include "tchecker/algorithms/search_order.hh"
+#include "tchecker/algorithms/swarm/zg-swarm.hh"
 #include "tchecker/parsing/parsing.hh"
 #include "tchecker/system/system.hh"
+#include "tchecker/ta/clock_merging.hh"
+#include "tchecker/ta/slicing.hh"
+#include "tchecker/ta/system.hh"
+#include "tchecker/utils/log.hh"
+#include "tchecker/utils/memory_budget.hh"
+#include "tchecker/utils/memory_stats.hh"
+#include "tchecker/utils/progress.hh"
 
 void tck_reach(const char * output_filename, 
                const char * sysdecl_filename, 
@@ -55,28 +68,149 @@ static bool is_certificate_path(enum tck_reach_certificate_t ctype)
   return (ctype == CERTIFICATE_SYMBOLIC || ctype == CERTIFICATE_CONCRETE);
 }
 
+/*!
+ \brief Build a memory budget
+ \param max_memory : maximum memory in bytes (0 for no budget)
+ \return a memory budget of max_memory bytes, nullptr if max_memory is 0
+ */
+static std::unique_ptr<tchecker::memory_budget_t> make_memory_budget(std::size_t max_memory)
+{
+  if (max_memory == 0)
+    return nullptr;
+  return std::make_unique<tchecker::memory_budget_t>(max_memory);
+}
+
+/*!
+ \brief Report the outcome of a memory budget
+ \param budget : a memory budget (nullptr if none)
+ \param visited_states : number of visited states
+ \param reachable : reachability of the labels
+ \param certificate : certificate type
+ \post warnings have been output if budget has been degraded or exceeded
+ \return true if certificate can be output, false otherwise
+ */
+static bool report_memory_budget(tchecker::memory_budget_t const * budget, unsigned long visited_states, bool reachable,
+                                 enum tck_reach_certificate_t certificate)
+{
+  if (budget == nullptr)
+    return true;
+  if (budget->exceeded() && !reachable)
+    std::cerr << tchecker::log_warning << "memory budget exceeded: no counter-example up to " << visited_states
+              << " visited states" << std::endl;
+  if (budget->degraded() && (certificate != CERTIFICATE_NONE)) {
+    std::cerr << tchecker::log_warning << "memory budget degraded: edges were dropped, no certificate is output"
+              << std::endl;
+    return false;
+  }
+  return true;
+}
+
+/*!
+ \brief Mark unresolved verdicts as inconclusive when a memory budget has been exceeded
+ \param budget : a memory budget (nullptr if none)
+ \param m : map of statistics
+ \post if budget has been exceeded, the values false of REACHABLE and of
+ PROPERTY_i_REACHABLE in m have been replaced by inconclusive: the exploration
+ stopped before the state-space was covered, hence only positive verdicts hold
+ */
+static void inconclusive_verdicts(tchecker::memory_budget_t const * budget, std::map<std::string, std::string> & m)
+{
+  if ((budget == nullptr) || !budget->exceeded())
+    return;
+  std::string const suffix = "_REACHABLE";
+  for (auto && [key, value] : m) {
+    bool const verdict = (key == "REACHABLE") || ((key.size() > suffix.size()) &&
+                                                  (key.compare(key.size() - suffix.size(), suffix.size(), suffix) == 0));
+    if (verdict && (value == "false"))
+      value = "inconclusive";
+  }
+}
+
+/*!
+ \brief Split a list of sets of labels
+ \param labels : semicolon-separated list of comma-separated sets of labels
+ \return the list of comma-separated sets of labels in labels
+ */
+static std::vector<std::string> split_properties(std::string const & labels)
+{
+  std::vector<std::string> properties;
+  std::string::size_type start = 0, end = 0;
+  while ((end = labels.find(';', start)) != std::string::npos) {
+    properties.push_back(labels.substr(start, end - start));
+    start = end + 1;
+  }
+  properties.push_back(labels.substr(start));
+  return properties;
+}
+
 /*!
  \brief Perform reachability analysis
  \param sysdecl : system declaration
+ \param labels : sets of labels, all checked in a single exploration
+ \param checkpoint_file : checkpoint file name (empty for no checkpoint)
+ \param checkpoint_interval : time interval between two checkpoints, in seconds
+ \param resume_file : checkpoint file to resume from (empty for no resume)
+ \param spill_directory : directory of spilled states (empty for no spill)
+ \param stream_graph : output the graph to os while it is explored
+ \param huge_pages : huge pages mode of allocation blocks
+ \param max_memory : memory budget in bytes (0 for no budget)
+ \param memory_stats : output memory statistics of subsystems
+ \param reporter : progress reporter (nullptr if none)
  \post statistics on reachability analysis of command-line specified labels in
- the system declared by sysdecl have been output to standard output.
+ the system declared by sysdecl have been output to standard output, along with
+ the reachability of each set of labels if there are several.
  A certification has been output if required.
 */
-void tck_reach_zg_reach(std::ostream & os, const tchecker::parsing::system_declaration_t & sysdecl, std::string labels,
-                              std::string search_order, int block_size, int table_size, tck_reach_certificate_t certificate)
+void tck_reach_zg_reach(std::ostream & os, const tchecker::parsing::system_declaration_t & sysdecl,
+                        std::vector<std::string> const & labels, std::string search_order, int block_size, int table_size,
+                        tck_reach_certificate_t certificate, std::string const & checkpoint_file,
+                        std::size_t checkpoint_interval, std::string const & resume_file,
+                        std::string const & spill_directory, bool stream_graph, enum tchecker::huge_pages_t huge_pages,
+                        std::size_t max_memory, bool memory_stats, tchecker::progress_reporter_t * reporter)
 {
+  if ((labels.size() > 1) && is_certificate_path(certificate))
+    throw std::runtime_error("Counter-examples are only available for a single set of labels");
 
-  auto && [stats, state_space] = tchecker::algorithms::zg_reach::run(sysdecl, labels, search_order, block_size, table_size);
+  if (!resume_file.empty() && (certificate != CERTIFICATE_NONE))
+    throw std::runtime_error("Certificates are not available for resumed runs");
+
+  if (stream_graph && (certificate != CERTIFICATE_GRAPH))
+    throw std::runtime_error("Streaming output is only available for graph certificates");
+
+  std::unique_ptr<tchecker::memory_budget_t> budget = make_memory_budget(max_memory);
+  auto && [stats, properties, state_space] =
+      tchecker::algorithms::zg_reach::run(sysdecl, labels, search_order, checkpoint_file,
+                                          std::chrono::seconds{checkpoint_interval}, resume_file, block_size, table_size,
+                                          spill_directory, (stream_graph ? &os : nullptr), huge_pages, budget.get(),
+                                          (reporter != nullptr ? &reporter->progress() : nullptr));
+  if (reporter != nullptr)
+    reporter->stop();
 
   // stats
   std::map<std::string, std::string> m;
   stats.attributes(m);
+  if (labels.size() > 1)
+    properties.attributes(m);
+  if (budget != nullptr)
+    budget->attributes(m);
+  if (memory_stats) {
+    tchecker::memory_stats_t mstats;
+    state_space->zg().memory_stats(mstats);
+    state_space->graph().memory_stats(mstats);
+    mstats.attributes(m);
+  }
+  inconclusive_verdicts(budget.get(), m);
   for (auto && [key, value] : m)
     std::cout << key << " " << value << std::endl;
 
+  if (!report_memory_budget(budget.get(), stats.visited_states(), stats.reachable(), certificate))
+    return;
+
   // certificate
-  if (certificate == CERTIFICATE_GRAPH)
+  if ((certificate == CERTIFICATE_GRAPH) && !stream_graph)
     tchecker::algorithms::zg_reach::dot_output(os, state_space->graph(), sysdecl.name());
+  else if (certificate == CERTIFICATE_BINARY)
+    tchecker::algorithms::zg_reach::binary_output(os, state_space->graph(), sysdecl.name());
   else if ((certificate == CERTIFICATE_CONCRETE) && stats.reachable()) {
     std::unique_ptr<tchecker::algorithms::zg_reach::cex::concrete_cex_t> cex{
         tchecker::algorithms::zg_reach::cex::concrete_counter_example(state_space->graph())};
@@ -137,29 +271,63 @@ void tck_reach_concur19(std::ostream & os, const tchecker::parsing::system_decla
 /*!
  \brief Perform covering reachability analysis
  \param sysdecl : system declaration
+ \param labels : sets of labels, all checked in a single exploration
+ \param spill_directory : directory of spilled states (empty for no spill)
+ \param huge_pages : huge pages mode of allocation blocks
+ \param incremental_gc : collect unused states incrementally
+ \param max_memory : memory budget in bytes (0 for no budget)
+ \param memory_stats : output memory statistics of subsystems
+ \param reporter : progress reporter (nullptr if none)
  \post statistics on covering reachability analysis of command-line specified
- labels in the system declared by sysdecl have been output to standard output.
+ labels in the system declared by sysdecl have been output to standard output,
+ along with the reachability of each set of labels if there are several.
  A certification has been output if required.
 */
 void tck_reach_zg_covreach(std::ostream & os, const tchecker::parsing::system_declaration_t & sysdecl,
-                           std::string labels, std::string search_order, int block_size, int table_size,
-                           tck_reach_certificate_t certificate)
+                           std::vector<std::string> const & labels, std::string search_order, int block_size,
+                           int table_size, tck_reach_certificate_t certificate, std::string const & spill_directory,
+                           enum tchecker::huge_pages_t huge_pages, bool incremental_gc, std::size_t max_memory,
+                           bool memory_stats, tchecker::progress_reporter_t * reporter)
 {
+  if ((labels.size() > 1) && is_certificate_path(certificate))
+    throw std::runtime_error("Counter-examples are only available for a single set of labels");
+
   tchecker::algorithms::covreach::covering_t covering =
       (is_certificate_path(certificate) ? tchecker::algorithms::covreach::COVERING_LEAF_NODES
                                         : tchecker::algorithms::covreach::COVERING_FULL);
-  auto && [stats, state_space] =
-      tchecker::algorithms::zg_covreach::run(sysdecl, labels, search_order, covering, block_size, table_size);
+  std::unique_ptr<tchecker::memory_budget_t> budget = make_memory_budget(max_memory);
+  auto && [stats, properties, state_space] =
+      tchecker::algorithms::zg_covreach::run(sysdecl, labels, search_order, covering, block_size, table_size, spill_directory,
+                                             huge_pages, incremental_gc, budget.get(),
+                                             (reporter != nullptr ? &reporter->progress() : nullptr));
+  if (reporter != nullptr)
+    reporter->stop();
 
   // stats
   std::map<std::string, std::string> m;
   stats.attributes(m);
+  if (labels.size() > 1)
+    properties.attributes(m);
+  if (budget != nullptr)
+    budget->attributes(m);
+  if (memory_stats) {
+    tchecker::memory_stats_t mstats;
+    state_space->zg().memory_stats(mstats);
+    state_space->graph().memory_stats(mstats);
+    mstats.attributes(m);
+  }
+  inconclusive_verdicts(budget.get(), m);
   for (auto && [key, value] : m)
     std::cout << key << " " << value << std::endl;
 
+  if (!report_memory_budget(budget.get(), stats.visited_states(), stats.reachable(), certificate))
+    return;
+
   // certificate
   if (certificate == CERTIFICATE_GRAPH)
     tchecker::algorithms::zg_covreach::dot_output(os, state_space->graph(), sysdecl.name());
+  else if (certificate == CERTIFICATE_BINARY)
+    tchecker::algorithms::zg_covreach::binary_output(os, state_space->graph(), sysdecl.name());
   else if ((certificate == CERTIFICATE_CONCRETE) && stats.reachable()) {
     std::unique_ptr<tchecker::algorithms::zg_covreach::cex::concrete_cex_t> cex{
         tchecker::algorithms::zg_covreach::cex::concrete_counter_example(state_space->graph())};
@@ -220,8 +388,202 @@ void tck_reach_zg_alu_covreach(std::ostream & os, const tchecker::parsing::syste
   }
 }
 
+/*!
+ \brief Perform backward reachability analysis
+ \param sysdecl : system declaration
+ \post statistics on backward reachability analysis of command-line specified
+ labels in the system declared by sysdecl have been output to standard output.
+ The graph explored backward has been output if required.
+*/
+void tck_reach_zg_bwd_reach(std::ostream & os, const tchecker::parsing::system_declaration_t & sysdecl, std::string labels,
+                            std::string search_order, int block_size, int table_size, tck_reach_certificate_t certificate)
+{
+  if ((certificate != CERTIFICATE_GRAPH) && (certificate != CERTIFICATE_NONE))
+    throw std::runtime_error("Only graph certificates are available for bwd-reach algorithm");
+
+  auto && [stats, state_space] =
+      tchecker::algorithms::zg_bwd_reach::run(sysdecl, labels, search_order, block_size, table_size);
+
+  // stats
+  std::map<std::string, std::string> m;
+  stats.attributes(m);
+  for (auto && [key, value] : m)
+    std::cout << key << " " << value << std::endl;
+
+  // certificate
+  if (certificate == CERTIFICATE_GRAPH)
+    tchecker::algorithms::zg_reach::dot_output(os, state_space->graph(), sysdecl.name());
+}
+
+/*!
+ \brief Perform bidirectional reachability analysis
+ \param sysdecl : system declaration
+ \post statistics on bidirectional reachability analysis of command-line
+ specified labels in the system declared by sysdecl have been output to
+ standard output. The graphs explored forward and backward have been output if
+ required.
+*/
+void tck_reach_zg_bidir_reach(std::ostream & os, const tchecker::parsing::system_declaration_t & sysdecl, std::string labels,
+                              std::string search_order, int block_size, int table_size, tck_reach_certificate_t certificate)
+{
+  if ((certificate != CERTIFICATE_GRAPH) && (certificate != CERTIFICATE_NONE))
+    throw std::runtime_error("Only graph certificates are available for bidir-reach algorithm");
+
+  auto && [stats, fwd_state_space, bwd_state_space] =
+      tchecker::algorithms::zg_bwd_reach::run_bidirectional(sysdecl, labels, search_order, block_size, table_size);
+
+  // stats
+  std::map<std::string, std::string> m;
+  stats.attributes(m);
+  for (auto && [key, value] : m)
+    std::cout << key << " " << value << std::endl;
+
+  // certificate
+  if (certificate == CERTIFICATE_GRAPH) {
+    tchecker::algorithms::zg_reach::dot_output(os, fwd_state_space->graph(), sysdecl.name() + "_fwd");
+    tchecker::algorithms::zg_reach::dot_output(os, bwd_state_space->graph(), sysdecl.name() + "_bwd");
+  }
+}
+
+/*!
+ \brief Perform swarm verification
+ \param sysdecl : system declaration
+ \param swarm : number of instances
+ \post statistics on swarm verification of command-line specified labels in
+ the system declared by sysdecl have been output to standard output.
+ A certification from the winning instance has been output if required.
+ \note instances cycle over engines reach, covreach and aLU-covreach.
+ aLU-covreach is left out when a concrete counter-example is required
+*/
+void tck_reach_zg_swarm(std::ostream & os, std::shared_ptr<tchecker::parsing::system_declaration_t> const & sysdecl,
+                        std::string labels, std::size_t swarm, int block_size, int table_size,
+                        tck_reach_certificate_t certificate)
+{
+  tchecker::algorithms::covreach::covering_t covering =
+      (is_certificate_path(certificate) ? tchecker::algorithms::covreach::COVERING_LEAF_NODES
+                                        : tchecker::algorithms::covreach::COVERING_FULL);
+
+  std::vector<enum tchecker::algorithms::zg_swarm::engine_t> engines{tchecker::algorithms::zg_swarm::ENGINE_REACH,
+                                                                     tchecker::algorithms::zg_swarm::ENGINE_COVREACH};
+  if (certificate != CERTIFICATE_CONCRETE)
+    engines.push_back(tchecker::algorithms::zg_swarm::ENGINE_ALU_COVREACH);
+
+  auto && [stats, winner] =
+      tchecker::algorithms::zg_swarm::run(sysdecl, labels, swarm, engines, covering, block_size, table_size);
+
+  // stats
+  std::map<std::string, std::string> m;
+  stats.attributes(m);
+  for (auto && [key, value] : m)
+    std::cout << key << " " << value << std::endl;
+
+  // certificate
+  if (certificate == CERTIFICATE_GRAPH)
+    winner->dot_graph(os, sysdecl->name());
+  else if ((certificate == CERTIFICATE_CONCRETE) && stats.reachable())
+    winner->dot_concrete_counter_example(os, sysdecl->name());
+  else if ((certificate == CERTIFICATE_SYMBOLIC) && stats.reachable())
+    winner->dot_symbolic_counter_example(os, sysdecl->name());
+}
+
+/*!
+ \brief Perform reachability analysis with a portfolio of algorithms
+ \param sysdecl : system declaration
+ \post statistics on reachability analysis of command-line specified labels in
+ the system declared by sysdecl have been output to standard output, along with
+ the algorithm that has answered first.
+ A certification from that algorithm has been output if required.
+ \note algorithms reach, concur19, covreach and aLU-covreach are run in
+ parallel. concur19 and aLU-covreach are left out when a concrete counter-example
+ is required, as for tck-reach with these algorithms
+*/
+void tck_reach_portfolio(std::ostream & os, std::shared_ptr<tchecker::parsing::system_declaration_t> const & sysdecl,
+                         std::string labels, std::string search_order, int block_size, int table_size,
+                         tck_reach_certificate_t certificate)
+{
+  tchecker::algorithms::covreach::covering_t covering =
+      (is_certificate_path(certificate) ? tchecker::algorithms::covreach::COVERING_LEAF_NODES
+                                        : tchecker::algorithms::covreach::COVERING_FULL);
+
+  std::vector<enum tchecker::algorithms::zg_swarm::engine_t> engines{tchecker::algorithms::zg_swarm::ENGINE_REACH,
+                                                                     tchecker::algorithms::zg_swarm::ENGINE_COVREACH};
+  if (certificate != CERTIFICATE_CONCRETE) {
+    engines.push_back(tchecker::algorithms::zg_swarm::ENGINE_ALU_COVREACH);
+    engines.push_back(tchecker::algorithms::zg_swarm::ENGINE_CONCUR19);
+  }
+
+  auto && [stats, winner] =
+      tchecker::algorithms::zg_swarm::portfolio(sysdecl, labels, engines, search_order, covering, block_size, table_size);
+
+  // stats
+  std::map<std::string, std::string> m;
+  stats.attributes(m);
+  for (auto && [key, value] : m)
+    std::cout << key << " " << value << std::endl;
+
+  // certificate
+  if (certificate == CERTIFICATE_GRAPH)
+    winner->dot_graph(os, sysdecl->name());
+  else if ((certificate == CERTIFICATE_CONCRETE) && stats.reachable())
+    winner->dot_concrete_counter_example(os, sysdecl->name());
+  else if ((certificate == CERTIFICATE_SYMBOLIC) && stats.reachable())
+    winner->dot_symbolic_counter_example(os, sysdecl->name());
+}
+
+/*!
+ \brief Slice a system declaration w.r.t. the cone of influence of labels
+ \param sysdecl : system declaration
+ \param properties : sets of labels
+ \return declaration of the system obtained from sysdecl by removing the
+ processes, variables and clocks that are not in the cone of influence of the
+ labels in properties (see tchecker::ta::cone_of_influence_t)
+ \post the number of processes, bounded integer variables and clocks in the
+ sliced system and in the system declared by sysdecl have been output to
+ standard output
+ */
+static std::shared_ptr<tchecker::parsing::system_declaration_t>
+slice_system_declaration(tchecker::parsing::system_declaration_t const & sysdecl, std::vector<std::string> const & properties)
+{
+  tchecker::ta::system_t system{sysdecl};
+
+  boost::dynamic_bitset<> labels(system.labels_count());
+  for (std::string const & property : properties)
+    labels |= system.labels(property);
+
+  tchecker::ta::cone_of_influence_t coi{system, labels};
+
+  std::cout << "SLICED_PROCESSES " << coi.processes().count() << "/" << system.processes_count() << std::endl;
+  std::cout << "SLICED_INTVARS " << coi.intvars().count() << "/" << system.intvars_count(tchecker::VK_FLATTENED) << std::endl;
+  std::cout << "SLICED_CLOCKS " << coi.clocks().count() << "/" << system.clocks_count(tchecker::VK_FLATTENED) << std::endl;
+
+  return tchecker::ta::slice(sysdecl, system, coi);
+}
+
+/*!
+ \brief Merge equivalent clocks in a system declaration
+ \param sysdecl : system declaration
+ \return declaration of the system obtained from sysdecl by merging equivalent
+ clocks (see tchecker::ta::clock_equivalence_t)
+ \post the number of clocks in the merged system and in the system declared by
+ sysdecl have been output to standard output
+ */
+static std::shared_ptr<tchecker::parsing::system_declaration_t>
+merge_system_clocks(tchecker::parsing::system_declaration_t const & sysdecl)
+{
+  tchecker::ta::system_t system{sysdecl};
+  tchecker::ta::clock_equivalence_t equivalence{system};
+
+  std::cout << "MERGED_CLOCKS " << equivalence.classes_count() << "/" << equivalence.clocks_count() << std::endl;
+
+  return tchecker::ta::merge_clocks(sysdecl, system, equivalence);
+}
+
 void tck_reach(std::string output_filename, std::string sysdecl_filename, std::string labels, tck_reach_algorithm_t algorithm,
-               std::string search_order, tck_reach_certificate_t certificate, std::size_t  block_size, std::size_t table_size)
+               std::string search_order, tck_reach_certificate_t certificate, std::size_t  block_size, std::size_t table_size,
+               std::size_t swarm, std::string checkpoint_file, std::size_t checkpoint_interval, std::string resume_file,
+               std::string spill_directory, bool stream_graph, bool slice, bool merge_clocks,
+               enum tchecker::huge_pages_t huge_pages, bool incremental_gc, std::size_t max_memory, bool memory_stats,
+               std::size_t progress_interval, std::string progress_file)
 {
   try {
     std::shared_ptr<tchecker::parsing::system_declaration_t> sysdecl{nullptr};
@@ -237,7 +599,8 @@ void tck_reach(std::string output_filename, std::string sysdecl_filename, std::s
     std::ofstream ofs;
 
     if (output_filename != "") { 
-      ofs.open(output_filename, std::ios::out);
+      ofs.open(output_filename,
+               (certificate == CERTIFICATE_BINARY ? std::ios::out | std::ios::binary : std::ios::out));
         if (!ofs) {
             throw std::runtime_error("Failed to open file: " + output_filename);
         }
@@ -247,22 +610,111 @@ void tck_reach(std::string output_filename, std::string sysdecl_filename, std::s
       os = &std::cout;
     }
 
-    if (search_order != "bfs" && search_order != "dfs") {
+    std::vector<std::string> properties = split_properties(labels);
+    if ((properties.size() > 1) && ((swarm > 0) || ((algorithm != ALGO_REACH) && (algorithm != ALGO_COVREACH))))
+      throw std::runtime_error("Several sets of labels are only supported by algorithms reach and covreach");
+
+    if (slice)
+      sysdecl = slice_system_declaration(*sysdecl, properties);
+
+    if (merge_clocks)
+      sysdecl = merge_system_clocks(*sysdecl);
+
+    if ((!checkpoint_file.empty() || !resume_file.empty()) && ((swarm > 0) || (algorithm != ALGO_REACH)))
+      throw std::runtime_error("Checkpoint and resume are only supported by algorithm reach");
+
+    if (!spill_directory.empty() && ((swarm > 0) || ((algorithm != ALGO_REACH) && (algorithm != ALGO_COVREACH))))
+      throw std::runtime_error("Spilling states to disk is only supported by algorithms reach and covreach");
+
+    if ((huge_pages != tchecker::HUGE_PAGES_NONE) &&
+        ((swarm > 0) || ((algorithm != ALGO_REACH) && (algorithm != ALGO_COVREACH))))
+      throw std::runtime_error("Huge pages are only supported by algorithms reach and covreach");
+
+    if ((huge_pages != tchecker::HUGE_PAGES_NONE) && !spill_directory.empty())
+      throw std::runtime_error("Huge pages cannot be used with spilling to disk");
+
+    if (incremental_gc && ((swarm > 0) || (algorithm != ALGO_COVREACH)))
+      throw std::runtime_error("Incremental garbage collection is only supported by algorithm covreach");
+
+    if ((max_memory > 0) && ((swarm > 0) || ((algorithm != ALGO_REACH) && (algorithm != ALGO_COVREACH))))
+      throw std::runtime_error("Memory budget is only supported by algorithms reach and covreach");
+
+    if (memory_stats && ((swarm > 0) || ((algorithm != ALGO_REACH) && (algorithm != ALGO_COVREACH))))
+      throw std::runtime_error("Memory statistics are only supported by algorithms reach and covreach");
+
+    if (((progress_interval > 0) || !progress_file.empty()) &&
+        ((swarm > 0) || ((algorithm != ALGO_REACH) && (algorithm != ALGO_COVREACH))))
+      throw std::runtime_error("Progress reporting is only supported by algorithms reach and covreach");
+
+    if (!progress_file.empty() && (progress_interval == 0))
+      throw std::runtime_error("Progress file requires a progress interval");
+
+    if (stream_graph && ((swarm > 0) || (algorithm != ALGO_REACH)))
+      throw std::runtime_error("Streaming output is only supported by algorithm reach");
+
+    if ((certificate == CERTIFICATE_BINARY) && ((swarm > 0) || ((algorithm != ALGO_REACH) && (algorithm != ALGO_COVREACH))))
+      throw std::runtime_error("Binary graph certificates are only supported by algorithms reach and covreach");
+
+    if (swarm > 0) {
+      tck_reach_zg_swarm(*os, sysdecl, labels, swarm, block_size, table_size, certificate);
+      return;
+    }
+
+    if (tchecker::algorithms::is_guided_search_order(search_order)) {
+      if (algorithm != ALGO_REACH)
+        throw std::runtime_error("Search orders best-first and astar are only supported by algorithm reach");
+      if (!checkpoint_file.empty() || !resume_file.empty())
+        throw std::runtime_error("Checkpoint and resume are not supported by search orders best-first and astar");
+    }
+    else if (search_order == "ranking") {
+      if (algorithm != ALGO_COVREACH)
+        throw std::runtime_error("Search order ranking is only supported by algorithm covreach");
+    }
+    else if (search_order != "bfs" && search_order != "dfs") {
       throw std::runtime_error("Unknown search order");
     }
 
+    // progress reporter, stopped by the algorithm functions once the exploration is over
+
+    std::ofstream progress_ofs;
+    std::unique_ptr<tchecker::progress_reporter_t> reporter{nullptr};
+    if (progress_interval > 0) {
+      std::ostream * progress_os = &std::cerr;
+      if (!progress_file.empty()) {
+        progress_ofs.open(progress_file);
+        if (!progress_ofs)
+          throw std::runtime_error("Failed to open file: " + progress_file);
+        progress_os = &progress_ofs;
+      }
+      reporter = std::make_unique<tchecker::progress_reporter_t>(
+          *progress_os, (progress_file.empty() ? tchecker::PROGRESS_TEXT : tchecker::PROGRESS_JSON_LINES),
+          std::chrono::seconds{progress_interval});
+    }
+
     if (algorithm == ALGO_REACH) {
-      tck_reach_zg_reach(*os, *sysdecl, labels, search_order, block_size, table_size, certificate);
+      tck_reach_zg_reach(*os, *sysdecl, properties, search_order, block_size, table_size, certificate, checkpoint_file,
+                         checkpoint_interval, resume_file, spill_directory, stream_graph, huge_pages, max_memory,
+                         memory_stats, reporter.get());
     }
     else if (algorithm == ALGO_CONCUR19) {
       tck_reach_concur19(*os, *sysdecl, labels, search_order, block_size, table_size, certificate);
     }
     else if (algorithm == ALGO_COVREACH) {
-      tck_reach_zg_covreach(*os, *sysdecl, labels, search_order, block_size, table_size, certificate);
+      tck_reach_zg_covreach(*os, *sysdecl, properties, search_order, block_size, table_size, certificate, spill_directory,
+                            huge_pages, incremental_gc, max_memory, memory_stats, reporter.get());
     }
     else if (algorithm == ALGO_ALU_COVREACH) {
       tck_reach_zg_alu_covreach(*os, *sysdecl, labels, search_order, block_size, table_size, certificate);
     }
+    else if (algorithm == ALGO_PORTFOLIO) {
+      tck_reach_portfolio(*os, sysdecl, labels, search_order, block_size, table_size, certificate);
+    }
+    else if (algorithm == ALGO_BWD_REACH) {
+      tck_reach_zg_bwd_reach(*os, *sysdecl, labels, search_order, block_size, table_size, certificate);
+    }
+    else if (algorithm == ALGO_BIDIR_REACH) {
+      tck_reach_zg_bidir_reach(*os, *sysdecl, labels, search_order, block_size, table_size, certificate);
+    }
     else {
       throw std::runtime_error("Unknown algorithm");
     }
@@ -73,7 +73,8 @@ run(std::shared_ptr<tchecker::parsing::system_declaration_t> const & sysdecl_fir
     std::map<std::string, std::string> & second_starting_state, 
     std::string & inter_constraint,
     bool generate_witness,
-    std::vector<std::shared_ptr<tchecker::strong_timed_bisim::strategy::state_to_check_t>> & symbolic_states_to_check)
+    std::vector<std::shared_ptr<tchecker::strong_timed_bisim::strategy::state_to_check_t>> & symbolic_states_to_check,
+    tchecker::progress_t * progress)
 {
 
   std::vector<std::shared_ptr<tchecker::ta::system_t>> systems;
@@ -107,7 +108,8 @@ run(std::shared_ptr<tchecker::parsing::system_declaration_t> const & sysdecl_fir
     vcgs.push_back(vcg);
   }
 
-  auto algorithm = new tchecker::strong_timed_bisim::Lieb_et_al(vcgs[0], vcgs[1], generate_witness, !symbolic_states_to_check.empty());
+  auto algorithm = new tchecker::strong_timed_bisim::Lieb_et_al(vcgs[0], vcgs[1], generate_witness, !symbolic_states_to_check.empty(),
+                                                                progress);
 
   return algorithm->run(first_starting_state, second_starting_state, inter_constraint, symbolic_states_to_check);
 
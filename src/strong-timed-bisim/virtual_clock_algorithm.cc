@@ -25,10 +25,10 @@ namespace tchecker {
 namespace strong_timed_bisim {
 
 Lieb_et_al::Lieb_et_al(std::shared_ptr<tchecker::vcg::vcg_t> input_first, std::shared_ptr<tchecker::vcg::vcg_t> input_second,
-                       bool generate_witness, bool generate_strategy)
+                       bool generate_witness, bool generate_strategy, tchecker::progress_t * progress)
     : _A(input_first), _B(input_second), _visited_pair_of_states(0), 
       _non_bisim_cache(std::make_shared<non_bisim_cache::non_bisim_cache_t>(input_first->get_no_of_virtual_clocks(), generate_strategy)),
-      _witness(generate_witness)
+      _witness(generate_witness), _progress(progress)
 {
   assert(_A->get_no_of_virtual_clocks() == _B->get_no_of_virtual_clocks());
   assert(_A->get_urgent_or_committed() == _B->get_urgent_or_committed());
@@ -134,6 +134,9 @@ tchecker::strong_timed_bisim::stats_t Lieb_et_al::run(std::map<std::string, std:
   stats.set_visited_pair_of_states(_visited_pair_of_states);
   stats.set_relationship_fulfilled(result->contradiction_free());
 
+  if (_progress != nullptr)
+    _progress->publish(_visited_pair_of_states, visited->size(), 0, 0);
+
   return stats;
 }
 
@@ -177,6 +180,10 @@ std::shared_ptr<contradiction_t> Lieb_et_al::check_for_virt_bisim(tchecker::zg::
 
   _visited_pair_of_states++;
 
+  // pairs of states are expensive to check, progress is published for each of them
+  if (_progress != nullptr)
+    _progress->publish(_visited_pair_of_states, visited.size(), 0, 0);
+
   // std::cout << __FILE__ << ": " << __LINE__ << ": _visited_pair_of_states: " << _visited_pair_of_states << std::endl;
   // std::cout << __FILE__ << ": " << __LINE__ << ": check-for-virt-bisim" << std::endl;
 
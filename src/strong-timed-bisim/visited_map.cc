@@ -27,6 +27,8 @@ visited_map_t::visited_map_t(visited_map_t & t, std::shared_ptr<tchecker::vcg::v
 
 tchecker::clock_id_t visited_map_t::no_of_virtual_clocks() const { return this->_no_of_virtual_clocks; }
 
+std::size_t visited_map_t::size() const { return _storage->size(); }
+
 tchecker::strong_timed_bisim::visited_map_t::visited_map_storage_t::iterator visited_map_t::begin()
 {
   return _storage->begin();
@@ -0,0 +1,86 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <limits>
+#include <stdexcept>
+
+#include "tchecker/syncprod/packed_vloc.hh"
+
+namespace tchecker {
+
+/* vloc_packing_t */
+
+vloc_packing_t::vloc_packing_t(tchecker::system::system_t const & system)
+    : _words_count(0), _process(system.locations_count()), _index(system.locations_count()),
+      _locations(system.processes_count())
+{
+  unsigned const word_bits = std::numeric_limits<tchecker::packed_word_t>::digits;
+  unsigned used_bits = word_bits; // no word yet
+
+  _fields.reserve(system.processes_count());
+  for (tchecker::process_id_t pid = 0; pid < system.processes_count(); ++pid) {
+    for (tchecker::system::loc_const_shared_ptr_t const & loc : system.locations(pid)) {
+      _process[loc->id()] = pid;
+      _index[loc->id()] = static_cast<tchecker::loc_id_t>(_locations[pid].size());
+      _locations[pid].push_back(loc->id());
+    }
+
+    tchecker::packed_word_t const values = _locations[pid].size(); // largest value, 0 stands for NO_LOC
+    unsigned bits = 0;
+    while (bits < word_bits && (values >> bits) != 0)
+      ++bits;
+
+    if (bits > word_bits - used_bits) {
+      ++_words_count;
+      used_bits = 0;
+    }
+
+    field_t f;
+    f.word = static_cast<std::uint32_t>(bits == 0 ? 0 : _words_count - 1);
+    f.shift = (bits == 0 ? 0 : used_bits);
+    f.bits = bits;
+    f.mask = (bits == word_bits ? ~tchecker::packed_word_t{0} : (tchecker::packed_word_t{1} << bits) - 1);
+    _fields.push_back(f);
+
+    used_bits += bits;
+  }
+}
+
+void vloc_packing_t::pack(tchecker::vloc_t const & vloc, tchecker::packed_word_t * words) const
+{
+  if (vloc.size() != _fields.size())
+    throw std::invalid_argument("tchecker::vloc_packing_t::pack: tuple of locations has wrong size");
+
+  for (std::size_t w = 0; w < _words_count; ++w)
+    words[w] = 0;
+
+  for (tchecker::process_id_t pid = 0; pid < _fields.size(); ++pid) {
+    tchecker::loc_id_t const id = vloc[pid];
+    if (id == tchecker::NO_LOC)
+      continue;
+    if (id >= _process.size() || _process[id] != pid)
+      throw std::invalid_argument("tchecker::vloc_packing_t::pack: location does not belong to process");
+    field_t const & f = _fields[pid];
+    words[f.word] |= static_cast<tchecker::packed_word_t>(_index[id] + 1) << f.shift;
+  }
+}
+
+void vloc_packing_t::unpack(tchecker::packed_word_t const * words, tchecker::vloc_t & vloc) const
+{
+  if (vloc.size() != _fields.size())
+    throw std::invalid_argument("tchecker::vloc_packing_t::unpack: tuple of locations has wrong size");
+
+  for (tchecker::process_id_t pid = 0; pid < _fields.size(); ++pid) {
+    field_t const & f = _fields[pid];
+    tchecker::packed_word_t const value = (f.bits == 0 ? 0 : (words[f.word] >> f.shift) & f.mask);
+    if (value > _locations[pid].size())
+      throw std::invalid_argument("tchecker::vloc_packing_t::unpack: not a packed tuple of locations");
+    vloc[pid] = (value == 0 ? tchecker::NO_LOC : _locations[pid][value - 1]);
+  }
+}
+
+} // end of namespace tchecker
@@ -61,6 +61,20 @@ final_iterator_t::final_iterator_t(tchecker::syncprod::system_t const & system,
   advance_while_not_final();
 }
 
+final_iterator_t::final_iterator_t(
+    tchecker::syncprod::system_t const & system, boost::dynamic_bitset<> final_labels,
+    std::vector<tchecker::range_t<tchecker::system::locs_t::const_iterator_t>> const & locations)
+    : _system(system), _final_labels(final_labels)
+{
+  if (locations.size() != system.processes_count())
+    throw std::invalid_argument("tchecker::syncprod::final_iterator_t: locations has wrong size");
+
+  for (auto && r : locations)
+    _it.push_back(r);
+
+  advance_while_not_final();
+}
+
 bool final_iterator_t::operator==(tchecker::syncprod::final_iterator_t const & it) const
 {
   return (&_system == &it._system) && (_final_labels == it._final_labels) && (_it == it._it);
@@ -109,6 +123,14 @@ tchecker::syncprod::final_range_t final_edges(tchecker::syncprod::system_t const
   return tchecker::make_range(tchecker::syncprod::final_iterator_t{system, labels}, tchecker::past_the_end_iterator);
 }
 
+tchecker::syncprod::final_range_t
+final_edges(tchecker::syncprod::system_t const & system, boost::dynamic_bitset<> const & labels,
+            std::vector<tchecker::range_t<tchecker::system::locs_t::const_iterator_t>> const & locations)
+{
+  return tchecker::make_range(tchecker::syncprod::final_iterator_t{system, labels, locations},
+                              tchecker::past_the_end_iterator);
+}
+
 tchecker::state_status_t final(tchecker::syncprod::system_t const & system, tchecker::vloc_sptr_t const & vloc,
                                tchecker::vedge_sptr_t const & vedge, tchecker::sync_id_t & sync_id,
                                tchecker::syncprod::final_value_t const & v)
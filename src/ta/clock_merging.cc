@@ -0,0 +1,226 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <cctype>
+#include <iterator>
+#include <map>
+#include <stdexcept>
+#include <tuple>
+#include <unordered_map>
+
+#include "tchecker/expression/static_analysis.hh"
+#include "tchecker/statement/static_analysis.hh"
+#include "tchecker/ta/clock_merging.hh"
+
+namespace tchecker {
+
+namespace ta {
+
+/* clock_equivalence_t */
+
+/*!
+ \brief Kind of update of a clock along an edge
+ */
+enum clock_update_kind_t {
+  CLOCK_UNCHANGED, /*!< Clock is left unchanged */
+  CLOCK_RESET,     /*!< Clock is reset to a constant */
+  CLOCK_OTHER,     /*!< Any other update */
+};
+
+/*!
+ \brief Compute the kind of update of a clock
+ \param x : clock identifier
+ \param updates : list of updates of x along an edge
+ \return kind of update of x along with the reset value for CLOCK_RESET (0 otherwise)
+ */
+static std::tuple<enum clock_update_kind_t, tchecker::integer_t>
+clock_update_kind(tchecker::clock_id_t x, tchecker::clock_updates_list_t const & updates)
+{
+  auto it = updates.begin();
+  if (it == updates.end() || std::next(it) != updates.end())
+    return {CLOCK_OTHER, 0};
+  if (!tchecker::has_const_value(it->value()))
+    return {CLOCK_OTHER, 0};
+  tchecker::integer_t const value = tchecker::const_evaluate(it->value());
+  if (it->clock_id() == tchecker::REFCLOCK_ID)
+    return {CLOCK_RESET, value};
+  if (it->clock_id() == x && value == 0)
+    return {CLOCK_UNCHANGED, 0};
+  return {CLOCK_OTHER, 0};
+}
+
+clock_equivalence_t::clock_equivalence_t(tchecker::ta::system_t const & system)
+    : _representative(system.clocks_count(tchecker::VK_FLATTENED))
+{
+  std::size_t const clocks_count = _representative.size();
+
+  // Initial partition: clock arrays in their own class, all other clocks in class 0
+  std::vector<std::size_t> classes(clocks_count, 0);
+  std::size_t classes_count = 1;
+  for (tchecker::clock_id_t id : system.clocks_identifiers(tchecker::VK_DECLARED)) {
+    tchecker::variable_size_t const size = system.clock_variables().info(id).size();
+    if (size == 1)
+      continue;
+    for (tchecker::clock_id_t x = id; x < id + size; ++x)
+      classes[x] = classes_count++;
+  }
+
+  // Refinement w.r.t. the updates along each edge
+  for (tchecker::system::edge_const_shared_ptr_t const & edge : system.edges()) {
+    tchecker::clock_updates_map_t const updates = tchecker::compute_clock_updates(clocks_count, system.statement(edge->id()));
+
+    std::map<std::tuple<std::size_t, enum clock_update_kind_t, tchecker::integer_t>, std::size_t> refined;
+    std::vector<std::size_t> refined_classes(clocks_count);
+    for (tchecker::clock_id_t x = 0; x < clocks_count; ++x) {
+      auto && [kind, value] = clock_update_kind(x, updates[x]);
+      if (kind == CLOCK_OTHER)
+        refined_classes[x] = clocks_count + x; // distinct from all other keys
+      else
+        refined_classes[x] = refined.emplace(std::make_tuple(classes[x], kind, value), refined.size()).first->second;
+    }
+
+    // Renumber classes
+    std::unordered_map<std::size_t, std::size_t> renumbering;
+    for (tchecker::clock_id_t x = 0; x < clocks_count; ++x)
+      classes[x] = renumbering.emplace(refined_classes[x], renumbering.size()).first->second;
+  }
+
+  // Representatives: first clock in each class
+  std::unordered_map<std::size_t, tchecker::clock_id_t> representatives;
+  for (tchecker::clock_id_t x = 0; x < clocks_count; ++x)
+    _representative[x] = representatives.emplace(classes[x], x).first->second;
+}
+
+tchecker::clock_id_t clock_equivalence_t::representative(tchecker::clock_id_t id) const
+{
+  if (id >= _representative.size())
+    throw std::invalid_argument("tchecker::ta::clock_equivalence_t: clock identifier out of range");
+  return _representative[id];
+}
+
+std::size_t clock_equivalence_t::classes_count() const
+{
+  std::size_t count = 0;
+  for (tchecker::clock_id_t x = 0; x < _representative.size(); ++x)
+    if (_representative[x] == x)
+      ++count;
+  return count;
+}
+
+/* merge_clocks */
+
+/*!
+ \brief Check if a character may appear in an identifier
+ \param c : a character
+ \return true if c is alphanumeric, '_' or '$', false otherwise
+ */
+static inline bool is_identifier_char(char c) { return std::isalnum(static_cast<unsigned char>(c)) || c == '_' || c == '$'; }
+
+/*!
+ \brief Rename identifiers in a string
+ \param s : a string
+ \param renaming : map from identifiers to new identifiers
+ \return s where every identifier in the domain of renaming has been replaced by
+ its image
+ */
+static std::string rename_identifiers(std::string const & s, std::unordered_map<std::string, std::string> const & renaming)
+{
+  std::string renamed;
+  std::size_t i = 0;
+  while (i < s.size()) {
+    if (!is_identifier_char(s[i])) {
+      renamed += s[i++];
+      continue;
+    }
+    std::size_t j = i;
+    while (j < s.size() && is_identifier_char(s[j]))
+      ++j;
+    std::string const identifier = s.substr(i, j - i);
+    auto it = renaming.find(identifier);
+    renamed += (it == renaming.end() ? identifier : it->second);
+    i = j;
+  }
+  return renamed;
+}
+
+/*!
+ \brief Rename identifiers in attributes
+ \param attributes : attributes
+ \param renaming : map from identifiers to new identifiers
+ \return attributes where identifiers in the values of attributes "provided",
+ "do" and "invariant" have been renamed w.r.t. renaming
+ */
+static tchecker::parsing::attributes_t rename_attributes(tchecker::parsing::attributes_t const & attributes,
+                                                         std::unordered_map<std::string, std::string> const & renaming)
+{
+  tchecker::parsing::attributes_t renamed;
+  for (tchecker::parsing::attr_t const & attr : attributes) {
+    if (attr.key() == "provided" || attr.key() == "do" || attr.key() == "invariant")
+      renamed.insert(std::make_shared<tchecker::parsing::attr_t>(attr.key(), rename_identifiers(attr.value(), renaming),
+                                                                 attr.parsing_position()));
+    else
+      renamed.insert(std::make_shared<tchecker::parsing::attr_t>(attr));
+  }
+  return renamed;
+}
+
+std::shared_ptr<tchecker::parsing::system_declaration_t>
+merge_clocks(tchecker::parsing::system_declaration_t const & sysdecl, tchecker::ta::system_t const & system,
+             tchecker::ta::clock_equivalence_t const & equivalence)
+{
+  std::shared_ptr<tchecker::parsing::system_declaration_t> merged =
+      std::make_shared<tchecker::parsing::system_declaration_t>(sysdecl.name(), sysdecl.attributes(), sysdecl.context());
+
+  // Merged clocks are not arrays, hence their flattened and declared identifiers coincide
+  std::unordered_map<std::string, std::string> renaming;
+  for (tchecker::clock_id_t id : system.clocks_identifiers(tchecker::VK_DECLARED)) {
+    tchecker::clock_id_t const representative = equivalence.representative(id);
+    if (representative != id)
+      renaming[system.clock_name(id)] = system.clock_name(representative);
+  }
+
+  bool inserted = true;
+  for (std::shared_ptr<tchecker::parsing::inner_declaration_t> const & d : sysdecl.declarations()) {
+    if (auto clock_decl = std::dynamic_pointer_cast<tchecker::parsing::clock_declaration_t>(d)) {
+      if (renaming.find(clock_decl->name()) == renaming.end())
+        inserted = merged->insert_clock_declaration(clock_decl);
+    }
+    else if (auto int_decl = std::dynamic_pointer_cast<tchecker::parsing::int_declaration_t>(d))
+      inserted = merged->insert_int_declaration(int_decl);
+    else if (auto proc_decl = std::dynamic_pointer_cast<tchecker::parsing::process_declaration_t>(d))
+      inserted = merged->insert_process_declaration(proc_decl);
+    else if (auto event_decl = std::dynamic_pointer_cast<tchecker::parsing::event_declaration_t>(d))
+      inserted = merged->insert_event_declaration(event_decl);
+    else if (auto loc_decl = std::dynamic_pointer_cast<tchecker::parsing::location_declaration_t>(d)) {
+      inserted = merged->insert_location_declaration(std::make_shared<tchecker::parsing::location_declaration_t>(
+          loc_decl->name(), sysdecl.get_process_declaration(loc_decl->process().name()),
+          rename_attributes(loc_decl->attributes(), renaming), loc_decl->context()));
+    }
+    else if (auto edge_decl = std::dynamic_pointer_cast<tchecker::parsing::edge_declaration_t>(d)) {
+      std::string const & process_name = edge_decl->process().name();
+      inserted = merged->insert_edge_declaration(std::make_shared<tchecker::parsing::edge_declaration_t>(
+          sysdecl.get_process_declaration(process_name),
+          merged->get_location_declaration(process_name, edge_decl->src().name()),
+          merged->get_location_declaration(process_name, edge_decl->tgt().name()),
+          sysdecl.get_event_declaration(edge_decl->event().name()), rename_attributes(edge_decl->attributes(), renaming),
+          edge_decl->context()));
+    }
+    else if (auto sync_decl = std::dynamic_pointer_cast<tchecker::parsing::sync_declaration_t>(d))
+      inserted = merged->insert_sync_declaration(sync_decl);
+    else
+      throw std::runtime_error("tchecker::ta::merge_clocks: unknown declaration");
+
+    if (!inserted)
+      throw std::runtime_error("tchecker::ta::merge_clocks: cannot insert declaration");
+  }
+
+  return merged;
+}
+
+} // end of namespace ta
+
+} // end of namespace tchecker
@@ -0,0 +1,171 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <stdexcept>
+#include <vector>
+
+#include "tchecker/ta/slicing.hh"
+#include "tchecker/variables/access.hh"
+#include "tchecker/variables/static_analysis.hh"
+
+namespace tchecker {
+
+namespace ta {
+
+/* is_constraining_process */
+
+bool is_constraining_process(tchecker::ta::system_t const & system, tchecker::process_id_t pid)
+{
+  auto initial_locations = system.initial_locations(pid);
+  if (initial_locations.begin() == initial_locations.end())
+    return true;
+
+  for (tchecker::system::loc_const_shared_ptr_t const & loc : system.locations(pid)) {
+    if (system.is_committed(loc->id()) || system.is_urgent(loc->id()))
+      return true;
+    auto invariant = loc->attributes().range("invariant");
+    if (invariant.begin() != invariant.end())
+      return true;
+  }
+  return false;
+}
+
+/* cone_of_influence_t */
+
+cone_of_influence_t::cone_of_influence_t(tchecker::ta::system_t const & system, boost::dynamic_bitset<> const & labels)
+    : _processes(system.processes_count()), _intvars(system.intvars_count(tchecker::VK_FLATTENED)),
+      _clocks(system.clocks_count(tchecker::VK_FLATTENED))
+{
+  if (labels.size() != system.labels_count())
+    throw std::invalid_argument("tchecker::ta::cone_of_influence_t: labels has wrong size");
+
+  tchecker::variable_access_map_t const vaccess = tchecker::variable_access(system);
+
+  // Synchronizations of each process
+  std::vector<std::vector<tchecker::sync_id_t>> process_syncs(system.processes_count());
+  for (tchecker::sync_id_t sync_id : system.synchronizations_identifiers())
+    for (tchecker::system::sync_constraint_t const & c : system.synchronization(sync_id).synchronization_constraints())
+      process_syncs[c.pid()].push_back(sync_id);
+
+  std::vector<tchecker::process_id_t> waiting;
+
+  auto add_process = [&](tchecker::process_id_t pid) {
+    if (_processes[pid])
+      return;
+    _processes[pid] = 1;
+    waiting.push_back(pid);
+  };
+
+  // Initial processes
+  for (tchecker::system::loc_const_shared_ptr_t const & loc : system.locations())
+    if (system.labels(loc->id()).intersects(labels))
+      add_process(loc->pid());
+
+  for (tchecker::process_id_t pid : system.processes_identifiers())
+    if (is_constraining_process(system, pid))
+      add_process(pid);
+
+  // Closure w.r.t. synchronizations and variables
+  while (!waiting.empty()) {
+    tchecker::process_id_t pid = waiting.back();
+    waiting.pop_back();
+
+    for (tchecker::sync_id_t sync_id : process_syncs[pid])
+      for (tchecker::system::sync_constraint_t const & c : system.synchronization(sync_id).synchronization_constraints())
+        add_process(c.pid());
+
+    for (tchecker::variable_id_t id : vaccess.accessed_variables(pid, tchecker::VTYPE_INTVAR, tchecker::VACCESS_READ))
+      for (tchecker::process_id_t writer : vaccess.accessing_processes(id, tchecker::VTYPE_INTVAR, tchecker::VACCESS_WRITE))
+        add_process(writer);
+
+    for (tchecker::variable_id_t id : vaccess.accessed_variables(pid, tchecker::VTYPE_CLOCK, tchecker::VACCESS_READ))
+      for (tchecker::process_id_t writer : vaccess.accessing_processes(id, tchecker::VTYPE_CLOCK, tchecker::VACCESS_WRITE))
+        add_process(writer);
+  }
+
+  // Variables accessed by the processes in the cone
+  for (std::size_t pid = _processes.find_first(); pid != boost::dynamic_bitset<>::npos; pid = _processes.find_next(pid)) {
+    for (tchecker::variable_id_t id : vaccess.accessed_variables(pid, tchecker::VTYPE_INTVAR, tchecker::VACCESS_ANY))
+      _intvars[id] = 1;
+    for (tchecker::variable_id_t id : vaccess.accessed_variables(pid, tchecker::VTYPE_CLOCK, tchecker::VACCESS_ANY))
+      _clocks[id] = 1;
+  }
+}
+
+/* slice */
+
+/*!
+ \brief Check if a declared variable is in a cone
+ \param id : identifier of a declared variable
+ \param size : size of the declared variable
+ \param flattened : set of flattened variables in the cone
+ \return true if one of the size flattened variables starting at id is in
+ flattened, false otherwise
+ */
+static bool in_cone(tchecker::variable_id_t id, tchecker::variable_size_t size, boost::dynamic_bitset<> const & flattened)
+{
+  for (tchecker::variable_id_t i = id; i < id + size; ++i)
+    if (flattened[i])
+      return true;
+  return false;
+}
+
+std::shared_ptr<tchecker::parsing::system_declaration_t> slice(tchecker::parsing::system_declaration_t const & sysdecl,
+                                                               tchecker::ta::system_t const & system,
+                                                               tchecker::ta::cone_of_influence_t const & coi)
+{
+  std::shared_ptr<tchecker::parsing::system_declaration_t> sliced =
+      std::make_shared<tchecker::parsing::system_declaration_t>(sysdecl.name(), sysdecl.attributes(), sysdecl.context());
+
+  auto keep_process = [&](std::string const & name) { return coi.processes()[system.process_id(name)] == 1; };
+
+  bool inserted = true;
+  for (std::shared_ptr<tchecker::parsing::inner_declaration_t> const & d : sysdecl.declarations()) {
+    if (auto clock_decl = std::dynamic_pointer_cast<tchecker::parsing::clock_declaration_t>(d)) {
+      tchecker::clock_id_t id = system.clock_id(clock_decl->name());
+      if (in_cone(id, system.clock_variables().info(id).size(), coi.clocks()))
+        inserted = sliced->insert_clock_declaration(clock_decl);
+    }
+    else if (auto int_decl = std::dynamic_pointer_cast<tchecker::parsing::int_declaration_t>(d)) {
+      tchecker::intvar_id_t id = system.intvar_id(int_decl->name());
+      if (in_cone(id, system.integer_variables().info(id).size(), coi.intvars()))
+        inserted = sliced->insert_int_declaration(int_decl);
+    }
+    else if (auto proc_decl = std::dynamic_pointer_cast<tchecker::parsing::process_declaration_t>(d)) {
+      if (keep_process(proc_decl->name()))
+        inserted = sliced->insert_process_declaration(proc_decl);
+    }
+    else if (auto event_decl = std::dynamic_pointer_cast<tchecker::parsing::event_declaration_t>(d))
+      inserted = sliced->insert_event_declaration(event_decl);
+    else if (auto loc_decl = std::dynamic_pointer_cast<tchecker::parsing::location_declaration_t>(d)) {
+      if (keep_process(loc_decl->process().name()))
+        inserted = sliced->insert_location_declaration(loc_decl);
+    }
+    else if (auto edge_decl = std::dynamic_pointer_cast<tchecker::parsing::edge_declaration_t>(d)) {
+      if (keep_process(edge_decl->process().name()))
+        inserted = sliced->insert_edge_declaration(edge_decl);
+    }
+    else if (auto sync_decl = std::dynamic_pointer_cast<tchecker::parsing::sync_declaration_t>(d)) {
+      bool keep = true;
+      for (std::shared_ptr<tchecker::parsing::sync_constraint_t> const & c : sync_decl->sync_constraints())
+        keep = keep && keep_process(c->process().name());
+      if (keep)
+        inserted = sliced->insert_sync_declaration(sync_decl);
+    }
+    else
+      throw std::runtime_error("tchecker::ta::slice: unknown declaration");
+
+    if (!inserted)
+      throw std::runtime_error("tchecker::ta::slice: cannot insert declaration");
+  }
+
+  return sliced;
+}
+
+} // end of namespace ta
+
+} // end of namespace tchecker
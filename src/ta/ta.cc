@@ -55,6 +55,15 @@ tchecker::ta::final_range_t final_edges(tchecker::ta::system_t const & system, b
   return tchecker::make_range(it, tchecker::past_the_end_iterator);
 }
 
+tchecker::ta::final_range_t
+final_edges(tchecker::ta::system_t const & system, boost::dynamic_bitset<> const & labels,
+            std::vector<tchecker::range_t<tchecker::system::locs_t::const_iterator_t>> const & locations)
+{
+  tchecker::ta::final_iterator_t it{tchecker::syncprod::final_edges(system.as_syncprod_system(), labels, locations),
+                                    tchecker::flat_integer_variables_valuations_range(system.integer_variables().flattened())};
+  return tchecker::make_range(it, tchecker::past_the_end_iterator);
+}
+
 tchecker::state_status_t final(tchecker::ta::system_t const & system, tchecker::vloc_sptr_t const & vloc,
                                tchecker::intval_sptr_t const & intval, tchecker::vedge_sptr_t const & vedge,
                                tchecker::sync_id_t & sync_id, tchecker::clock_constraint_container_t & invariant,
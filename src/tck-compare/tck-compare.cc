@@ -34,6 +34,8 @@ static struct option long_options[] = {{"relationship", required_argument, 0, 'r
                                        {"sSecond", required_argument, 0, 0},
                                        {"interConstraint", required_argument, 0, 0},
                                        {"allReachableStates", no_argument, 0, 0},
+                                       {"progress", required_argument, 0, 0},
+                                       {"progress-file", required_argument, 0, 0},
                                        {0, 0, 0, 0}};
 
 static char const * const options = (char *)"hr:n:o:W";
@@ -54,6 +56,11 @@ void usage(char * progname)
   std::cerr << "   --sSecond state    starting state of the second VCG, specified as a JSON object with keys vloc, intval and zone" << std::endl;
   std::cerr << "   --interConstraint  constraint between the starting states. Clocks from the first model must be postfixed with _1 and analogously for the second." << std::endl;
   std::cerr << "   --allReachableStates covers all reachable states of the first system" << std::endl;
+  std::cerr << "   --progress s       report visited pairs of symbolic states, pairs/s, pairs of TA states in the"
+            << std::endl;
+  std::cerr << "                      visited map and resident memory every s seconds on standard error" << std::endl;
+  std::cerr << "   --progress-file file  write progress reports to file in JSON lines format instead (requires --progress)"
+            << std::endl;
 }
 
 enum tck_compare_relationship_t relationship = STRONG_TIMED_BISIM;   /*!< Selected relationship */
@@ -67,6 +74,8 @@ std::size_t table_size = 65536;                    /*!< Size of hash tables */
 std::string first_starting_state_json = ""; 
 std::string second_starting_state_json = "";
 std::string inter_constraint = "";
+std::size_t progress_interval = 0;                 /*!< Time between two progress reports (seconds, 0 means none) */
+std::string progress_file = "";                    /*!< Progress reports file name (empty means standard error) */
 
 
 /*!
@@ -127,6 +136,12 @@ int parse_command_line(int argc, char * argv[])
         inter_constraint = optarg;
       } else if (strcmp(long_options[long_option_index].name, "allReachableStates") == 0) {
         all_reachable_states = true;
+      } else if (strcmp(long_options[long_option_index].name, "progress") == 0) {
+        progress_interval = std::strtoull(optarg, nullptr, 10);
+        if (progress_interval == 0)
+          throw std::runtime_error("Progress interval must be positive");
+      } else if (strcmp(long_options[long_option_index].name, "progress-file") == 0) {
+        progress_file = optarg;
       }
       else {
         throw std::runtime_error("This should never be executed");
@@ -163,7 +178,8 @@ int main(int argc, char * argv[]) {
     tchecker::publicapi::tck_compare(output_file, first_input, second_input,
                                      relationship, block_size, table_size, 
                                      first_starting_state_json, second_starting_state_json,
-                                     inter_constraint, witness, all_reachable_states);
+                                     inter_constraint, witness, all_reachable_states,
+                                     progress_interval, progress_file);
 
     if (tchecker::log_error_count() > 0)
       return EXIT_FAILURE;
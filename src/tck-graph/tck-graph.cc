@@ -0,0 +1,138 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <cstring>
+#include <fstream>
+#include <getopt.h>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include "tchecker/graph/binary.hh"
+#include "tchecker/graph/output.hh"
+
+/*!
+ \file tck-graph.cc
+ \brief Post-processing of graphs output by TChecker tools (canonical ordering,
+ conversion of binary graphs)
+ */
+
+static struct option long_options[] = {{"binary", no_argument, 0, 'b'},
+                                       {"canonical", no_argument, 0, 'c'},
+                                       {"output", required_argument, 0, 'o'},
+                                       {"help", no_argument, 0, 'h'},
+                                       {0, 0, 0, 0}};
+
+static char * const options = (char *)"bcho:";
+
+void usage(char * progname)
+{
+  std::cerr << "Usage: " << progname << " [options] [file]" << std::endl;
+  std::cerr << "   -b          convert a graph in binary format to dot graphviz file format" << std::endl;
+  std::cerr << "   -c          output graph in canonical order (default)" << std::endl;
+  std::cerr << "   -o file     output file" << std::endl;
+  std::cerr << "   -h          help" << std::endl;
+  std::cerr << "reads a graph in dot graphviz file format, e.g. output by tck-reach --stream, or in binary format" << std::endl;
+  std::cerr << "reads from standard input if file is not provided (except with -b)" << std::endl;
+}
+
+static bool binary = false;
+static bool help = false;
+static std::string output_file = "";
+
+int parse_command_line(int argc, char * argv[])
+{
+  while (true) {
+    int long_option_index = -1;
+    int c = getopt_long(argc, argv, options, long_options, &long_option_index);
+
+    if (c == -1)
+      break;
+
+    if (c == ':')
+      throw std::runtime_error("Missing option parameter");
+    else if (c == '?')
+      throw std::runtime_error("Unknown command-line option");
+    else if (c != 0) {
+      switch (c) {
+      case 'b':
+        binary = true;
+        break;
+      case 'c':
+        binary = false;
+        break;
+      case 'h':
+        help = true;
+        break;
+      case 'o':
+        if (strcmp(optarg, "") == 0)
+          throw std::invalid_argument("Invalid empty output file name");
+        output_file = optarg;
+        break;
+      default:
+        throw std::runtime_error("This should never be executed");
+        break;
+      }
+    }
+    else
+      throw std::runtime_error("This also should never be executed");
+  }
+
+  return optind;
+}
+
+/*!
+ \brief Main function
+*/
+int main(int argc, char * argv[])
+{
+  try {
+    int optindex = parse_command_line(argc, argv);
+
+    if (argc - optindex > 1) {
+      std::cerr << "Too many input files" << std::endl;
+      usage(argv[0]);
+      return EXIT_FAILURE;
+    }
+
+    if (help) {
+      usage(argv[0]);
+      return EXIT_SUCCESS;
+    }
+
+    if (binary && (optindex == argc)) {
+      std::cerr << "Option -b requires an input file" << std::endl;
+      usage(argv[0]);
+      return EXIT_FAILURE;
+    }
+
+    std::shared_ptr<std::ostream> os{&std::cout, [](std::ostream *) {}};
+    if (output_file != "")
+      os = std::make_shared<std::ofstream>(output_file, std::ios::out);
+
+    if (binary) {
+      tchecker::graph::binary::mapped_graph_t g{argv[optindex]};
+      tchecker::graph::binary::dot_output(*os, g);
+      return EXIT_SUCCESS;
+    }
+
+    std::shared_ptr<std::istream> is{&std::cin, [](std::istream *) {}};
+    if (optindex < argc) {
+      is = std::make_shared<std::ifstream>(argv[optindex]);
+      if (!*is)
+        throw std::runtime_error("Cannot open input file " + std::string{argv[optindex]});
+    }
+
+    tchecker::graph::dot_canonical_output(*is, *os);
+  }
+  catch (std::exception & e) {
+    std::cerr << e.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -29,6 +29,9 @@ static struct option long_options[] = {{"algorithm", required_argument, 0, 'a'},
                                        {"output", required_argument, 0, 'o'},
                                        {"block-size", required_argument, 0, 0},
                                        {"table-size", required_argument, 0, 0},
+                                       {"threads", required_argument, 0, 0},
+                                       {"progress", required_argument, 0, 0},
+                                       {"progress-file", required_argument, 0, 0},
                                        {0, 0, 0, 0}};
 
 static char const * const options = (char *)"a:C:hl:o:";
@@ -45,9 +48,15 @@ void usage(char * progname)
   std::cerr << "                     search an accepting cycle that visits all labels" << std::endl;
   std::cerr << "          ndfs       nested depth-first search algorithm over the zone graph" << std::endl;
   std::cerr << "                     search an accepting cycle with a state with all labels" << std::endl;
+  std::cerr << "          sndfs      nested depth-first search algorithm with zone inclusion subsumption" << std::endl;
+  std::cerr << "                     search an accepting cycle with a state with all labels (no symbolic certificate)"
+            << std::endl;
+  std::cerr << "          ufscc      parallel union-find SCC-based algorithm over the zone graph" << std::endl;
+  std::cerr << "                     search an accepting cycle that visits all labels (no certificate)" << std::endl;
   std::cerr << "   -C type       type of certificate" << std::endl;
   std::cerr << "          none       no certificate (default)" << std::endl;
   std::cerr << "          graph      graph of explored state-space" << std::endl;
+  std::cerr << "          binary     graph of explored state-space in binary format (see tck-graph)" << std::endl;
   std::cerr << "          symbolic   symbolic lasso run with loop on labels (not for couvscc with multiple labels)"
             << std::endl;
   std::cerr << "   -h            help" << std::endl;
@@ -55,6 +64,12 @@ void usage(char * progname)
   std::cerr << "   -o out_file   output file for certificate (default is standard output)" << std::endl;
   std::cerr << "   --block-size  size of allocation blocks" << std::endl;
   std::cerr << "   --table-size  size of hash tables" << std::endl;
+  std::cerr << "   --threads n   number of threads for ufscc (default: number of cores)" << std::endl;
+  std::cerr << "   --progress s  report visited and stored states, states/s, nodes on the DFS stacks, subsumed ratio (sndfs)"
+            << std::endl;
+  std::cerr << "                 and resident memory every s seconds on standard error" << std::endl;
+  std::cerr << "   --progress-file file  write progress reports to file in JSON lines format instead (requires --progress)"
+            << std::endl;
   std::cerr << "reads from standard input if file is not provided" << std::endl;
 }
 
@@ -65,6 +80,9 @@ static std::string labels = "";                                        /*!< Sear
 static std::string output_file = "";                                   /*!< Output file name (empty means standard output) */
 static std::size_t block_size = 10000;                                 /*!< Size of allocated blocks */
 static std::size_t table_size = 65536;                                 /*!< Size of hash tables */
+static std::size_t threads = 0;                                        /*!< Number of threads (0: hardware concurrency) */
+static std::size_t progress_interval = 0;                              /*!< Seconds between progress reports (0: none) */
+static std::string progress_file = "";                                 /*!< Progress reports file (empty: standard error) */
 
 /*!
  \brief Parse command-line arguments
@@ -94,6 +112,10 @@ int parse_command_line(int argc, char * argv[])
           algorithm = ALGO_NDFS;
         else if (strcmp(optarg, "couvscc") == 0)
           algorithm = ALGO_COUVSCC;
+        else if (strcmp(optarg, "sndfs") == 0)
+          algorithm = ALGO_SNDFS;
+        else if (strcmp(optarg, "ufscc") == 0)
+          algorithm = ALGO_UFSCC;
         else
           throw std::runtime_error("Unknown algorithm: " + std::string(optarg));
         break;
@@ -102,6 +124,8 @@ int parse_command_line(int argc, char * argv[])
           certificate = CERTIFICATE_NONE;
         else if (strcmp(optarg, "graph") == 0)
           certificate = CERTIFICATE_GRAPH;
+        else if (strcmp(optarg, "binary") == 0)
+          certificate = CERTIFICATE_BINARY;
         else if (strcmp(optarg, "symbolic") == 0)
           certificate = CERTIFICATE_SYMBOLIC;
         else
@@ -126,6 +150,15 @@ int parse_command_line(int argc, char * argv[])
         block_size = std::strtoull(optarg, nullptr, 10);
       else if (strcmp(long_options[long_option_index].name, "table-size") == 0)
         table_size = std::strtoull(optarg, nullptr, 10);
+      else if (strcmp(long_options[long_option_index].name, "threads") == 0)
+        threads = std::strtoull(optarg, nullptr, 10);
+      else if (strcmp(long_options[long_option_index].name, "progress") == 0) {
+        progress_interval = std::strtoull(optarg, nullptr, 10);
+        if (progress_interval == 0)
+          throw std::runtime_error("Progress interval must be positive");
+      }
+      else if (strcmp(long_options[long_option_index].name, "progress-file") == 0)
+        progress_file = optarg;
       else
         throw std::runtime_error("This also should never be executed");
     }
@@ -155,7 +188,8 @@ int main(int argc, char * argv[])
 
     std::string input_file = (optindex == argc ? "" : argv[optindex]);
 
-    tchecker::publicapi::tck_liveness(output_file, input_file, labels, algorithm, certificate, block_size, table_size);
+    tchecker::publicapi::tck_liveness(output_file, input_file, labels, algorithm, certificate, block_size, table_size,
+                                      threads, progress_interval, progress_file);
 
     if (tchecker::log_error_count() > 0)
       return EXIT_FAILURE;
@@ -29,6 +29,20 @@ static struct option long_options[] = {{"algorithm", required_argument, 0, 'a'},
                                        {"search-order", no_argument, 0, 's'},
                                        {"block-size", required_argument, 0, 0},
                                        {"table-size", required_argument, 0, 0},
+                                       {"huge-pages", required_argument, 0, 0},
+                                       {"incremental-gc", no_argument, 0, 0},
+                                       {"max-memory", required_argument, 0, 0},
+                                       {"memory-stats", no_argument, 0, 0},
+                                       {"progress", required_argument, 0, 0},
+                                       {"progress-file", required_argument, 0, 0},
+                                       {"swarm", required_argument, 0, 0},
+                                       {"checkpoint", required_argument, 0, 0},
+                                       {"checkpoint-interval", required_argument, 0, 0},
+                                       {"resume", required_argument, 0, 0},
+                                       {"spill-dir", required_argument, 0, 0},
+                                       {"stream", no_argument, 0, 0},
+                                       {"slice", no_argument, 0, 0},
+                                       {"merge-clocks", no_argument, 0, 0},
                                        {0, 0, 0, 0}};
 
 static char const * const options = (char *)"a:C:hl:o:s:";
@@ -46,18 +60,66 @@ void usage(char * progname)
             << std::endl;
   std::cerr << "          covreach       reachability algorithm over the zone graph with inclusion subsumption" << std::endl;
   std::cerr << "          aLU-covreach   reachability algorithm over the zone graph with aLU subsumption" << std::endl;
+  std::cerr << "          portfolio      all algorithms above in parallel, the first one to answer wins (only reach and"
+            << std::endl;
+  std::cerr << "                         covreach for concrete counter-examples)" << std::endl;
+  std::cerr << "          bwd-reach      backward reachability algorithm over the zone graph" << std::endl;
+  std::cerr << "          bidir-reach    bidirectional reachability algorithm over the zone graph" << std::endl;
   std::cerr << "   -C type       type of certificate" << std::endl;
   std::cerr << "          none       no certificate (default)" << std::endl;
   std::cerr << "          graph      graph of explored state-space" << std::endl;
+  std::cerr << "          binary     graph of explored state-space in binary format (reach and covreach, see tck-graph)"
+            << std::endl;
   std::cerr << "          symbolic   symbolic run to a state with searched labels if any" << std::endl;
-  std::cerr << "          concrete   concrete run to a state with searched labels if any (only for reach and covreach)"
+  std::cerr << "          concrete   concrete run to a state with searched labels if any (only for reach, covreach and portfolio)"
             << std::endl;
   std::cerr << "   -h            help" << std::endl;
   std::cerr << "   -l l1,l2,...  comma-separated list of searched labels" << std::endl;
+  std::cerr << "                 repeat -l (or separate lists with ;) to check several lists in one exploration" << std::endl;
+  std::cerr << "                 (only for reach and covreach)" << std::endl;
   std::cerr << "   -o out_file   output file for certificate (default is standard output)" << std::endl;
-  std::cerr << "   -s bfs|dfs    search order" << std::endl;
+  std::cerr << "   -s bfs|dfs|best-first|astar|ranking  search order" << std::endl;
+  std::cerr << "                 best-first and astar are guided by distances to searched labels in the processes" << std::endl;
+  std::cerr << "                 (only for reach)" << std::endl;
+  std::cerr << "                 ranking explores first the nodes that cover already explored nodes (only for covreach)"
+            << std::endl;
   std::cerr << "   --block-size  size of allocation blocks" << std::endl;
   std::cerr << "   --table-size  size of hash tables" << std::endl;
+  std::cerr << "   --huge-pages mode  back allocation blocks and hash tables by 2MB huge pages" << std::endl;
+  std::cerr << "                 (only for reach and covreach), mode is thp (transparent huge pages) or explicit"
+            << std::endl;
+  std::cerr << "                 (pages reserved in /proc/sys/vm/nr_hugepages)" << std::endl;
+  std::cerr << "   --incremental-gc  collect unused states incrementally during the run (only for covreach)" << std::endl;
+  std::cerr << "   --max-memory GB  memory budget of states and graph: edges are dropped (no certificate) close to the"
+            << std::endl;
+  std::cerr << "                 budget, and the exploration stops beyond it (only for reach and covreach)" << std::endl;
+  std::cerr << "   --memory-stats  output memory reserved and live by states, components, graph and hash tables"
+            << std::endl;
+  std::cerr << "                 (only for reach and covreach)" << std::endl;
+  std::cerr << "   --progress s  report visited and stored states, states/s, waiting nodes, covered ratio and resident"
+            << std::endl;
+  std::cerr << "                 memory every s seconds on standard error (only for reach and covreach)" << std::endl;
+  std::cerr << "   --progress-file file  write progress reports to file in JSON lines format instead (requires --progress)"
+            << std::endl;
+  std::cerr << "   --swarm N     swarm verification: run N diversified searches in parallel, stop at first result" << std::endl;
+  std::cerr << "                 (overrides -a and -s, instances cycle over reach, covreach, aLU-covreach, and bfs, dfs)"
+            << std::endl;
+  std::cerr << "                 aLU-covreach is left out for concrete counter-examples" << std::endl;
+  std::cerr << "   --checkpoint file  save the state of the exploration to file periodically (only for reach)" << std::endl;
+  std::cerr << "   --checkpoint-interval s  time between two checkpoints in seconds (default: 600)" << std::endl;
+  std::cerr << "   --resume file  resume the exploration saved in checkpoint file (only for reach, no certificate)"
+            << std::endl;
+  std::cerr << "   --spill-dir dir  store zones and integer valuations in memory-mapped files in dir, evicted to disk"
+            << std::endl;
+  std::cerr << "                 when memory runs low (only for reach and covreach)" << std::endl;
+  std::cerr << "   --stream      output the graph certificate while it is explored, in exploration order (only for reach)"
+            << std::endl;
+  std::cerr << "                 use tck-graph to order it canonically" << std::endl;
+  std::cerr << "   --slice       remove processes, variables and clocks that cannot influence the searched labels" << std::endl;
+  std::cerr << "                 before exploration (certificates refer to the sliced system)" << std::endl;
+  std::cerr << "   --merge-clocks  merge clocks that always have the same value before exploration (certificates refer"
+            << std::endl;
+  std::cerr << "                 to the merged system)" << std::endl;
   std::cerr << "reads from standard input if file is not provided" << std::endl;
 }
 
@@ -65,10 +127,25 @@ static enum tck_reach_algorithm_t algorithm = ALGO_NONE;            /*!< Selecte
 static bool help = false;                                 /*!< Help flag */
 static enum tck_reach_certificate_t certificate = CERTIFICATE_NONE; /*!< Type of certificate */
 static std::string search_order = "bfs";                  /*!< Search order */
-static std::string labels = "";                           /*!< Searched labels */
+static std::string labels = "";                           /*!< Searched labels (semicolon-separated list of sets) */
+static bool labels_set = false;                           /*!< Labels have been set on command line */
 static std::string output_file = "";                      /*!< Output file name (empty means standard output) */
 static std::size_t block_size = TCK_REACH_INIT_BLOCK_SIZE;                    /*!< Size of allocated blocks */
 static std::size_t table_size = TCK_REACH_INIT_TABLE_SIZE;                    /*!< Size of hash tables */
+static enum tchecker::huge_pages_t huge_pages = tchecker::HUGE_PAGES_NONE;    /*!< Huge pages mode of allocation blocks */
+static bool incremental_gc = false;                                           /*!< Incremental garbage collection */
+static std::size_t max_memory = 0;                                            /*!< Memory budget in bytes (0 means none) */
+static bool memory_stats = false;                                             /*!< Output memory statistics */
+static std::size_t progress_interval = 0;                 /*!< Time between two progress reports (seconds, 0 means none) */
+static std::string progress_file = "";                    /*!< Progress reports file name (empty means standard error) */
+static std::size_t swarm = 0;                             /*!< Number of swarm instances (0 means no swarm) */
+static std::string checkpoint_file = "";                  /*!< Checkpoint file name (empty means no checkpoint) */
+static std::size_t checkpoint_interval = 600;             /*!< Time between two checkpoints (seconds) */
+static std::string resume_file = "";                      /*!< Checkpoint file to resume from (empty means no resume) */
+static std::string spill_directory = "";                  /*!< Directory of spilled states (empty means no spill) */
+static bool stream_graph = false;                         /*!< Streaming output of the graph certificate */
+static bool slice = false;                                /*!< Cone-of-influence slicing of the system */
+static bool merge_clocks = false;                         /*!< Merge equivalent clocks in the system */
 
 /*!
  \brief Parse command-line arguments
@@ -102,6 +179,12 @@ int parse_command_line(int argc, char * argv[])
           algorithm = ALGO_COVREACH;
         else if (strcmp(optarg, "aLU-covreach") == 0)
           algorithm = ALGO_ALU_COVREACH;
+        else if (strcmp(optarg, "portfolio") == 0)
+          algorithm = ALGO_PORTFOLIO;
+        else if (strcmp(optarg, "bwd-reach") == 0)
+          algorithm = ALGO_BWD_REACH;
+        else if (strcmp(optarg, "bidir-reach") == 0)
+          algorithm = ALGO_BIDIR_REACH;
         else
           throw std::runtime_error("Unknown algorithm: " + std::string(optarg));
         break;
@@ -110,6 +193,8 @@ int parse_command_line(int argc, char * argv[])
           certificate = CERTIFICATE_NONE;
         else if (strcmp(optarg, "graph") == 0)
           certificate = CERTIFICATE_GRAPH;
+        else if (strcmp(optarg, "binary") == 0)
+          certificate = CERTIFICATE_BINARY;
         else if (strcmp(optarg, "concrete") == 0)
           certificate = CERTIFICATE_CONCRETE;
         else if (strcmp(optarg, "symbolic") == 0)
@@ -124,7 +209,8 @@ int parse_command_line(int argc, char * argv[])
         help = true;
         break;
       case 'l':
-        labels = optarg;
+        labels = (labels_set ? labels + ";" + optarg : std::string(optarg));
+        labels_set = true;
         break;
       case 's':
         search_order = optarg;
@@ -139,6 +225,53 @@ int parse_command_line(int argc, char * argv[])
         block_size = std::strtoull(optarg, nullptr, 10);
       else if (strcmp(long_options[long_option_index].name, "table-size") == 0)
         table_size = std::strtoull(optarg, nullptr, 10);
+      else if (strcmp(long_options[long_option_index].name, "huge-pages") == 0) {
+        if (strcmp(optarg, "thp") == 0)
+          huge_pages = tchecker::HUGE_PAGES_TRANSPARENT;
+        else if (strcmp(optarg, "explicit") == 0)
+          huge_pages = tchecker::HUGE_PAGES_EXPLICIT;
+        else
+          throw std::runtime_error("Unknown huge pages mode: " + std::string(optarg));
+      }
+      else if (strcmp(long_options[long_option_index].name, "incremental-gc") == 0)
+        incremental_gc = true;
+      else if (strcmp(long_options[long_option_index].name, "max-memory") == 0) {
+        double const gigabytes = std::strtod(optarg, nullptr);
+        if (gigabytes <= 0.0)
+          throw std::runtime_error("Memory budget must be positive");
+        max_memory = static_cast<std::size_t>(gigabytes * 1024 * 1024 * 1024);
+      }
+      else if (strcmp(long_options[long_option_index].name, "memory-stats") == 0)
+        memory_stats = true;
+      else if (strcmp(long_options[long_option_index].name, "progress") == 0) {
+        progress_interval = std::strtoull(optarg, nullptr, 10);
+        if (progress_interval == 0)
+          throw std::runtime_error("Progress interval must be positive");
+      }
+      else if (strcmp(long_options[long_option_index].name, "progress-file") == 0)
+        progress_file = optarg;
+      else if (strcmp(long_options[long_option_index].name, "swarm") == 0) {
+        swarm = std::strtoull(optarg, nullptr, 10);
+        if (swarm == 0)
+          throw std::runtime_error("Swarm needs at least one instance");
+      }
+      else if (strcmp(long_options[long_option_index].name, "checkpoint") == 0)
+        checkpoint_file = optarg;
+      else if (strcmp(long_options[long_option_index].name, "checkpoint-interval") == 0) {
+        checkpoint_interval = std::strtoull(optarg, nullptr, 10);
+        if (checkpoint_interval == 0)
+          throw std::runtime_error("Checkpoint interval must be positive");
+      }
+      else if (strcmp(long_options[long_option_index].name, "resume") == 0)
+        resume_file = optarg;
+      else if (strcmp(long_options[long_option_index].name, "spill-dir") == 0)
+        spill_directory = optarg;
+      else if (strcmp(long_options[long_option_index].name, "stream") == 0)
+        stream_graph = true;
+      else if (strcmp(long_options[long_option_index].name, "slice") == 0)
+        slice = true;
+      else if (strcmp(long_options[long_option_index].name, "merge-clocks") == 0)
+        merge_clocks = true;
       else
         throw std::runtime_error("This also should never be executed");
     }
@@ -161,8 +294,9 @@ int main(int argc, char * argv[])
       return EXIT_FAILURE;
     }
 
-    if ((certificate == CERTIFICATE_CONCRETE) && (algorithm != ALGO_COVREACH) && (algorithm != ALGO_REACH)) {
-      std::cerr << "Concrete counter-example is only available for algorithms covreach and reach" << std::endl;
+    if ((certificate == CERTIFICATE_CONCRETE) && (swarm == 0) && (algorithm != ALGO_COVREACH) && (algorithm != ALGO_REACH) &&
+        (algorithm != ALGO_PORTFOLIO)) {
+      std::cerr << "Concrete counter-example is only available for algorithms covreach, reach and portfolio" << std::endl;
       return EXIT_FAILURE;
     }
 
@@ -173,7 +307,10 @@ int main(int argc, char * argv[])
 
     std::string input_file = (optindex == argc ? "" : argv[optindex]);
 
-    tchecker::publicapi::tck_reach(output_file, input_file, labels, algorithm, search_order, certificate, block_size, table_size);
+    tchecker::publicapi::tck_reach(output_file, input_file, labels, algorithm, search_order, certificate, block_size, table_size,
+                                   swarm, checkpoint_file, checkpoint_interval, resume_file, spill_directory, stream_graph,
+                                   slice, merge_clocks, huge_pages, incremental_gc, max_memory, memory_stats,
+                                   progress_interval, progress_file);
 
 
     if (tchecker::log_error_count() > 0)
@@ -0,0 +1,48 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <stdexcept>
+
+#include "tchecker/utils/incremental_collector.hh"
+
+namespace tchecker {
+
+incremental_collector_t::incremental_collector_t(std::size_t slice_size)
+    : _slice_size(slice_size), _current(0), _collected(0), _passes(0)
+{
+  if (_slice_size == 0)
+    throw std::invalid_argument("tchecker::incremental_collector_t: slice size should be > 0");
+}
+
+void incremental_collector_t::enroll(tchecker::incremental_collectable_t & collectable)
+{
+  _collectables.push_back(&collectable);
+}
+
+std::size_t incremental_collector_t::collect(std::chrono::microseconds budget)
+{
+  if (_collectables.empty())
+    return 0;
+
+  std::chrono::steady_clock::time_point const deadline = std::chrono::steady_clock::now() + budget;
+  std::size_t collected = 0;
+
+  do {
+    auto && [n, completed] = _collectables[_current]->collect_slice(_slice_size);
+    collected += n;
+    if (completed && (++_current == _collectables.size())) {
+      _current = 0;
+      ++_passes;
+      break;
+    }
+  } while (std::chrono::steady_clock::now() < deadline);
+
+  _collected += collected;
+  return collected;
+}
+
+} // end of namespace tchecker
@@ -0,0 +1,79 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+
+#include "tchecker/utils/memory_budget.hh"
+
+namespace tchecker {
+
+/*!
+ \brief Check degradation ratio
+ \param ratio : a degradation ratio
+ \return ratio
+ \throw std::invalid_argument : if ratio is not in (0,1]
+ */
+static double checked_degradation_ratio(double ratio)
+{
+  if (ratio <= 0.0 || ratio > 1.0)
+    throw std::invalid_argument("tchecker::memory_budget_t: degradation ratio should be in (0,1]");
+  return ratio;
+}
+
+memory_budget_t::memory_budget_t(std::size_t max_memory, double degradation_ratio)
+    : _max_memory(max_memory),
+      _degradation_threshold(static_cast<std::size_t>(max_memory * checked_degradation_ratio(degradation_ratio))),
+      _memsize([]() { return 0; }), _degrade([]() {}), _peak_memory(0), _degraded(false), _exceeded(false)
+{
+  if (_max_memory == 0)
+    throw std::invalid_argument("tchecker::memory_budget_t: maximum memory should be > 0");
+}
+
+void memory_budget_t::memsize(std::function<std::size_t()> memsize) { _memsize = memsize; }
+
+void memory_budget_t::degrade(std::function<void()> degrade) { _degrade = degrade; }
+
+bool memory_budget_t::check()
+{
+  std::size_t memory = _memsize();
+  _peak_memory = std::max(_peak_memory, memory);
+
+  if (!_degraded && memory >= _degradation_threshold) {
+    _degraded = true;
+    _degrade();
+    memory = _memsize();
+  }
+
+  if (memory > _max_memory)
+    _exceeded = true;
+
+  return !_exceeded;
+}
+
+void memory_budget_t::attributes(std::map<std::string, std::string> & m) const
+{
+  std::stringstream sstream;
+
+  sstream << _max_memory;
+  m["MEMORY_BUDGET"] = sstream.str();
+
+  sstream.str("");
+  sstream << _peak_memory;
+  m["MEMORY_BUDGET_PEAK"] = sstream.str();
+
+  sstream.str("");
+  sstream << std::boolalpha << _degraded;
+  m["MEMORY_BUDGET_DEGRADED"] = sstream.str();
+
+  sstream.str("");
+  sstream << std::boolalpha << _exceeded;
+  m["MEMORY_BUDGET_EXCEEDED"] = sstream.str();
+}
+
+} // end of namespace tchecker
@@ -0,0 +1,73 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <cassert>
+#include <sstream>
+
+#include "tchecker/utils/memory_stats.hh"
+
+namespace tchecker {
+
+/*!
+ \brief Names of memory subsystems, indexed by tchecker::memory_subsystem_t
+ */
+static std::array<std::string, tchecker::MEMORY_SUBSYSTEMS_COUNT> const memory_subsystem_names = {
+    "STATES", "TRANSITIONS", "VLOCS", "VEDGES", "INTVALS", "ZONES", "NODES", "EDGES", "HASHTABLE"};
+
+memory_stats_t::memory_stats_t()
+{
+  _reserved.fill(0);
+  _live.fill(0);
+}
+
+void memory_stats_t::add(enum tchecker::memory_subsystem_t subsystem, std::size_t reserved, std::size_t live)
+{
+  assert(subsystem < tchecker::MEMORY_SUBSYSTEMS_COUNT);
+  _reserved[subsystem] += reserved;
+  _live[subsystem] += live;
+}
+
+std::size_t memory_stats_t::reserved(enum tchecker::memory_subsystem_t subsystem) const
+{
+  assert(subsystem < tchecker::MEMORY_SUBSYSTEMS_COUNT);
+  return _reserved[subsystem];
+}
+
+std::size_t memory_stats_t::live(enum tchecker::memory_subsystem_t subsystem) const
+{
+  assert(subsystem < tchecker::MEMORY_SUBSYSTEMS_COUNT);
+  return _live[subsystem];
+}
+
+void memory_stats_t::attributes(std::map<std::string, std::string> & m) const
+{
+  std::stringstream sstream;
+  std::size_t total_reserved = 0, total_live = 0;
+
+  for (std::size_t i = 0; i < tchecker::MEMORY_SUBSYSTEMS_COUNT; ++i) {
+    sstream.str("");
+    sstream << _reserved[i];
+    m["MEMORY_" + memory_subsystem_names[i]] = sstream.str();
+
+    sstream.str("");
+    sstream << _live[i];
+    m["MEMORY_" + memory_subsystem_names[i] + "_LIVE"] = sstream.str();
+
+    total_reserved += _reserved[i];
+    total_live += _live[i];
+  }
+
+  sstream.str("");
+  sstream << total_reserved;
+  m["MEMORY_TOTAL"] = sstream.str();
+
+  sstream.str("");
+  sstream << total_live;
+  m["MEMORY_TOTAL_LIVE"] = sstream.str();
+}
+
+} // end of namespace tchecker
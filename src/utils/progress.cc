@@ -0,0 +1,104 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <fstream>
+#include <iomanip>
+#include <stdexcept>
+
+#include <unistd.h>
+
+#include "tchecker/utils/progress.hh"
+
+namespace tchecker {
+
+/* progress_t */
+
+progress_t::progress_t() : _visited(0), _stored(0), _waiting(0), _covered(0) {}
+
+void progress_t::publish(unsigned long visited, unsigned long stored, unsigned long waiting, unsigned long covered)
+{
+  _visited.store(visited, std::memory_order_relaxed);
+  _stored.store(stored, std::memory_order_relaxed);
+  _waiting.store(waiting, std::memory_order_relaxed);
+  _covered.store(covered, std::memory_order_relaxed);
+}
+
+/* progress_reporter_t */
+
+progress_reporter_t::progress_reporter_t(std::ostream & os, enum tchecker::progress_format_t format,
+                                         std::chrono::milliseconds interval)
+    : _os(os), _format(format), _interval(interval), _start(std::chrono::steady_clock::now()),
+      _last_time(_start), _last_visited(0), _stopped(false)
+{
+  if (_interval.count() <= 0)
+    throw std::invalid_argument("tchecker::progress_reporter_t: interval should be > 0");
+  _thread = std::thread(&tchecker::progress_reporter_t::run, this);
+}
+
+progress_reporter_t::~progress_reporter_t() { stop(); }
+
+void progress_reporter_t::stop()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_stopped)
+      return;
+    _stopped = true;
+  }
+  _cv.notify_all();
+  _thread.join();
+  report();
+}
+
+void progress_reporter_t::run()
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+  while (!_cv.wait_for(lock, _interval, [&]() { return _stopped; }))
+    report();
+}
+
+void progress_reporter_t::report()
+{
+  std::chrono::steady_clock::time_point const now = std::chrono::steady_clock::now();
+  unsigned long const visited = _progress.visited(), stored = _progress.stored(), waiting = _progress.waiting(),
+                      covered = _progress.covered();
+
+  double const time = std::chrono::duration<double>(now - _start).count();
+  double const elapsed = std::chrono::duration<double>(now - _last_time).count();
+  double const rate = (elapsed > 0 ? (visited - _last_visited) / elapsed : 0.0);
+  double const covered_ratio = (covered + stored > 0 ? static_cast<double>(covered) / (covered + stored) : 0.0);
+  std::size_t const rss = tchecker::resident_set_size();
+
+  _last_time = now;
+  _last_visited = visited;
+
+  std::ios_base::fmtflags const flags = _os.flags();
+  _os << std::fixed;
+  if (_format == tchecker::PROGRESS_JSON_LINES)
+    _os << "{\"time\":" << std::setprecision(3) << time << ",\"visited\":" << visited << ",\"stored\":" << stored
+        << ",\"waiting\":" << waiting << ",\"states_per_second\":" << std::setprecision(1) << rate
+        << ",\"covered_ratio\":" << std::setprecision(4) << covered_ratio << ",\"rss\":" << rss << "}";
+  else
+    _os << "progress: " << std::setprecision(1) << time << "s, " << visited << " visited (" << std::setprecision(0) << rate
+        << "/s), " << stored << " stored, " << waiting << " waiting, " << std::setprecision(1) << 100 * covered_ratio
+        << "% covered, " << (rss >> 20) << " MB resident";
+  _os << std::endl;
+  _os.flags(flags);
+}
+
+/* resident_set_size */
+
+std::size_t resident_set_size()
+{
+  std::ifstream statm("/proc/self/statm");
+  std::size_t size = 0, resident = 0;
+  if (!(statm >> size >> resident))
+    return 0;
+  return resident * static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+}
+
+} // end of namespace tchecker
@@ -0,0 +1,222 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "tchecker/utils/segments.hh"
+
+namespace tchecker {
+
+/*!
+ \brief Round a size
+ \param size : a size
+ \param unit : a unit
+ \return the smallest multiple of unit that is greater than or equal to size
+ */
+static std::size_t round_up(std::size_t size, std::size_t unit) { return ((size + unit - 1) / unit) * unit; }
+
+/* segments_t */
+
+segments_t::segments_t(std::size_t segment_size, std::size_t page_size)
+    : _page_size(page_size == 0 ? ::sysconf(_SC_PAGESIZE) : page_size),
+      _segment_size(round_up(std::max<std::size_t>(segment_size, 1), _page_size)), _head(nullptr), _end(nullptr)
+{
+}
+
+segments_t::~segments_t() { clear(); }
+
+void * segments_t::allocate(std::size_t size)
+{
+  size = round_up(size, alignof(std::max_align_t));
+  if (static_cast<std::size_t>(_end - _head) < size)
+    new_segment(size);
+  void * p = _head;
+  _head += size;
+  return p;
+}
+
+void segments_t::clear()
+{
+  for (auto && [address, size] : _segments)
+    ::munmap(address, size);
+  _segments.clear();
+  _head = nullptr;
+  _end = nullptr;
+}
+
+std::size_t segments_t::memsize() const
+{
+  std::size_t size = 0;
+  for (auto && [address, segment_size] : _segments)
+    size += segment_size;
+  return size;
+}
+
+void segments_t::new_segment(std::size_t size)
+{
+  size = std::max(round_up(size, _page_size), _segment_size);
+  void * address = map_segment(size);
+  _segments.emplace_back(address, size);
+  _head = static_cast<char *>(address);
+  _end = _head + size;
+}
+
+/* mmap_segments_t */
+
+mmap_segments_t::mmap_segments_t(std::string const & directory, std::size_t segment_size)
+    : tchecker::segments_t(segment_size), _directory(directory)
+{
+  if (!std::filesystem::is_directory(_directory))
+    throw std::invalid_argument("Not a directory: " + _directory);
+}
+
+void * mmap_segments_t::map_segment(std::size_t size)
+{
+  std::string filename = (std::filesystem::path(_directory) / "tck_segment_XXXXXX").string();
+  int fd = ::mkstemp(filename.data());
+  if (fd == -1)
+    throw std::runtime_error("Cannot create segment file in " + _directory + ": " + std::strerror(errno));
+  ::unlink(filename.c_str()); // removed as soon as it is unmapped
+
+  if (::ftruncate(fd, size) != 0) {
+    int err = errno;
+    ::close(fd);
+    throw std::runtime_error("Cannot resize segment file in " + _directory + ": " + std::strerror(err));
+  }
+
+  void * address = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  int err = errno;
+  ::close(fd); // the mapping keeps the file open
+  if (address == MAP_FAILED)
+    throw std::runtime_error("Cannot map segment file in " + _directory + ": " + std::strerror(err));
+  return address;
+}
+
+/* anonymous_segments_t */
+
+anonymous_segments_t::anonymous_segments_t(std::size_t segment_size, int numa_node, enum tchecker::huge_pages_t huge_pages)
+    : tchecker::segments_t(segment_size, (huge_pages == tchecker::HUGE_PAGES_NONE ? 0 : tchecker::HUGE_PAGE_SIZE)),
+      _numa_node(numa_node), _huge_pages(huge_pages)
+{
+}
+
+/*!
+ \brief Bind memory to a NUMA node
+ \param address : address of a memory mapping
+ \param size : size of the memory mapping
+ \param node : NUMA node
+ \post the pages in address..address+size are preferably allocated on node, if
+ supported by the system. Nothing happens otherwise
+ \note libnuma is not required: the mbind system call is issued directly
+ */
+static void bind_to_numa_node(void * address, std::size_t size, int node)
+{
+#if defined(__linux__) && defined(SYS_mbind)
+  unsigned long constexpr MPOL_PREFERRED = 1;
+  unsigned long constexpr MAXNODE = 8 * sizeof(unsigned long);
+  if (node < 0 || static_cast<unsigned long>(node) >= MAXNODE)
+    return;
+  unsigned long nodemask = 1UL << node;
+  ::syscall(SYS_mbind, address, size, MPOL_PREFERRED, &nodemask, MAXNODE, 0); // failure falls back to first touch
+#else
+  (void)address;
+  (void)size;
+  (void)node;
+#endif
+}
+
+/*!
+ \brief Map memory aligned on huge pages
+ \param size : size of memory (bytes), a multiple of HUGE_PAGE_SIZE
+ \return address of an anonymous mapping of size bytes aligned on
+ HUGE_PAGE_SIZE, MAP_FAILED if memory cannot be mapped
+ \note the mapping is over-allocated by one huge page, then trimmed
+ */
+static void * map_aligned(std::size_t size)
+{
+  std::size_t const mapped_size = size + tchecker::HUGE_PAGE_SIZE;
+  void * mapped = ::mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (mapped == MAP_FAILED)
+    return MAP_FAILED;
+  char * begin = static_cast<char *>(mapped);
+  char * address = reinterpret_cast<char *>(round_up(reinterpret_cast<std::uintptr_t>(begin), tchecker::HUGE_PAGE_SIZE));
+  char * end = begin + mapped_size;
+  if (address != begin)
+    ::munmap(begin, address - begin);
+  if (address + size != end)
+    ::munmap(address + size, end - (address + size));
+  return address;
+}
+
+void * anonymous_segments_t::map_segment(std::size_t size)
+{
+  void * address = tchecker::map_anonymous(size, _huge_pages);
+  if (_numa_node >= 0)
+    bind_to_numa_node(address, size, _numa_node);
+  return address;
+}
+
+/* Anonymous memory */
+
+void * map_anonymous(std::size_t size, enum tchecker::huge_pages_t huge_pages)
+{
+  void * address = MAP_FAILED;
+  switch (huge_pages) {
+  case tchecker::HUGE_PAGES_EXPLICIT:
+#if defined(MAP_HUGETLB)
+    address = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (address == MAP_FAILED)
+      throw std::runtime_error(std::string("Cannot map huge pages (see /proc/sys/vm/nr_hugepages): ") +
+                               std::strerror(errno));
+#else
+    throw std::runtime_error("Explicit huge pages are not supported on this system");
+#endif
+    break;
+  case tchecker::HUGE_PAGES_TRANSPARENT:
+    address = map_aligned(size);
+#if defined(MADV_HUGEPAGE)
+    if (address != MAP_FAILED)
+      ::madvise(address, size, MADV_HUGEPAGE); // failure falls back to regular pages
+#endif
+    break;
+  default:
+    address = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    break;
+  }
+  if (address == MAP_FAILED)
+    throw std::runtime_error(std::string("Cannot map anonymous memory: ") + std::strerror(errno));
+  return address;
+}
+
+void unmap_anonymous(void * address, std::size_t size) { ::munmap(address, size); }
+
+/* NUMA */
+
+int current_numa_node()
+{
+#if defined(__linux__) && defined(SYS_getcpu)
+  unsigned int cpu = 0, node = 0;
+  if (::syscall(SYS_getcpu, &cpu, &node, nullptr) != 0)
+    return -1;
+  return static_cast<int>(node);
+#else
+  return -1;
+#endif
+}
+
+} // end of namespace tchecker
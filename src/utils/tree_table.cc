@@ -0,0 +1,137 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <mutex>
+#include <stdexcept>
+
+#include <boost/container_hash/hash.hpp>
+
+#include "tchecker/utils/tree_table.hh"
+
+namespace tchecker {
+
+/*!
+ \brief Hash a pair
+ \param left : left component
+ \param right : right component
+ \return hash value of (left,right)
+ */
+static inline std::size_t hash_pair(tchecker::tree_table_t::index_t left, tchecker::tree_table_t::index_t right)
+{
+  std::size_t h = boost::hash_value(left);
+  boost::hash_combine(h, right);
+  return h;
+}
+
+tree_table_t::tree_table_t(std::size_t width, std::size_t table_size) : _width(width)
+{
+  std::size_t buckets = 16;
+  while (buckets < 2 * table_size)
+    buckets *= 2;
+  _buckets.resize(buckets, 0);
+  _pairs.reserve(table_size);
+}
+
+tchecker::tree_table_t::index_t tree_table_t::insert(tchecker::packed_word_t const * v)
+{
+  std::lock_guard<tchecker::spinlock_t> lock(_lock);
+  return insert_unlocked(v, _width);
+}
+
+void tree_table_t::get(index_t id, tchecker::packed_word_t * v) const
+{
+  std::lock_guard<tchecker::spinlock_t> lock(_lock);
+  get_unlocked(id, v, _width);
+}
+
+tchecker::tree_table_t::index_t tree_table_t::find_or_add(index_t left, index_t right)
+{
+  std::lock_guard<tchecker::spinlock_t> lock(_lock);
+  return find_or_add_unlocked(left, right);
+}
+
+std::pair<tchecker::tree_table_t::index_t, tchecker::tree_table_t::index_t> tree_table_t::pair(index_t id) const
+{
+  std::lock_guard<tchecker::spinlock_t> lock(_lock);
+  if (id >= _pairs.size())
+    throw std::out_of_range("tchecker::tree_table_t::pair: unknown identifier");
+  return _pairs[id];
+}
+
+std::size_t tree_table_t::pairs_count() const
+{
+  std::lock_guard<tchecker::spinlock_t> lock(_lock);
+  return _pairs.size();
+}
+
+std::size_t tree_table_t::memsize() const
+{
+  std::lock_guard<tchecker::spinlock_t> lock(_lock);
+  return sizeof(*this) + _pairs.capacity() * sizeof(std::pair<index_t, index_t>) + _buckets.capacity() * sizeof(index_t);
+}
+
+tchecker::tree_table_t::index_t tree_table_t::find_or_add_unlocked(index_t left, index_t right)
+{
+  std::size_t const mask = _buckets.size() - 1;
+  std::size_t b = hash_pair(left, right) & mask;
+  while (_buckets[b] != 0) {
+    std::pair<index_t, index_t> const & p = _pairs[_buckets[b] - 1];
+    if (p.first == left && p.second == right)
+      return _buckets[b] - 1;
+    b = (b + 1) & mask;
+  }
+
+  index_t const id = _pairs.size();
+  _pairs.emplace_back(left, right);
+  _buckets[b] = id + 1;
+
+  if (2 * _pairs.size() > _buckets.size())
+    grow();
+
+  return id;
+}
+
+tchecker::tree_table_t::index_t tree_table_t::insert_unlocked(tchecker::packed_word_t const * v, std::size_t width)
+{
+  if (width == 0)
+    return 0;
+  if (width == 1)
+    return v[0];
+  std::size_t const half = width / 2;
+  index_t const left = insert_unlocked(v, half);
+  index_t const right = insert_unlocked(v + half, width - half);
+  return find_or_add_unlocked(left, right);
+}
+
+void tree_table_t::get_unlocked(index_t id, tchecker::packed_word_t * v, std::size_t width) const
+{
+  if (width == 0)
+    return;
+  if (width == 1) {
+    v[0] = id;
+    return;
+  }
+  if (id >= _pairs.size())
+    throw std::out_of_range("tchecker::tree_table_t::get: unknown identifier");
+  std::size_t const half = width / 2;
+  get_unlocked(_pairs[id].first, v, half);
+  get_unlocked(_pairs[id].second, v + half, width - half);
+}
+
+void tree_table_t::grow()
+{
+  _buckets.assign(2 * _buckets.size(), 0);
+  std::size_t const mask = _buckets.size() - 1;
+  for (index_t id = 0; id < _pairs.size(); ++id) {
+    std::size_t b = hash_pair(_pairs[id].first, _pairs[id].second) & mask;
+    while (_buckets[b] != 0)
+      b = (b + 1) & mask;
+    _buckets[b] = id + 1;
+  }
+}
+
+} // end of namespace tchecker
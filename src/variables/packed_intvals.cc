@@ -0,0 +1,83 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <limits>
+#include <stdexcept>
+
+#include "tchecker/variables/packed_intvals.hh"
+
+namespace tchecker {
+
+/* intval_packing_t */
+
+intval_packing_t::intval_packing_t(tchecker::flat_integer_variables_t const & intvars) : _words_count(0)
+{
+  unsigned const word_bits = std::numeric_limits<tchecker::packed_word_t>::digits;
+  unsigned used_bits = word_bits; // no word yet
+
+  _fields.reserve(intvars.size());
+  for (tchecker::intvar_id_t id = 0; id < intvars.size(); ++id) {
+    tchecker::intvar_info_t const & info = intvars.info(id);
+    tchecker::packed_word_t const span = static_cast<tchecker::packed_word_t>(
+        static_cast<std::int64_t>(info.max()) - static_cast<std::int64_t>(info.min()));
+
+    unsigned bits = 0;
+    while (bits < word_bits && (span >> bits) != 0)
+      ++bits;
+
+    if (bits > word_bits - used_bits) {
+      ++_words_count;
+      used_bits = 0;
+    }
+
+    field_t f;
+    f.min = info.min();
+    f.max = info.max();
+    f.word = static_cast<std::uint32_t>(bits == 0 ? 0 : _words_count - 1);
+    f.shift = (bits == 0 ? 0 : used_bits);
+    f.bits = bits;
+    f.mask = (bits == word_bits ? ~tchecker::packed_word_t{0} : (tchecker::packed_word_t{1} << bits) - 1);
+    _fields.push_back(f);
+
+    used_bits += bits;
+  }
+}
+
+void intval_packing_t::pack(tchecker::intval_t const & intval, tchecker::packed_word_t * words) const
+{
+  if (intval.size() != _fields.size())
+    throw std::invalid_argument("tchecker::intval_packing_t::pack: valuation has wrong size");
+
+  for (std::size_t w = 0; w < _words_count; ++w)
+    words[w] = 0;
+
+  for (tchecker::intvar_id_t id = 0; id < _fields.size(); ++id) {
+    field_t const & f = _fields[id];
+    tchecker::integer_t const v = intval[id];
+    if (v < f.min || v > f.max)
+      throw std::out_of_range("tchecker::intval_packing_t::pack: value out of domain");
+    if (f.bits == 0)
+      continue;
+    tchecker::packed_word_t const offset =
+        static_cast<tchecker::packed_word_t>(static_cast<std::int64_t>(v) - static_cast<std::int64_t>(f.min));
+    words[f.word] |= offset << f.shift;
+  }
+}
+
+void intval_packing_t::unpack(tchecker::packed_word_t const * words, tchecker::intval_t & intval) const
+{
+  if (intval.size() != _fields.size())
+    throw std::invalid_argument("tchecker::intval_packing_t::unpack: valuation has wrong size");
+
+  for (tchecker::intvar_id_t id = 0; id < _fields.size(); ++id) {
+    field_t const & f = _fields[id];
+    tchecker::packed_word_t const offset = (f.bits == 0 ? 0 : (words[f.word] >> f.shift) & f.mask);
+    intval[id] = static_cast<tchecker::integer_t>(static_cast<std::int64_t>(f.min) + static_cast<std::int64_t>(offset));
+  }
+}
+
+} // end of namespace tchecker
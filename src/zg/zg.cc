@@ -5,6 +5,7 @@
  *
  */
 
+#include <algorithm>
 #include <queue>
 
 #include "tchecker/dbm/db.hh"
@@ -252,9 +253,14 @@ void zg_t::next(tchecker::zg::const_state_sptr_t const & s, tchecker::zg::outgoi
 
 void zg_t::next(tchecker::zg::const_state_sptr_t const & s, std::vector<sst_t> & v, tchecker::state_status_t mask)
 {
+  std::size_t const first = v.size();
   tchecker::ts::next(*this, s, v, mask);
+  if (_edge_order_gen != nullptr)
+    std::shuffle(v.begin() + first, v.end(), *_edge_order_gen);
 }
 
+void zg_t::randomize_edge_order(unsigned int seed) { _edge_order_gen = std::make_unique<std::minstd_rand>(seed); }
+
 // Backward
 
 final_range_t zg_t::final_edges(boost::dynamic_bitset<> const & labels) { return tchecker::zg::final_edges(*_system, labels); }
@@ -0,0 +1,143 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <cstddef>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "tchecker/algorithms/reach/zg-reach.hh"
+#include "tchecker/graph/binary.hh"
+#include "tchecker/utils/tmp_file.hh"
+
+#include "testutils/utils.hh"
+
+TEST_CASE("Round-trip of reachability graphs through the binary format", "[binary_graph]")
+{
+  std::string model = "system:binary_graph \n\
+  event:a \n\
+  event:b \n\
+  int:1:0:2:0:i \n\
+  clock:1:x \n\
+  clock:1:y \n\
+  \n\
+  process:P \n\
+  location:P:l0{initial: : invariant: x<=2} \n\
+  location:P:l1{labels: done} \n\
+  edge:P:l0:l0:a{provided: i<2 && x>=1 : do: i=i+1; x=0} \n\
+  edge:P:l0:l1:b{provided: i==2} \n\
+  \n\
+  process:Q \n\
+  location:Q:m0{initial: : invariant: y<=3} \n\
+  location:Q:m1 \n\
+  edge:Q:m0:m1:a{provided: y>=2 : do: y=0} \n\
+  edge:Q:m1:m0:b \n\
+  ";
+
+  std::shared_ptr<tchecker::parsing::system_declaration_t const> sysdecl{tchecker::test::parse(model)};
+  REQUIRE(sysdecl != nullptr);
+
+  auto && [stats, state_space] = tchecker::algorithms::zg_reach::run(*sysdecl, "done", "bfs");
+  tchecker::algorithms::zg_reach::graph_t const & graph = state_space->graph();
+  tchecker::ta::system_t const & system = state_space->zg().system();
+
+  std::string const filename = tchecker::create_temp_filename();
+  {
+    std::ofstream os(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+    tchecker::algorithms::zg_reach::binary_output(os, graph, sysdecl->name());
+  }
+
+  // nodes of the graph as (initial, final, tuple of locations, valuation of bounded integer variables)
+  using node_content_t = std::tuple<bool, bool, std::vector<tchecker::loc_id_t>, std::vector<tchecker::integer_t>>;
+  std::multiset<node_content_t> graph_nodes;
+  std::size_t graph_edges = 0;
+  for (tchecker::algorithms::zg_reach::graph_t::node_sptr_t const & n : graph.nodes()) {
+    tchecker::vloc_t const & vloc = n->state().vloc();
+    tchecker::intval_t const & intval = n->state().intval();
+    graph_nodes.insert(std::make_tuple(n->initial(), n->final(),
+                                       std::vector<tchecker::loc_id_t>{vloc.begin(), vloc.end()},
+                                       std::vector<tchecker::integer_t>{intval.begin(), intval.end()}));
+    for (auto && e : graph.outgoing_edges(n)) {
+      (void)e;
+      ++graph_edges;
+    }
+  }
+
+  SECTION("The mapped graph has the nodes and edges of the reachability graph")
+  {
+    tchecker::graph::binary::mapped_graph_t mapped{filename};
+    tchecker::graph::binary::header_t const & header = mapped.header();
+
+    REQUIRE(mapped.name() == sysdecl->name());
+    REQUIRE(mapped.nodes_count() == graph.nodes_count());
+    REQUIRE(mapped.edges_count() == graph_edges);
+    REQUIRE(header.processes_count == system.processes_count());
+    REQUIRE(header.intvars_count == system.intvars_count(tchecker::VK_FLATTENED));
+    REQUIRE(header.dim == system.clocks_count(tchecker::VK_FLATTENED) + 1);
+
+    std::multiset<node_content_t> mapped_nodes;
+    std::size_t mapped_edges = 0;
+    for (std::uint64_t id = 0; id < mapped.nodes_count(); ++id) {
+      tchecker::graph::binary::node_t node = mapped.node(id);
+      mapped_nodes.insert(std::make_tuple(
+          node.initial(), node.final(),
+          std::vector<tchecker::loc_id_t>{node.vloc(), node.vloc() + header.processes_count},
+          std::vector<tchecker::integer_t>{node.intval(), node.intval() + header.intvars_count}));
+      // zones are stored as tight DBMs: the diagonal is <=0
+      for (std::uint64_t i = 0; i < header.dim; ++i)
+        REQUIRE(node.dbm()[i * header.dim + i] == tchecker::dbm::LE_ZERO);
+      for (tchecker::graph::binary::edge_record_t const & e : mapped.outgoing_edges(id)) {
+        REQUIRE(e.src == id);
+        REQUIRE(e.tgt < mapped.nodes_count());
+        for (tchecker::graph::binary::attribute_record_t const & attr : mapped.attributes(e))
+          if (mapped.string(attr.key) == "vedge")
+            REQUIRE(mapped.string(attr.value).front() == '<');
+        ++mapped_edges;
+      }
+    }
+    REQUIRE(mapped_nodes == graph_nodes);
+    REQUIRE(mapped_edges == graph_edges);
+
+    for (tchecker::loc_id_t id = 0; id < system.locations_count(); ++id)
+      REQUIRE(mapped.location_name(id) == system.location(id)->name());
+    auto const & clocks_index = system.clock_variables().flattened().index();
+    for (tchecker::clock_id_t id = 0; id < header.dim - 1; ++id)
+      REQUIRE(mapped.clock_name(id) == clocks_index.value(id));
+  }
+
+  SECTION("Truncated files are rejected")
+  {
+    std::uintmax_t const size = std::filesystem::file_size(filename);
+    for (std::uintmax_t truncated_size : std::vector<std::uintmax_t>{size - 1, size / 2, 16, 0}) {
+      std::filesystem::resize_file(filename, truncated_size);
+      REQUIRE_THROWS_AS(tchecker::graph::binary::mapped_graph_t{filename}, std::runtime_error);
+    }
+  }
+
+  SECTION("Files with an edge to an unknown node are rejected")
+  {
+    std::size_t edges_offset = 0;
+    {
+      tchecker::graph::binary::mapped_graph_t mapped{filename};
+      REQUIRE(mapped.edges_count() > 0);
+      edges_offset = mapped.header().edges_offset;
+    }
+    std::fstream fs(filename, std::ios::in | std::ios::out | std::ios::binary);
+    fs.seekp(edges_offset + offsetof(tchecker::graph::binary::edge_record_t, tgt));
+    std::uint64_t const tgt = graph.nodes_count();
+    fs.write(reinterpret_cast<char const *>(&tgt), sizeof(tgt));
+    fs.close();
+    REQUIRE_THROWS_AS(tchecker::graph::binary::mapped_graph_t{filename}, std::runtime_error);
+  }
+
+  std::remove(filename.c_str());
+}
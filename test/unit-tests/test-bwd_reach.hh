@@ -0,0 +1,124 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <string>
+#include <vector>
+
+#include "tchecker/algorithms/bwd_reach/target.hh"
+#include "tchecker/algorithms/bwd_reach/zg-bwd-reach.hh"
+#include "tchecker/algorithms/reach/zg-reach.hh"
+
+#include "testutils/utils.hh"
+
+static std::string bwd_reach_model(std::string const & bound)
+{
+  return "system:bwd_reach \n\
+  event:a \n\
+  event:b \n\
+  event:c \n\
+  event:d \n\
+  int:1:0:3:0:i \n\
+  clock:1:x \n\
+  clock:1:y \n\
+  \n\
+  process:P \n\
+  location:P:p0{initial:} \n\
+  location:P:p1 \n\
+  location:P:p2{labels: goal} \n\
+  edge:P:p0:p1:a{provided: x>=2 : do: x=0} \n\
+  edge:P:p1:p2:b{provided: i==" +
+         bound + " && x<=1} \n\
+  \n\
+  process:Q \n\
+  location:Q:q0{initial:} \n\
+  location:Q:q1 \n\
+  edge:Q:q0:q1:d{provided: i<3 : do: i=i+1} \n\
+  edge:Q:q1:q0:d{do: y=0} \n\
+  edge:Q:q0:q0:c \n\
+  edge:Q:q1:q1:c \n\
+  \n\
+  process:R \n\
+  location:R:r0{initial: : invariant: y<=5} \n\
+  location:R:r1 \n\
+  edge:R:r0:r1:a{provided: y>=1} \n\
+  \n\
+  sync:P@b:Q@c \n\
+  ";
+}
+
+TEST_CASE("Target of backward reachability", "[bwd_reach]")
+{
+  std::shared_ptr<tchecker::parsing::system_declaration_t const> sysdecl{tchecker::test::parse(bwd_reach_model("2"))};
+  REQUIRE(sysdecl != nullptr);
+
+  tchecker::ta::system_t system{*sysdecl};
+  tchecker::algorithms::bwd_reach::target_t target{*sysdecl, "goal"};
+
+  SECTION("Only processes that play no role in the target are wildcard processes")
+  {
+    // P has the label, R has an invariant
+    REQUIRE(target.wildcard_processes().count() == 1);
+    REQUIRE(target.wildcard_processes()[system.process_id("Q")]);
+  }
+
+  SECTION("Locations and edges keep their identifiers in the target system")
+  {
+    REQUIRE(target.system()->locations_count() == system.locations_count() + 1);
+    REQUIRE(target.system()->edges_count() == system.edges_count() + 4);
+    for (tchecker::loc_id_t id = 0; id < system.locations_count(); ++id)
+      REQUIRE(target.system()->location(id)->name() == system.location(id)->name());
+
+    tchecker::system::loc_const_shared_ptr_t wildcard =
+        target.system()->location(system.process_id("Q"), tchecker::algorithms::bwd_reach::WILDCARD_LOCATION_NAME);
+    REQUIRE(target.wildcard_locations().count() == 1);
+    REQUIRE(target.wildcard_locations()[wildcard->id()]);
+  }
+
+  SECTION("Final edges do not range over the locations of wildcard processes")
+  {
+    std::size_t target_count = 0, all_count = 0;
+    for (auto && final_edge : target.final_edges()) {
+      (void)final_edge;
+      ++target_count;
+    }
+    for (auto && final_edge : tchecker::ta::final_edges(system, system.as_syncprod_system().labels("goal"))) {
+      (void)final_edge;
+      ++all_count;
+    }
+    // P in p2, R in r0 or r1, 4 valuations of i, and Q in its wildcard location (target) or in q0 or q1 (all)
+    REQUIRE(target_count == 8);
+    REQUIRE(all_count == 16);
+  }
+
+  SECTION("Empty labels have no target")
+  {
+    tchecker::algorithms::bwd_reach::target_t empty_target{*sysdecl, ""};
+    REQUIRE(empty_target.final_edges().begin() == tchecker::past_the_end_iterator);
+  }
+}
+
+TEST_CASE("Backward and bidirectional reachability agree with reachability", "[bwd_reach]")
+{
+  for (std::string const & bound : std::vector<std::string>{"2", "4"}) {
+    std::shared_ptr<tchecker::parsing::system_declaration_t const> sysdecl{tchecker::test::parse(bwd_reach_model(bound))};
+    REQUIRE(sysdecl != nullptr);
+
+    for (std::string const & search_order : std::vector<std::string>{"bfs", "dfs"}) {
+      auto && [stats, properties, state_space] =
+          tchecker::algorithms::zg_reach::run(*sysdecl, std::vector<std::string>{"goal"}, search_order);
+      bool const reachable = properties.reachable(0);
+      REQUIRE(reachable == (bound == "2"));
+
+      auto && [bwd_stats, bwd_state_space] = tchecker::algorithms::zg_bwd_reach::run(*sysdecl, "goal", search_order);
+      REQUIRE(bwd_stats.reachable() == reachable);
+
+      auto && [bidir_stats, fwd_state_space, bidir_state_space] =
+          tchecker::algorithms::zg_bwd_reach::run_bidirectional(*sysdecl, "goal", search_order);
+      REQUIRE(bidir_stats.reachable() == reachable);
+    }
+  }
+}
@@ -0,0 +1,111 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <chrono>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "tchecker/algorithms/reach/zg-reach.hh"
+#include "tchecker/utils/tmp_file.hh"
+
+#include "testutils/utils.hh"
+
+static std::string checkpoint_model(std::string const & bound)
+{
+  return "system:checkpoint \n\
+  event:a \n\
+  event:b \n\
+  int:1:0:" +
+         bound + ":0:i \n\
+  clock:1:x \n\
+  clock:1:y \n\
+  \n\
+  process:P \n\
+  location:P:l0{initial: : invariant: x<=2} \n\
+  location:P:l1{labels: done} \n\
+  location:P:l2{labels: never} \n\
+  edge:P:l0:l0:a{provided: i<" +
+         bound + " && x>=1 : do: i=i+1; x=0} \n\
+  edge:P:l0:l1:b{provided: i==" +
+         bound + " && y<=10} \n\
+  \n\
+  process:Q \n\
+  location:Q:m0{initial: : invariant: y<=5} \n\
+  location:Q:m1 \n\
+  edge:Q:m0:m1:a{provided: y>=2 : do: y=0} \n\
+  edge:Q:m1:m0:b \n\
+  ";
+}
+
+TEST_CASE("Checkpoints of reachability", "[checkpoint]")
+{
+  std::shared_ptr<tchecker::parsing::system_declaration_t const> sysdecl{tchecker::test::parse(checkpoint_model("4"))};
+  REQUIRE(sysdecl != nullptr);
+
+  // unreachable label: the exploration is complete
+  std::vector<std::string> const labels{"never"};
+  std::string const checkpoint_file = tchecker::create_temp_filename();
+
+  auto && [stats, properties, state_space] = tchecker::algorithms::zg_reach::run(*sysdecl, labels, "bfs");
+  std::size_t const nodes_count = state_space->graph().nodes_count();
+  REQUIRE(stats.visited_states() > 1);
+
+  // save a checkpoint at every iteration, the last one has a single waiting node
+  auto && [saved_stats, saved_properties, saved_state_space] =
+      tchecker::algorithms::zg_reach::run(*sysdecl, labels, "bfs", checkpoint_file, std::chrono::seconds{0}, "");
+  REQUIRE(std::filesystem::exists(checkpoint_file));
+  REQUIRE(saved_stats.visited_states() == stats.visited_states());
+  REQUIRE(saved_state_space->graph().nodes_count() == nodes_count);
+
+  SECTION("A resumed run completes the exploration")
+  {
+    auto && [resumed_stats, resumed_properties, resumed_state_space] =
+        tchecker::algorithms::zg_reach::run(*sysdecl, labels, "bfs", "", std::chrono::seconds{0}, checkpoint_file);
+    REQUIRE(resumed_stats.visited_states() == stats.visited_states());
+    REQUIRE(resumed_stats.visited_transitions() == stats.visited_transitions());
+    REQUIRE(resumed_state_space->graph().nodes_count() == nodes_count);
+    REQUIRE_FALSE(resumed_properties.reachable(0));
+  }
+
+  SECTION("Checkpoints are rejected for another search order")
+  {
+    REQUIRE_THROWS_AS(
+        tchecker::algorithms::zg_reach::run(*sysdecl, labels, "dfs", "", std::chrono::seconds{0}, checkpoint_file),
+        std::runtime_error);
+  }
+
+  SECTION("Checkpoints are rejected for other properties")
+  {
+    std::vector<std::string> const other_labels{"done"};
+    REQUIRE_THROWS_AS(
+        tchecker::algorithms::zg_reach::run(*sysdecl, other_labels, "bfs", "", std::chrono::seconds{0}, checkpoint_file),
+        std::runtime_error);
+  }
+
+  SECTION("Checkpoints are rejected for another system with the same name")
+  {
+    // same processes, variables and clocks, distinct guards
+    std::shared_ptr<tchecker::parsing::system_declaration_t const> other_sysdecl{
+        tchecker::test::parse(checkpoint_model("3"))};
+    REQUIRE(other_sysdecl != nullptr);
+    REQUIRE(other_sysdecl->name() == sysdecl->name());
+    REQUIRE_THROWS_AS(
+        tchecker::algorithms::zg_reach::run(*other_sysdecl, labels, "bfs", "", std::chrono::seconds{0}, checkpoint_file),
+        std::runtime_error);
+  }
+
+  SECTION("Files that are not checkpoints are rejected")
+  {
+    REQUIRE_THROWS_AS(tchecker::algorithms::zg_reach::run(*sysdecl, labels, "bfs", "", std::chrono::seconds{0},
+                                                          checkpoint_file + ".missing"),
+                      std::runtime_error);
+  }
+
+  std::filesystem::remove(checkpoint_file);
+}
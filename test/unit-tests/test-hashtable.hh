@@ -5,8 +5,10 @@
  *
  */
 
+#include <cstdint>
 #include <functional>
 #include <iterator>
+#include <stdexcept>
 
 #include "tchecker/utils/hashtable.hh"
 #include "tchecker/utils/shared_objects.hh"
@@ -702,3 +704,63 @@ TEST_CASE("Non-empty hashtable", "[hashtable]")
   shared_hto_t::destruct_and_deallocate(p1b);
   shared_hto_t::destruct_and_deallocate(p2);
 }
+
+TEST_CASE("Hash tables backed by huge pages", "[hashtable]")
+{
+  SECTION("Large arrays are aligned on huge pages, small arrays come from the heap")
+  {
+    tchecker::huge_pages_allocator_t<std::size_t> allocator{tchecker::HUGE_PAGES_TRANSPARENT};
+    std::size_t const large = tchecker::HUGE_PAGE_SIZE / sizeof(std::size_t) + 1;
+    std::size_t * p = allocator.allocate(large);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(p) % tchecker::HUGE_PAGE_SIZE == 0);
+    p[0] = 1;
+    p[large - 1] = 2;
+    allocator.deallocate(p, large);
+
+    std::size_t * q = allocator.allocate(16);
+    REQUIRE(q != nullptr);
+    allocator.deallocate(q, 16);
+  }
+
+  SECTION("Collision table backed by huge pages")
+  {
+    tchecker::collision_table_t<cto_sptr_t, cto_sptr_hash_t> t(1 << 18, cto_sptr_hash_t{});
+    t.huge_pages(tchecker::HUGE_PAGES_TRANSPARENT);
+
+    cto_sptr_t o1{shared_cto_t::allocate_and_construct(1, 1)};
+    cto_sptr_t o2{shared_cto_t::allocate_and_construct((1 << 18) + 1, 2)};
+    t.add(o1);
+    t.add(o2);
+    REQUIRE(t.size() == 2);
+    REQUIRE(std::distance(t.collision_range(o1).begin(), t.collision_range(o1).end()) == 2);
+    REQUIRE_THROWS_AS(t.huge_pages(tchecker::HUGE_PAGES_NONE), std::logic_error);
+
+    t.clear();
+    shared_cto_t *p1 = o1.ptr(), *p2 = o2.ptr();
+    o1 = nullptr;
+    o2 = nullptr;
+    shared_cto_t::destruct_and_deallocate(p1);
+    shared_cto_t::destruct_and_deallocate(p2);
+  }
+
+  SECTION("Hashtable backed by huge pages")
+  {
+    tchecker::hashtable_t<hto_sptr_t, hto_sptr_hash_t, hto_sptr_equal_t> t(1 << 19, hto_sptr_hash_t{}, hto_sptr_equal_t{});
+    t.huge_pages(tchecker::HUGE_PAGES_TRANSPARENT);
+    REQUIRE(t.bucket_count() >= (1 << 19));
+
+    hto_sptr_t o1{shared_hto_t::allocate_and_construct(1)};
+    hto_sptr_t o1b{shared_hto_t::allocate_and_construct(1)};
+    REQUIRE(t.add(o1));
+    REQUIRE_FALSE(t.add(o1b));
+    REQUIRE(std::get<0>(t.find(o1b)));
+    REQUIRE_THROWS_AS(t.huge_pages(tchecker::HUGE_PAGES_NONE), std::logic_error);
+
+    t.clear();
+    shared_hto_t *p1 = o1.ptr(), *p1b = o1b.ptr();
+    o1 = nullptr;
+    o1b = nullptr;
+    shared_hto_t::destruct_and_deallocate(p1);
+    shared_hto_t::destruct_and_deallocate(p1b);
+  }
+}
@@ -0,0 +1,118 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "tchecker/variables/intvars.hh"
+#include "tchecker/variables/packed_intvals.hh"
+
+TEST_CASE("Layout of packed valuations", "[packed_intvals]")
+{
+  tchecker::integer_variables_t intvars;
+  intvars.declare("b", 1, 0, 1, 0);
+  intvars.declare("k", 1, -2, 2, 0);
+  intvars.declare("s", 1, 3, 3, 3);
+  intvars.declare("a", 3, 0, 255, 0);
+
+  tchecker::intval_packing_t packing{intvars.flattened()};
+
+  REQUIRE(packing.intvars_count() == 6);
+  REQUIRE(packing.bits(0) == 1);
+  REQUIRE(packing.bits(1) == 3);
+  REQUIRE(packing.bits(2) == 0);
+  REQUIRE(packing.bits(3) == 8);
+  REQUIRE(packing.bits(5) == 8);
+  REQUIRE(packing.words_count() == 1);
+}
+
+TEST_CASE("Variables do not straddle words", "[packed_intvals]")
+{
+  tchecker::integer_t const min = std::numeric_limits<tchecker::integer_t>::min();
+  tchecker::integer_t const max = std::numeric_limits<tchecker::integer_t>::max();
+  unsigned const bits = std::numeric_limits<tchecker::integer_t>::digits + 1;
+  unsigned short const size = static_cast<unsigned short>(std::numeric_limits<tchecker::packed_word_t>::digits / bits + 1);
+
+  tchecker::integer_variables_t intvars;
+  intvars.declare("v", size, min, max, 0);
+
+  tchecker::intval_packing_t packing{intvars.flattened()};
+  REQUIRE(packing.bits(0) == bits);
+  REQUIRE(packing.words_count() == 2);
+
+  tchecker::intval_t * intval = tchecker::intval_allocate_and_construct(size, size);
+  tchecker::intval_t * unpacked = tchecker::intval_allocate_and_construct(size, size);
+  for (unsigned short id = 0; id < size; ++id)
+    (*intval)[id] = (id % 2 == 0 ? min : max);
+
+  std::vector<tchecker::packed_word_t> words(packing.words_count());
+  packing.pack(*intval, words.data());
+  packing.unpack(words.data(), *unpacked);
+  REQUIRE(*unpacked == *intval);
+
+  tchecker::intval_destruct_and_deallocate(intval);
+  tchecker::intval_destruct_and_deallocate(unpacked);
+}
+
+TEST_CASE("Packing and unpacking valuations", "[packed_intvals]")
+{
+  tchecker::integer_variables_t intvars;
+  intvars.declare("b", 1, 0, 1, 0);
+  intvars.declare("k", 1, -2, 2, 0);
+  intvars.declare("s", 1, 3, 3, 3);
+  intvars.declare("a", 3, 0, 255, 0);
+
+  tchecker::intval_packing_t packing{intvars.flattened()};
+  unsigned short const size = static_cast<unsigned short>(packing.intvars_count());
+
+  tchecker::intval_t * intval = tchecker::intval_allocate_and_construct(size, size);
+  tchecker::intval_t * unpacked = tchecker::intval_allocate_and_construct(size, size);
+  std::vector<tchecker::packed_word_t> words(packing.words_count()), other_words(packing.words_count());
+
+  (*intval)[0] = 1;
+  (*intval)[1] = -2;
+  (*intval)[2] = 3;
+  (*intval)[3] = 0;
+  (*intval)[4] = 128;
+  (*intval)[5] = 255;
+
+  SECTION("Unpacking a packed valuation yields the valuation")
+  {
+    packing.pack(*intval, words.data());
+    packing.unpack(words.data(), *unpacked);
+    REQUIRE(*unpacked == *intval);
+  }
+
+  SECTION("Valuations are equal iff their packed words are equal")
+  {
+    packing.pack(*intval, words.data());
+    packing.pack(*intval, other_words.data());
+    REQUIRE(words == other_words);
+
+    (*intval)[1] = 2;
+    packing.pack(*intval, other_words.data());
+    REQUIRE(words != other_words);
+  }
+
+  SECTION("Values out of domain are rejected")
+  {
+    (*intval)[1] = 3;
+    REQUIRE_THROWS_AS(packing.pack(*intval, words.data()), std::out_of_range);
+  }
+
+  SECTION("Valuations of wrong size are rejected")
+  {
+    tchecker::intval_t * small = tchecker::intval_allocate_and_construct(1, 1);
+    REQUIRE_THROWS_AS(packing.pack(*small, words.data()), std::invalid_argument);
+    REQUIRE_THROWS_AS(packing.unpack(words.data(), *small), std::invalid_argument);
+    tchecker::intval_destruct_and_deallocate(small);
+  }
+
+  tchecker::intval_destruct_and_deallocate(intval);
+  tchecker::intval_destruct_and_deallocate(unpacked);
+}
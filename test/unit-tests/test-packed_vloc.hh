@@ -0,0 +1,143 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "tchecker/syncprod/packed_vloc.hh"
+#include "tchecker/syncprod/vloc.hh"
+#include "tchecker/system/system.hh"
+
+#include "testutils/utils.hh"
+
+TEST_CASE("Packing and unpacking tuples of locations", "[packed_vloc]")
+{
+  std::string model = "system:packed_vloc \n\
+  \n\
+  process:P1 \n\
+  location:P1:l0{initial:} \n\
+  location:P1:l1 \n\
+  location:P1:l2 \n\
+  \n\
+  process:P2 \n\
+  location:P2:l0{initial:} \n\
+  \n\
+  process:P3 \n\
+  location:P3:l0{initial:} \n\
+  location:P3:l1 \n\
+  location:P3:l2 \n\
+  location:P3:l3 \n\
+  location:P3:l4 \n\
+  location:P3:l5 \n\
+  ";
+
+  std::shared_ptr<tchecker::parsing::system_declaration_t const> sysdecl{tchecker::test::parse(model)};
+  REQUIRE(sysdecl != nullptr);
+
+  tchecker::system::system_t system{*sysdecl};
+  tchecker::process_id_t const P1 = system.process_id("P1");
+  tchecker::process_id_t const P2 = system.process_id("P2");
+  tchecker::process_id_t const P3 = system.process_id("P3");
+
+  tchecker::vloc_packing_t packing{system};
+  std::vector<tchecker::packed_word_t> words(packing.words_count()), other_words(packing.words_count());
+
+  tchecker::process_id_t const size = static_cast<tchecker::process_id_t>(system.processes_count());
+  tchecker::vloc_t * vloc = tchecker::vloc_allocate_and_construct(size, size);
+  tchecker::vloc_t * unpacked = tchecker::vloc_allocate_and_construct(size, size);
+
+  (*vloc)[P1] = system.location(P1, "l2")->id();
+  (*vloc)[P2] = system.location(P2, "l0")->id();
+  (*vloc)[P3] = system.location(P3, "l5")->id();
+
+  SECTION("Layout")
+  {
+    REQUIRE(packing.processes_count() == 3);
+    REQUIRE(packing.bits(P1) == 2);
+    REQUIRE(packing.bits(P2) == 1);
+    REQUIRE(packing.bits(P3) == 3);
+    REQUIRE(packing.words_count() == 1);
+  }
+
+  SECTION("Unpacking a packed tuple of locations yields the tuple")
+  {
+    packing.pack(*vloc, words.data());
+    packing.unpack(words.data(), *unpacked);
+    REQUIRE(*unpacked == *vloc);
+  }
+
+  SECTION("Missing locations are packed")
+  {
+    (*vloc)[P2] = tchecker::NO_LOC;
+    packing.pack(*vloc, words.data());
+    packing.unpack(words.data(), *unpacked);
+    REQUIRE((*unpacked)[P2] == tchecker::NO_LOC);
+    REQUIRE(*unpacked == *vloc);
+  }
+
+  SECTION("Tuples are equal iff their packed words are equal")
+  {
+    packing.pack(*vloc, words.data());
+    packing.pack(*vloc, other_words.data());
+    REQUIRE(words == other_words);
+
+    (*vloc)[P3] = system.location(P3, "l4")->id();
+    packing.pack(*vloc, other_words.data());
+    REQUIRE(words != other_words);
+  }
+
+  SECTION("Locations of other processes are rejected")
+  {
+    (*vloc)[P1] = system.location(P3, "l0")->id();
+    REQUIRE_THROWS_AS(packing.pack(*vloc, words.data()), std::invalid_argument);
+  }
+
+  SECTION("Words that do not encode a tuple of locations are rejected")
+  {
+    // P3 has 6 locations, hence value 7 does not encode a location of P3
+    words[0] = ~tchecker::packed_word_t{0};
+    REQUIRE_THROWS_AS(packing.unpack(words.data(), *unpacked), std::invalid_argument);
+  }
+
+  tchecker::vloc_destruct_and_deallocate(vloc);
+  tchecker::vloc_destruct_and_deallocate(unpacked);
+}
+
+TEST_CASE("Processes do not straddle words", "[packed_vloc]")
+{
+  // 40 processes with 3 locations: 2 bits each, 32 processes per word
+  std::string model = "system:packed_vloc_large \n";
+  for (int i = 0; i < 40; ++i) {
+    std::string const p = "P" + std::to_string(i);
+    model += "process:" + p + "\n";
+    model += "location:" + p + ":l0{initial:}\n";
+    model += "location:" + p + ":l1\n";
+    model += "location:" + p + ":l2\n";
+  }
+
+  std::shared_ptr<tchecker::parsing::system_declaration_t const> sysdecl{tchecker::test::parse(model)};
+  REQUIRE(sysdecl != nullptr);
+
+  tchecker::system::system_t system{*sysdecl};
+  tchecker::vloc_packing_t packing{system};
+  REQUIRE(packing.words_count() == 2);
+
+  tchecker::process_id_t const size = static_cast<tchecker::process_id_t>(system.processes_count());
+  tchecker::vloc_t * vloc = tchecker::vloc_allocate_and_construct(size, size);
+  tchecker::vloc_t * unpacked = tchecker::vloc_allocate_and_construct(size, size);
+  for (tchecker::process_id_t pid = 0; pid < size; ++pid)
+    (*vloc)[pid] = system.location(pid, (pid % 3 == 0 ? "l0" : (pid % 3 == 1 ? "l1" : "l2")))->id();
+
+  std::vector<tchecker::packed_word_t> words(packing.words_count());
+  packing.pack(*vloc, words.data());
+  packing.unpack(words.data(), *unpacked);
+  REQUIRE(*unpacked == *vloc);
+
+  tchecker::vloc_destruct_and_deallocate(vloc);
+  tchecker::vloc_destruct_and_deallocate(unpacked);
+}
@@ -0,0 +1,175 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "tchecker/utils/pool.hh"
+#include "tchecker/utils/shared_objects.hh"
+
+// Object for testing pools, counts destructions
+class pco_t {
+public:
+  pco_t(int x) : _x(x) {}
+  ~pco_t() { ++destructed; }
+  int x() const { return _x; }
+
+  static std::atomic<std::size_t> destructed;
+
+private:
+  int _x;
+};
+
+std::atomic<std::size_t> pco_t::destructed{0};
+
+namespace tchecker {
+template <> class allocation_size_t<pco_t> {
+public:
+  static constexpr std::size_t alloc_size() { return sizeof(pco_t); }
+
+  template <class... ARGS> static constexpr std::size_t alloc_size(ARGS &&... /*args*/) { return sizeof(pco_t); }
+};
+} // namespace tchecker
+
+using shared_pco_t = tchecker::make_shared_t<pco_t>;
+
+using pco_pool_t = tchecker::pool_t<shared_pco_t>;
+
+// Barrier for testing concurrent pools
+class pco_barrier_t {
+public:
+  pco_barrier_t(std::size_t count) : _count(count), _waiting(0), _generation(0) {}
+
+  void wait()
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    std::size_t const generation = _generation;
+    if (++_waiting == _count) {
+      _waiting = 0;
+      ++_generation;
+      _cv.notify_all();
+    }
+    else
+      _cv.wait(lock, [&]() { return _generation != generation; });
+  }
+
+private:
+  std::size_t const _count;
+  std::size_t _waiting;
+  std::size_t _generation;
+  std::mutex _mutex;
+  std::condition_variable _cv;
+};
+
+TEST_CASE("Destruct objects in pools", "[pool]")
+{
+  pco_t::destructed = 0;
+  pco_pool_t pool(1, tchecker::allocation_size_t<shared_pco_t>::alloc_size());
+
+  SECTION("Destructed chunks are free")
+  {
+    tchecker::intrusive_shared_ptr_t<shared_pco_t> p = pool.construct(1);
+    shared_pco_t * o = p.ptr();
+    REQUIRE(pool.destruct(p));
+    REQUIRE(p.ptr() == nullptr);
+    REQUIRE(pco_t::destructed == 1);
+    REQUIRE(o->refcount() == pco_pool_t::FREE_CHUNK);
+
+    pool.destruct_all();
+    REQUIRE(pco_t::destructed == 1);
+  }
+
+  SECTION("Destructed chunks are reused")
+  {
+    tchecker::intrusive_shared_ptr_t<shared_pco_t> p = pool.construct(1);
+    shared_pco_t * o = p.ptr();
+    REQUIRE(pool.destruct(p));
+
+    tchecker::intrusive_shared_ptr_t<shared_pco_t> q = pool.construct(2);
+    REQUIRE(q.ptr() == o);
+    REQUIRE(q->refcount() == 1);
+    REQUIRE(q->x() == 2);
+
+    q = nullptr;
+    pool.destruct_all();
+    REQUIRE(pco_t::destructed == 2);
+  }
+
+  SECTION("Shared objects are not destructed")
+  {
+    tchecker::intrusive_shared_ptr_t<shared_pco_t> p = pool.construct(1);
+    tchecker::intrusive_shared_ptr_t<shared_pco_t> q = p;
+    REQUIRE_FALSE(pool.destruct(p));
+    REQUIRE(p.ptr() == q.ptr());
+    REQUIRE(pco_t::destructed == 0);
+
+    p = nullptr;
+    q = nullptr;
+    pool.destruct_all();
+    REQUIRE(pco_t::destructed == 1);
+  }
+}
+
+TEST_CASE("Concurrent pools", "[pool]")
+{
+  std::size_t const threads_count = 4, objects_count = 64;
+  pco_t::destructed = 0;
+  pco_pool_t pool(objects_count, tchecker::allocation_size_t<shared_pco_t>::alloc_size());
+  pool.concurrent();
+  REQUIRE(pool.is_concurrent());
+
+  std::vector<std::vector<tchecker::intrusive_shared_ptr_t<shared_pco_t>>> objects(threads_count);
+  std::vector<std::size_t> collected(threads_count, 0);
+  pco_barrier_t barrier(threads_count);
+
+  auto worker = [&](std::size_t i) {
+    // fill one block of the pool of this thread
+    for (std::size_t k = 0; k < objects_count; ++k)
+      objects[i].push_back(pool.construct(static_cast<int>(i * objects_count + k)));
+    barrier.wait();
+
+    // destruct the objects of another thread
+    std::size_t const j = (i + 1) % threads_count;
+    for (tchecker::intrusive_shared_ptr_t<shared_pco_t> & p : objects[j])
+      pool.destruct(p);
+    barrier.wait();
+
+    // construct again: the chunks released by the other thread are reclaimed
+    objects[i].clear();
+    for (std::size_t k = 0; k < objects_count; ++k)
+      objects[i].push_back(pool.construct(static_cast<int>(k)));
+    barrier.wait();
+
+    // release half of the objects, and collect them
+    for (std::size_t k = 0; k < objects_count; k += 2)
+      objects[i][k] = nullptr;
+    collected[i] = pool.collect();
+  };
+
+  std::vector<std::thread> threads;
+  for (std::size_t i = 0; i < threads_count; ++i)
+    threads.emplace_back(worker, i);
+  for (std::thread & t : threads)
+    t.join();
+
+  REQUIRE(pco_t::destructed == threads_count * objects_count * 3 / 2);
+  REQUIRE(pool.blocks_count() == threads_count); // no block allocated in the second round
+  for (std::size_t i = 0; i < threads_count; ++i)
+    REQUIRE(collected[i] == objects_count / 2);
+  REQUIRE(pool.livesize() == threads_count * objects_count / 2 * pool.alloc_size());
+
+  // destruct the remaining objects from the main thread
+  for (std::size_t i = 0; i < threads_count; ++i)
+    objects[i].clear();
+  pool.destruct_all();
+  REQUIRE(pco_t::destructed == threads_count * objects_count * 2);
+  REQUIRE(pool.blocks_count() == 0);
+  REQUIRE(pool.livesize() == 0);
+}
@@ -0,0 +1,156 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <boost/dynamic_bitset.hpp>
+
+#include "tchecker/algorithms/properties.hh"
+#include "tchecker/algorithms/reach/zg-reach.hh"
+
+#include "testutils/utils.hh"
+
+static boost::dynamic_bitset<> properties_labels(std::string const & bits)
+{
+  // bits are given from label 0 to label n-1, whereas boost::dynamic_bitset reads them the other way round
+  return boost::dynamic_bitset<>{std::string{bits.rbegin(), bits.rend()}};
+}
+
+TEST_CASE("Sets of reachability properties", "[properties]")
+{
+  tchecker::algorithms::properties_t properties;
+  properties.add("a", properties_labels("100"));
+  properties.add("b,c", properties_labels("011"));
+  properties.add("", properties_labels("000"));
+
+  REQUIRE(properties.size() == 3);
+  REQUIRE(properties.name(1) == "b,c");
+  REQUIRE(properties.labels(1) == properties_labels("011"));
+
+  SECTION("No property is reachable initially")
+  {
+    for (std::size_t i = 0; i < properties.size(); ++i)
+      REQUIRE_FALSE(properties.reachable(i));
+    REQUIRE_FALSE(properties.some_reachable());
+    REQUIRE(properties.pending());
+    REQUIRE_FALSE(properties.resolved());
+  }
+
+  SECTION("A property matches the supersets of its labels")
+  {
+    REQUIRE(properties.match(properties_labels("100")));
+    REQUIRE(properties.match(properties_labels("111")));
+    REQUIRE(properties.match(properties_labels("011")));
+    REQUIRE_FALSE(properties.match(properties_labels("010")));
+    REQUIRE_FALSE(properties.match(properties_labels("000")));
+  }
+
+  SECTION("Marking labels reaches the properties they satisfy")
+  {
+    properties.mark(properties_labels("110"));
+    REQUIRE(properties.reachable(0));
+    REQUIRE_FALSE(properties.reachable(1));
+    REQUIRE_FALSE(properties.reachable(2));
+    REQUIRE(properties.some_reachable());
+    REQUIRE(properties.pending());
+    REQUIRE_FALSE(properties.resolved());
+
+    // reached properties do not match anymore
+    REQUIRE_FALSE(properties.match(properties_labels("100")));
+
+    properties.mark(properties_labels("011"));
+    REQUIRE(properties.reachable(1));
+    REQUIRE_FALSE(properties.pending());
+    REQUIRE(properties.resolved());
+    REQUIRE_FALSE(properties.match(properties_labels("111")));
+  }
+
+  SECTION("Empty properties are never reached")
+  {
+    properties.mark(properties_labels("111"));
+    REQUIRE(properties.resolved());
+    REQUIRE_FALSE(properties.reachable(2));
+  }
+
+  SECTION("Reset clears reachability")
+  {
+    properties.mark(properties_labels("111"));
+    properties.reset();
+    for (std::size_t i = 0; i < properties.size(); ++i)
+      REQUIRE_FALSE(properties.reachable(i));
+    REQUIRE_FALSE(properties.some_reachable());
+    REQUIRE(properties.pending());
+  }
+
+  SECTION("Attributes report names and reachability of properties")
+  {
+    properties.mark(properties_labels("100"));
+    std::map<std::string, std::string> m;
+    properties.attributes(m);
+    REQUIRE(m.size() == 6);
+    REQUIRE(m["PROPERTY_0_LABELS"] == "a");
+    REQUIRE(m["PROPERTY_0_REACHABLE"] == "true");
+    REQUIRE(m["PROPERTY_1_LABELS"] == "b,c");
+    REQUIRE(m["PROPERTY_1_REACHABLE"] == "false");
+    REQUIRE(m["PROPERTY_2_REACHABLE"] == "false");
+  }
+}
+
+TEST_CASE("A set with only empty properties is never resolved", "[properties]")
+{
+  tchecker::algorithms::properties_t properties{properties_labels("00")};
+  REQUIRE(properties.size() == 1);
+  REQUIRE_FALSE(properties.pending());
+  properties.mark(properties_labels("11"));
+  REQUIRE_FALSE(properties.some_reachable());
+  REQUIRE_FALSE(properties.resolved());
+}
+
+TEST_CASE("Several properties checked in a single exploration", "[properties]")
+{
+  std::string model = "system:properties \n\
+  event:a \n\
+  event:b \n\
+  int:1:0:3:0:i \n\
+  clock:1:x \n\
+  \n\
+  process:P \n\
+  location:P:l0{initial: : labels: start} \n\
+  location:P:l1{labels: one} \n\
+  location:P:l2{labels: two} \n\
+  location:P:l3{labels: never} \n\
+  edge:P:l0:l1:a{provided: x>=1 : do: i=i+1} \n\
+  edge:P:l1:l2:b{provided: i==1 : do: i=i+1} \n\
+  edge:P:l2:l3:a{provided: i==3} \n\
+  ";
+
+  std::shared_ptr<tchecker::parsing::system_declaration_t const> sysdecl{tchecker::test::parse(model)};
+  REQUIRE(sysdecl != nullptr);
+
+  for (std::string const & search_order : std::vector<std::string>{"bfs", "dfs"}) {
+    auto && [stats, properties, state_space] =
+        tchecker::algorithms::zg_reach::run(*sysdecl, std::vector<std::string>{"one", "never", "start,two"}, search_order);
+
+    REQUIRE(properties.size() == 3);
+    REQUIRE(properties.reachable(0));
+    REQUIRE_FALSE(properties.reachable(1));
+    // labels start and two are never reached simultaneously
+    REQUIRE_FALSE(properties.reachable(2));
+    REQUIRE(stats.reachable());
+
+    // a single property agrees with the single-property run
+    for (std::string const & labels : std::vector<std::string>{"one", "never", "two"}) {
+      auto && [single_stats, single_state_space] = tchecker::algorithms::zg_reach::run(*sysdecl, labels, search_order);
+      auto && [multi_stats, multi_properties, multi_state_space] =
+          tchecker::algorithms::zg_reach::run(*sysdecl, std::vector<std::string>{labels}, search_order);
+      REQUIRE(multi_properties.reachable(0) == single_stats.reachable());
+      REQUIRE(multi_stats.visited_states() == single_stats.visited_states());
+    }
+  }
+}
@@ -0,0 +1,143 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <limits>
+#include <stdexcept>
+#include <thread>
+
+#include "tchecker/utils/pool.hh"
+#include "tchecker/utils/shared_objects.hh"
+
+// Object for testing reference counters
+class rco_t {
+public:
+  rco_t(int x) : _x(x) {}
+  int x() const { return _x; }
+
+private:
+  int _x;
+};
+
+namespace tchecker {
+template <> class allocation_size_t<rco_t> {
+public:
+  static constexpr std::size_t alloc_size() { return sizeof(rco_t); }
+
+  template <class... ARGS> static constexpr std::size_t alloc_size(ARGS &&... /*args*/) { return sizeof(rco_t); }
+};
+} // namespace tchecker
+
+using atomic_rco_t = tchecker::make_atomic_shared_t<rco_t>;
+
+// reference counters with values 0..3, reserved values above 3
+template <class POLICY>
+using small_rco_t = tchecker::make_shared_t<rco_t, std::size_t, std::numeric_limits<std::size_t>::max() - 3, POLICY>;
+
+template <class T> void check_reference_counting()
+{
+  T * o = T::allocate_and_construct(1);
+  REQUIRE(o->refcount() == 0);
+
+  {
+    tchecker::intrusive_shared_ptr_t<T> p1(o);
+    REQUIRE(o->refcount() == 1);
+    {
+      tchecker::intrusive_shared_ptr_t<T> p2(p1);
+      REQUIRE(o->refcount() == 2);
+    }
+    REQUIRE(o->refcount() == 1);
+  }
+  REQUIRE(o->refcount() == 0);
+  REQUIRE_THROWS_AS(o->release_reference(), std::underflow_error);
+  REQUIRE(o->refcount() == 0);
+
+  T::destruct_and_deallocate(o);
+}
+
+template <class T> void check_reference_overflow()
+{
+  T * o = T::allocate_and_construct(1);
+  o->take_reference();
+  o->take_reference();
+  REQUIRE(o->refcount() == 2);
+  REQUIRE_THROWS_AS(o->take_reference(), std::overflow_error);
+  REQUIRE(o->refcount() == 2);
+  o->release_reference();
+  o->release_reference();
+  T::destruct_and_deallocate(o);
+}
+
+template <class T> void check_reference_on_collected_object()
+{
+  tchecker::pool_t<T> pool(16, tchecker::allocation_size_t<T>::alloc_size());
+  tchecker::intrusive_shared_ptr_t<T> p = pool.construct(1);
+  T * o = p.ptr();
+  p = nullptr;
+  REQUIRE(pool.collect() == 1);
+  REQUIRE(o->refcount() == tchecker::pool_t<T>::FREE_CHUNK);
+  REQUIRE_THROWS_AS(o->take_reference(), std::logic_error);
+  REQUIRE(o->refcount() == tchecker::pool_t<T>::FREE_CHUNK);
+}
+
+TEST_CASE("Reference counting policies", "[shared_objects]")
+{
+  SECTION("Sequential reference counters")
+  {
+    check_reference_counting<tchecker::make_shared_t<rco_t>>();
+    check_reference_overflow<small_rco_t<tchecker::sequential_refcount_t>>();
+    check_reference_on_collected_object<tchecker::make_shared_t<rco_t>>();
+  }
+
+  SECTION("Atomic reference counters")
+  {
+    check_reference_counting<atomic_rco_t>();
+    check_reference_overflow<small_rco_t<tchecker::atomic_refcount_t>>();
+    check_reference_on_collected_object<atomic_rco_t>();
+  }
+}
+
+TEST_CASE("Atomic reference counters concurrent with collection", "[shared_objects]")
+{
+  std::size_t const n = 256;
+  tchecker::pool_t<atomic_rco_t> pool(n, tchecker::allocation_size_t<atomic_rco_t>::alloc_size());
+
+  // collectable objects
+  std::vector<atomic_rco_t *> objects;
+  for (std::size_t i = 0; i < n; ++i) {
+    tchecker::intrusive_shared_ptr_t<atomic_rco_t> p = pool.construct(static_cast<int>(i));
+    objects.push_back(p.ptr());
+  }
+
+  // take references while the pool is collected
+  std::vector<tchecker::intrusive_shared_ptr_t<atomic_rco_t>> references(n);
+  std::size_t failures = 0;
+  std::thread taker([&]() {
+    for (std::size_t i = 0; i < n; ++i) {
+      try {
+        references[i] = objects[i];
+      }
+      catch (std::logic_error const &) {
+        ++failures;
+      }
+    }
+  });
+  std::size_t const collected = pool.collect();
+  taker.join();
+
+  // every object has either been collected, or referenced
+  REQUIRE(collected == failures);
+  for (std::size_t i = 0; i < n; ++i) {
+    if (references[i].ptr() == nullptr)
+      REQUIRE(objects[i]->refcount() == tchecker::pool_t<atomic_rco_t>::FREE_CHUNK);
+    else {
+      REQUIRE(objects[i]->refcount() == 1);
+      REQUIRE(objects[i]->x() == static_cast<int>(i));
+    }
+  }
+
+  references.clear();
+}
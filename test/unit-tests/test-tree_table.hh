@@ -0,0 +1,126 @@
+/*
+ * This file is a part of the TChecker project.
+ *
+ * See files AUTHORS and LICENSE for copyright details.
+ *
+ */
+
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "tchecker/utils/tree_table.hh"
+
+TEST_CASE("Vectors in tree tables", "[tree_table]")
+{
+  SECTION("Vectors are retrieved from their identifier")
+  {
+    for (std::size_t width = 1; width <= 7; ++width) {
+      tchecker::tree_table_t table{width, 4};
+      std::vector<std::vector<tchecker::packed_word_t>> vectors;
+      std::vector<tchecker::tree_table_t::index_t> ids;
+      for (tchecker::packed_word_t k = 0; k < 100; ++k) {
+        std::vector<tchecker::packed_word_t> v(width);
+        for (std::size_t i = 0; i < width; ++i)
+          v[i] = (k * 7 + i * 13) % 11;
+        vectors.push_back(v);
+        ids.push_back(table.insert(v.data()));
+      }
+
+      std::vector<tchecker::packed_word_t> w(width);
+      for (std::size_t k = 0; k < vectors.size(); ++k) {
+        table.get(ids[k], w.data());
+        REQUIRE(w == vectors[k]);
+      }
+    }
+  }
+
+  SECTION("Equal vectors have the same identifier")
+  {
+    tchecker::tree_table_t table{5};
+    std::vector<tchecker::packed_word_t> v{1, 2, 3, 4, 5}, w{1, 2, 3, 4, 5}, u{1, 2, 3, 4, 6};
+    REQUIRE(table.insert(v.data()) == table.insert(w.data()));
+    REQUIRE(table.insert(v.data()) != table.insert(u.data()));
+  }
+
+  SECTION("Vectors that differ in one word share subtrees")
+  {
+    // words are not identifiers of pairs, so that pairs at distinct levels do not coincide
+    tchecker::tree_table_t table{8};
+    std::vector<tchecker::packed_word_t> v{101, 102, 103, 104, 105, 106, 107, 108};
+    table.insert(v.data());
+    REQUIRE(table.pairs_count() == 7);
+
+    v[7] = 109;
+    table.insert(v.data());
+    REQUIRE(table.pairs_count() == 10); // one new pair per level
+  }
+
+  SECTION("Unknown identifiers are rejected")
+  {
+    tchecker::tree_table_t table{2};
+    std::vector<tchecker::packed_word_t> v{1, 2};
+    table.insert(v.data());
+    REQUIRE_THROWS_AS(table.get(1, v.data()), std::out_of_range);
+    REQUIRE_THROWS_AS(table.pair(1), std::out_of_range);
+  }
+}
+
+TEST_CASE("Rebuilding tree tables", "[tree_table]")
+{
+  tchecker::tree_table_t table{6, 2};
+  std::vector<tchecker::tree_table_t::index_t> ids;
+  for (tchecker::packed_word_t k = 0; k < 50; ++k) {
+    std::vector<tchecker::packed_word_t> v{k % 3, k % 5, k % 7, k, k % 2, 42};
+    ids.push_back(table.insert(v.data()));
+  }
+
+  // pairs inserted in order get the same identifiers
+  tchecker::tree_table_t copy{6, 2};
+  for (tchecker::tree_table_t::index_t id = 0; id < table.pairs_count(); ++id) {
+    auto && [left, right] = table.pair(id);
+    REQUIRE(copy.find_or_add(left, right) == id);
+  }
+  REQUIRE(copy.pairs_count() == table.pairs_count());
+
+  std::vector<tchecker::packed_word_t> v(6), w(6);
+  for (tchecker::tree_table_t::index_t id : ids) {
+    table.get(id, v.data());
+    copy.get(id, w.data());
+    REQUIRE(v == w);
+  }
+}
+
+TEST_CASE("Concurrent insertions in tree tables", "[tree_table]")
+{
+  std::size_t const threads_count = 4, vectors_count = 1000, width = 4;
+  tchecker::tree_table_t table{width, 16};
+
+  // all threads insert the same vectors
+  std::vector<std::vector<tchecker::tree_table_t::index_t>> ids(threads_count);
+  auto worker = [&](std::size_t t) {
+    std::vector<tchecker::packed_word_t> v(width);
+    for (std::size_t k = 0; k < vectors_count; ++k) {
+      std::size_t const j = (k + t * 250) % vectors_count;
+      for (std::size_t i = 0; i < width; ++i)
+        v[i] = (j >> (3 * i)) & 7;
+      ids[t].push_back(table.insert(v.data()));
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (std::size_t t = 0; t < threads_count; ++t)
+    threads.emplace_back(worker, t);
+  for (std::thread & th : threads)
+    th.join();
+
+  std::vector<tchecker::packed_word_t> v(width);
+  for (std::size_t t = 0; t < threads_count; ++t)
+    for (std::size_t k = 0; k < vectors_count; ++k) {
+      std::size_t const j = (k + t * 250) % vectors_count;
+      REQUIRE(ids[t][k] == ids[0][j]);
+      table.get(ids[t][k], v.data());
+      for (std::size_t i = 0; i < width; ++i)
+        REQUIRE(v[i] == ((j >> (3 * i)) & 7));
+    }
+}
@@ -14,7 +14,10 @@
 #define CATCH_CONFIG_MAIN
 #include <catch2/catch_test_macros.hpp>
 
+#include "test-binary_graph.hh"
+#include "test-bwd_reach.hh"
 #include "test-cache.hh"
+#include "test-checkpoint.hh"
 #include "test-clock_updates.hh"
 #include "test-clockbounds.hh"
 #include "test-clocks.hh"
@@ -30,9 +33,15 @@
 #include "test-hashtable.hh"
 #include "test-labels.hh"
 #include "test-ordering.hh"
+#include "test-packed_intvals.hh"
+#include "test-packed_vloc.hh"
+#include "test-pool.hh"
+#include "test-properties.hh"
 #include "test-refdbm.hh"
 #include "test-reference_clock_variables.hh"
 #include "test-refzg-semantics.hh"
+#include "test-shared_objects.hh"
+#include "test-tree_table.hh"
 #include "test-variables-access.hh"
 #include "test-virtual_constraint.hh"
 #include "test-waiting.hh"